@@ -14,18 +14,20 @@
 using namespace System;
 using namespace UnityEngine;
 
-namespace
+namespace MyGame
 {
-	struct GameState
+	BallScript::BallScript(Plugin::InternalUse iu, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseBallScript(nullptr)
+		, MyGame::BaseBallScript(iu, handle)
 	{
-		float BallDir;
-	};
+		// Hot fields set here are copied to their row afterward
+		GetDir() = -1.0f;
+	}
 	
-	GameState* gameState;
-}
-
-namespace MyGame
-{
 	void BallScript::Update()
 	{
 		Transform transform = GetTransform();
@@ -33,12 +35,13 @@ namespace MyGame
 		const float speed = 1.2f;
 		const float min = -1.5f;
 		const float max = 1.5f;
-		float distance = Time::GetDeltaTime() * speed * gameState->BallDir;
+		float& dir = GetDir();
+		float distance = Time::GetDeltaTime() * speed * dir;
 		Vector3 offset(distance, 0, 0);
 		Vector3 newPos = pos + offset;
 		if (newPos.x > max)
 		{
-			gameState->BallDir *= -1.0f;
+			dir *= -1.0f;
 			newPos.x = max - (newPos.x - max);
 			if (newPos.x < min)
 			{
@@ -47,7 +50,7 @@ namespace MyGame
 		}
 		else if (newPos.x < min)
 		{
-			gameState->BallDir *= -1.0f;
+			dir *= -1.0f;
 			newPos.x = min + (min - newPos.x);
 			if (newPos.x > max)
 			{
@@ -65,15 +68,15 @@ void PluginMain(
 	int32_t memorySize,
 	bool isFirstBoot)
 {
-	gameState = (GameState*)memory;
+	// Game state is kept in hot fields of the scripts instead
+	(void)memory;
+	(void)memorySize;
+	
 	if (isFirstBoot)
 	{
 		String message("Game booted up");
 		Debug::Log(message);
 		
-		// The ball initially goes right
-		gameState->BallDir = 1.0f;
-		
 		// Create the ball game object out of a sphere primitive
 		GameObject go = GameObject::CreatePrimitive(PrimitiveType::Sphere);
 		String name("GameObject with a BallScript");
@@ -17,7 +17,7 @@ namespace MyGame
 	struct BallScript : MyGame::BaseBallScript
 	{
 		MY_GAME_BALL_SCRIPT_DEFAULT_CONTENTS
-		MY_GAME_BALL_SCRIPT_DEFAULT_CONSTRUCTOR
+		MY_GAME_BALL_SCRIPT_DEFAULT_CONSTRUCTOR_DECLARATION
 		void Update() override;
 	};
 }
@@ -21,6 +21,31 @@
 // For memset(), etc.
 #include <string.h>
 
+// For snprintf()
+#include <stdio.h>
+
+// For reserving and committing plugin memory. The Windows functions are
+// declared here because including windows.h defines macros that clash with
+// .NET names like SendMessage.
+#if defined(_WIN32)
+	extern "C" __declspec(dllimport) void* __stdcall VirtualAlloc(
+		void* address,
+		size_t size,
+		unsigned long allocationType,
+		unsigned long protect);
+	extern "C" __declspec(dllimport) int __stdcall VirtualFree(
+		void* address,
+		size_t size,
+		unsigned long freeType);
+#elif !defined(__EMSCRIPTEN__)
+	#include <sys/mman.h>
+#endif
+
+// For _BitScanForward(), etc.
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
 // Macro to put before functions that need to be exposed to C#
 #ifdef _WIN32
 	#define DLLEXPORT extern "C" __declspec(dllexport)
@@ -28,6 +53,20 @@
 	#define DLLEXPORT extern "C"
 #endif
 
+// Macros to use exceptions only when they're enabled. Without exceptions
+// the catch block is never run and throwing aborts.
+#if PLUGIN_EXCEPTIONS
+	#define PLUGIN_TRY try
+	#define PLUGIN_CATCH_ALL catch (...)
+	#define PLUGIN_THROW(ex) throw ex
+	#define PLUGIN_RETHROW throw
+#else
+	#define PLUGIN_TRY if (true)
+	#define PLUGIN_CATCH_ALL else
+	#define PLUGIN_THROW(ex) abort()
+	#define PLUGIN_RETHROW abort()
+#endif
+
 ////////////////////////////////////////////////////////////////
 // C# functions for C++ to call
 ////////////////////////////////////////////////////////////////
@@ -39,6 +78,11 @@ namespace Plugin
 	void (*SetException)(int32_t handle);
 	int32_t (*ArrayGetLength)(int32_t handle);
 	int32_t (*EnumerableGetEnumerator)(int32_t handle);
+	int32_t (*EnumeratorMoveNextBatch)(int32_t handle, int32_t* handles, int32_t maxCount);
+	int32_t (*StoreCsharpException)();
+	int32_t (*GameObjectPoolPrewarm)(int32_t originalHandle, int32_t count, int32_t* handles, int32_t* instanceIds);
+	void (*ApplyGameObjectPoolCommands)();
+	int32_t (*SpawnGameObjectBatch)(const SpawnDescriptor* descriptors, int32_t count, const int32_t* names, const SpawnComponent* components, int32_t* handles);
 	
 	/*BEGIN FUNCTION POINTERS*/
 	void (*ReleaseSystemDecimal)(int32_t handle);
@@ -64,9 +108,16 @@ namespace Plugin
 	int32_t (*SystemExceptionConstructorSystemString)(int32_t messageHandle);
 	int32_t (*BoxPrimitiveType)(UnityEngine::PrimitiveType val);
 	UnityEngine::PrimitiveType (*UnboxPrimitiveType)(int32_t valHandle);
+	void (*ReleaseUnityEngineRaycastHit)(int32_t handle);
+	void (*UnityEngineRaycastHitGetValue)(int32_t thisHandle, void* value);
+	int32_t (*BoxRaycastHit)(int32_t valHandle);
+	int32_t (*UnboxRaycastHit)(int32_t valHandle);
+	void (*SystemIDisposableMethodDispose)(int32_t thisHandle);
+	int32_t (*SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumerator)(int32_t thisHandle);
+	int32_t (*SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrent)(int32_t thisHandle);
 	float (*UnityEngineTimePropertyGetDeltaTime)();
 	void (*ReleaseBaseBallScript)(int32_t handle);
-	void (*BaseBallScriptConstructor)(int32_t cppHandle, int32_t* handle);
+	void (*BaseBallScriptConstructor)(int32_t cppHandle, void* cppPointer, int32_t* handle);
 	int32_t (*BoxBoolean)(uint32_t val);
 	int32_t (*UnboxBoolean)(int32_t valHandle);
 	int32_t (*BoxSByte)(int8_t val);
@@ -91,9 +142,30 @@ namespace Plugin
 	float (*UnboxSingle)(int32_t valHandle);
 	int32_t (*BoxDouble)(double val);
 	double (*UnboxDouble)(int32_t valHandle);
+	int32_t (*UnityEngineUnityEngineRaycastHitArray1Constructor1)(int32_t length0);
+	int32_t (*UnityEngineRaycastHitArray1GetItem1)(int32_t thisHandle, int32_t index0);
+	int32_t (*UnityEngineRaycastHitArray1SetItem1)(int32_t thisHandle, int32_t index0, int32_t itemHandle);
+	void (*UnityEngineRaycastHitArray1GetValues)(int32_t thisHandle, int32_t startIndex, int32_t count, void* values);
+	void (*UnityEngineRaycastHitArray1GetItems)(int32_t thisHandle, int32_t startIndex, int32_t count, void* items);
 	/*END FUNCTION POINTERS*/
 }
 
+namespace Plugin
+{
+	// An unhandled exception caused by C++ calling into C#. This is the
+	// function that throws it as the right C++ type or null if there is no
+	// exception. C# holds the exception object until it's thrown.
+	thread_local void (*unhandledCsharpException)(int32_t handle) = nullptr;
+	
+	// Throw the unhandled exception unless a CatchCsharpExceptions is in
+	// scope on this thread
+	void ThrowUnhandledCsharpException();
+	
+	// Pass the exception being caught to C#. Exceptions that aren't a
+	// System::Exception are replaced by one with the given message.
+	void SetCaughtException(const char* message);
+}
+
 ////////////////////////////////////////////////////////////////
 // Global variables
 ////////////////////////////////////////////////////////////////
@@ -757,44 +829,6 @@ namespace System
 	}
 }
 
-////////////////////////////////////////////////////////////////
-// Support for using IEnumerable with range for loops
-////////////////////////////////////////////////////////////////
-
-namespace Plugin
-{
-	// End iterators are dummies full of null
-	EnumerableIterator::EnumerableIterator(decltype(nullptr))
-		: enumerator(nullptr)
-		, hasMore(false)
-	{
-	}
-	
-	// Begin iterators keep track of an IEnumerator
-	EnumerableIterator::EnumerableIterator(
-		System::Collections::IEnumerable& enumerable)
-		: enumerator(enumerable.GetEnumerator())
-	{
-		hasMore = enumerator.MoveNext();
-	}
-	
-	EnumerableIterator& EnumerableIterator::operator++()
-	{
-		hasMore = enumerator.MoveNext();
-		return *this;
-	}
-	
-	bool EnumerableIterator::operator!=(const EnumerableIterator& other)
-	{
-		return hasMore;
-	}
-	
-	System::Object EnumerableIterator::operator*()
-	{
-		return enumerator.GetCurrent();
-	}
-}
-
 ////////////////////////////////////////////////////////////////
 // User-defined literals for creating decimals (System.Decimal)
 ////////////////////////////////////////////////////////////////
@@ -810,976 +844,1995 @@ System::Decimal operator"" _m(unsigned long long x)
 }
 
 ////////////////////////////////////////////////////////////////
-// Reference counting of managed objects
+// Plugin memory
 ////////////////////////////////////////////////////////////////
 
 namespace Plugin
 {
-	int32_t RefCountsLenClass;
-	int32_t* RefCountsClass;
-
-	void ReferenceManagedClass(int32_t handle)
+	// Memory is committed in multiples of this. It's a multiple of the page
+	// size on all supported platforms.
+	const size_t MemoryCommitGranularity = 64 * 1024;
+	
+	// Memory is aligned to this so unrelated data doesn't share cache lines
+	const size_t CacheLineSize = 64;
+	
+	// Plugin memory is aligned to this when large pages are used
+	const size_t LargePageSize = 2 * 1024 * 1024;
+	
+	// Range of the plugin memory and the end of its committed part. Reloads
+	// start over at the beginning since committing memory again is harmless.
+	uint8_t* MemoryBegin;
+	uint8_t* MemoryEnd;
+	uint8_t* MemoryCommitEnd;
+	
+	size_t RoundUpToCommitGranularity(size_t size)
 	{
-		assert(handle >= 0 && handle < RefCountsLenClass);
-		if (handle != 0)
-		{
-			RefCountsClass[handle]++;
-		}
+		return (size + MemoryCommitGranularity - 1)
+			& ~(MemoryCommitGranularity - 1);
 	}
-
-	void DereferenceManagedClass(int32_t handle)
+	
+	size_t RoundDownToCommitGranularity(size_t size)
 	{
-		assert(handle >= 0 && handle < RefCountsLenClass);
-		if (handle != 0)
-		{
-			int32_t numRemain = --RefCountsClass[handle];
-			if (numRemain == 0)
-			{
-				ReleaseObject(handle);
-			}
-		}
+		return size & ~(MemoryCommitGranularity - 1);
 	}
 	
-	bool DereferenceManagedClassNoRelease(int32_t handle)
+	uint8_t* AlignPointer(uint8_t* ptr, size_t alignment)
 	{
-		assert(handle >= 0 && handle < RefCountsLenClass);
-		if (handle != 0)
-		{
-			int32_t numRemain = --RefCountsClass[handle];
-			if (numRemain == 0)
-			{
-				return true;
-			}
-		}
-		return false;
+		return (uint8_t*)(
+			((uintptr_t)ptr + alignment - 1) & ~(uintptr_t)(alignment - 1));
 	}
 	
-	/*BEGIN GLOBAL STATE AND FUNCTIONS*/
-	int32_t RefCountsLenSystemDecimal;
-	int32_t* RefCountsSystemDecimal;
+	// Set aside a cache line aligned region of memory during Init
+	template <typename T> T* PlaceRegion(uint8_t*& curMemory, size_t count)
+	{
+		T* region = (T*)AlignPointer(curMemory, CacheLineSize);
+		curMemory = (uint8_t*)(region + count);
+		return region;
+	}
 	
-	void ReferenceManagedSystemDecimal(int32_t handle)
+	// Reserve address space without committing any of it
+	uint8_t* ReserveMemory(size_t size, bool useLargePages)
 	{
-		assert(handle >= 0 && handle < RefCountsLenSystemDecimal);
-		if (handle != 0)
+#if defined(_WIN32)
+		// MEM_RESERVE, PAGE_NOACCESS
+		(void)useLargePages;
+		return (uint8_t*)VirtualAlloc(nullptr, size, 0x2000, 0x01);
+#elif defined(__EMSCRIPTEN__)
+		// No virtual memory, so allocate it all
+		(void)useLargePages;
+		return (uint8_t*)calloc(size, 1);
+#else
+		// Reserve extra so the memory can be aligned to a large page, then
+		// give back what's not needed
+		size_t alignment = useLargePages ? LargePageSize : 0;
+		void* memory = mmap(
+			nullptr,
+			size + alignment,
+			PROT_NONE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+			-1,
+			0);
+		if (memory == MAP_FAILED)
 		{
-			RefCountsSystemDecimal[handle]++;
+			return nullptr;
 		}
+		if (!alignment)
+		{
+			return (uint8_t*)memory;
+		}
+		uint8_t* begin = (uint8_t*)memory;
+		uint8_t* aligned = AlignPointer(begin, alignment);
+		if (aligned != begin)
+		{
+			munmap(begin, aligned - begin);
+		}
+		munmap(aligned + size, begin + alignment - aligned);
+		return aligned;
+#endif
 	}
 	
-	void DereferenceManagedSystemDecimal(int32_t handle)
+	// Ask for reserved memory to be backed by large pages, which reduces TLB
+	// misses. This is only supported where memory isn't physically used
+	// until it's touched, so committing all of it costs nothing. Returns
+	// whether all of the memory was committed.
+	bool UseLargePages(uint8_t* memory, size_t size)
 	{
-		assert(handle >= 0 && handle < RefCountsLenSystemDecimal);
-		if (handle != 0)
+#if defined(MADV_HUGEPAGE) && !defined(__EMSCRIPTEN__)
+		if (mprotect(memory, size, PROT_READ | PROT_WRITE))
 		{
-			int32_t numRemain = --RefCountsSystemDecimal[handle];
-			if (numRemain == 0)
-			{
-				ReleaseSystemDecimal(handle);
-			}
+			return false;
 		}
+		madvise(memory, size, MADV_HUGEPAGE);
+		return true;
+#else
+		(void)memory;
+		(void)size;
+		return false;
+#endif
 	}
 	
-	// Free list for MyGame::BaseBallScript pointers
-	
-	int32_t BaseBallScriptFreeListSize;
-	MyGame::BaseBallScript** BaseBallScriptFreeList;
-	MyGame::BaseBallScript** NextFreeBaseBallScript;
-	
-	int32_t StoreBaseBallScript(MyGame::BaseBallScript* del)
+	// Commit reserved memory. It's cleared the first time it's committed.
+	bool CommitMemoryPages(uint8_t* begin, size_t size)
 	{
-		assert(NextFreeBaseBallScript != nullptr);
-		MyGame::BaseBallScript** pNext = NextFreeBaseBallScript;
-		NextFreeBaseBallScript = (MyGame::BaseBallScript**)*pNext;
-		*pNext = del;
-		return (int32_t)(pNext - BaseBallScriptFreeList);
+#if defined(_WIN32)
+		// MEM_COMMIT, PAGE_READWRITE
+		return VirtualAlloc(begin, size, 0x1000, 0x04) != nullptr;
+#elif defined(__EMSCRIPTEN__)
+		(void)begin;
+		(void)size;
+		return true;
+#else
+		return mprotect(begin, size, PROT_READ | PROT_WRITE) == 0;
+#endif
 	}
 	
-	MyGame::BaseBallScript* GetBaseBallScript(int32_t handle)
+	void ReleaseMemory(uint8_t* memory, size_t size)
 	{
-		assert(handle >= 0 && handle < BaseBallScriptFreeListSize);
-		return BaseBallScriptFreeList[handle];
+#if defined(_WIN32)
+		// MEM_RELEASE
+		(void)size;
+		VirtualFree(memory, 0, 0x8000);
+#elif defined(__EMSCRIPTEN__)
+		(void)size;
+		free(memory);
+#else
+		munmap(memory, size);
+#endif
 	}
 	
-	void RemoveBaseBallScript(int32_t handle)
+	bool CommitMemory(void* end)
 	{
-		MyGame::BaseBallScript** pRelease = BaseBallScriptFreeList + handle;
-		*pRelease = (MyGame::BaseBallScript*)NextFreeBaseBallScript;
-		NextFreeBaseBallScript = pRelease;
+		uint8_t* commitEnd = (uint8_t*)end;
+		if (commitEnd <= MemoryCommitEnd)
+		{
+			return true;
+		}
+		if (commitEnd > MemoryEnd)
+		{
+			return false;
+		}
+		size_t size = RoundUpToCommitGranularity(commitEnd - MemoryBegin);
+		if (size > (size_t)(MemoryEnd - MemoryBegin))
+		{
+			size = MemoryEnd - MemoryBegin;
+		}
+		if (!CommitMemoryPages(
+			MemoryCommitEnd,
+			MemoryBegin + size - MemoryCommitEnd))
+		{
+			return false;
+		}
+		MemoryCommitEnd = MemoryBegin + size;
+		return true;
 	}
 	
-	// Free list for whole MyGame::BaseBallScript objects
+	LinearAllocator* PersistentMemory;
+	LinearAllocator* FrameMemory;
 	
-	union BaseBallScriptFreeWholeListEntry
+	// State of the allocators for the memory passed to PluginMain. It's
+	// kept in plugin memory so it survives reloads.
+	struct MemoryAllocators
 	{
-		BaseBallScriptFreeWholeListEntry* Next;
-		MyGame::BaseBallScript Value;
+		LinearAllocator Persistent;
+		LinearAllocator Frames[2];
+		int32_t FrameIndex;
+		HeapAllocator Heap;
 	};
-	int32_t BaseBallScriptFreeWholeListSize;
-	BaseBallScriptFreeWholeListEntry* BaseBallScriptFreeWholeList;
-	BaseBallScriptFreeWholeListEntry* NextFreeWholeBaseBallScript;
+	MemoryAllocators* Allocators;
 	
-	MyGame::BaseBallScript* StoreWholeBaseBallScript()
+	void LinearAllocator::Init(void* begin, void* end)
 	{
-		assert(NextFreeWholeBaseBallScript != nullptr);
-		BaseBallScriptFreeWholeListEntry* pNext = NextFreeWholeBaseBallScript;
-		NextFreeWholeBaseBallScript = pNext->Next;
-		return &pNext->Value;
+		Begin = (uint8_t*)begin;
+		Cur = Begin;
+		End = (uint8_t*)end;
+		Peak = Begin;
+		
+		// Commit whole pages, even if some were committed by the memory
+		// before this range
+		CommitEnd = MemoryBegin + RoundDownToCommitGranularity(
+			Begin - MemoryBegin);
 	}
 	
-	void RemoveWholeBaseBallScript(MyGame::BaseBallScript* instance)
+	bool LinearAllocator::Commit(uint8_t* end)
 	{
-		BaseBallScriptFreeWholeListEntry* pRelease = (BaseBallScriptFreeWholeListEntry*)instance;
-		if (pRelease >= BaseBallScriptFreeWholeList && pRelease < BaseBallScriptFreeWholeList + (BaseBallScriptFreeWholeListSize - 1))
+		if (end > End)
 		{
-			pRelease->Next = NextFreeWholeBaseBallScript;
-			NextFreeWholeBaseBallScript = pRelease->Next;
+			return false;
 		}
-	}
-	/*END GLOBAL STATE AND FUNCTIONS*/
-}
-
-namespace Plugin
-{
-	// An unhandled exception caused by C++ calling into C#
-	System::Exception* unhandledCsharpException = nullptr;
-}
-
-////////////////////////////////////////////////////////////////
-// Mirrors of C# types. These wrap the C# functions to present
-// a similiar API as in C#.
-////////////////////////////////////////////////////////////////
-
-namespace System
-{
-	Object::Object()
-		: Plugin::ManagedType(nullptr)
-	{
+		uint8_t* commitEnd = MemoryBegin + RoundUpToCommitGranularity(
+			end - MemoryBegin);
+		if (commitEnd > End)
+		{
+			commitEnd = End;
+		}
+		if (!CommitMemoryPages(CommitEnd, commitEnd - CommitEnd))
+		{
+			return false;
+		}
+		CommitEnd = commitEnd;
+		return true;
 	}
 	
-	Object::Object(Plugin::InternalUse iu, int32_t handle)
-		: ManagedType(Plugin::InternalUse::Only, handle)
+	// Switch to the other frame memory and free everything in it
+	void SwapFrameMemory()
 	{
+		Allocators->FrameIndex = 1 - Allocators->FrameIndex;
+		FrameMemory = Allocators->Frames + Allocators->FrameIndex;
+		FrameMemory->Reset();
 	}
 	
-	Object::Object(decltype(nullptr))
-		: ManagedType(nullptr)
-	{
-	}
-
-	Object::~Object()
-	{
-	}
+	HeapAllocator* HeapMemory;
 	
-	bool Object::operator==(decltype(nullptr)) const
-	{
-		return Handle == 0;
-	}
+	// Minimum size of the pools HeapMemory allocates from PersistentMemory
+	const size_t HeapMemoryPoolSize = 1024 * 1024;
 	
-	bool Object::operator!=(decltype(nullptr)) const
-	{
-		return Handle != 0;
-	}
+	// Blocks are laid out back to back in a pool, which ends with a used
+	// block with no memory. The header is padded to the alignment so the
+	// memory after it is aligned.
+	const size_t HeapBlockHeaderSize = HeapAllocator::Alignment;
 	
-	void Object::ThrowReferenceToThis()
-	{
-		throw *this;
-	}
+	// Free blocks need room for the links to the other free blocks in their
+	// list
+	const size_t HeapMinBlockSize = HeapAllocator::Alignment;
 	
-	ValueType::ValueType(Plugin::InternalUse iu, int32_t handle)
-		: Object(iu, handle)
+	// Larger allocations would be mapped past the last first-level list
+	const size_t HeapMaxAllocationSize =
+		(size_t)1 << (HeapAllocator::FirstLevelMax - 1);
+	
+	struct HeapAllocator::Block
 	{
-	}
+		// Block before this one in the pool or null if this is the first
+		Block* PrevPhysical;
+		
+		// Number of bytes of memory after the header. The lowest bit is
+		// set if the block is free.
+		size_t SizeAndFlags;
+		
+		size_t GetSize()
+		{
+			return SizeAndFlags & ~(size_t)1;
+		}
+		
+		bool IsFree()
+		{
+			return (SizeAndFlags & 1) != 0;
+		}
+		
+		void SetSize(size_t size, bool isFree)
+		{
+			SizeAndFlags = size | (isFree ? 1 : 0);
+		}
+		
+		uint8_t* GetMemory()
+		{
+			return (uint8_t*)this + HeapBlockHeaderSize;
+		}
+		
+		Block* GetNextPhysical()
+		{
+			return (Block*)(GetMemory() + GetSize());
+		}
+		
+		// Links in the free list. Only valid when the block is free.
+		Block*& NextFree()
+		{
+			return ((Block**)GetMemory())[0];
+		}
+		
+		Block*& PrevFree()
+		{
+			return ((Block**)GetMemory())[1];
+		}
+		
+		static Block* FromMemory(void* ptr)
+		{
+			return (Block*)((uint8_t*)ptr - HeapBlockHeaderSize);
+		}
+	};
 	
-	ValueType::ValueType(decltype(nullptr))
-		: Object(nullptr)
+	static_assert(
+		sizeof(HeapAllocator::Block) <= HeapBlockHeaderSize,
+		"Heap block header is too large");
+	static_assert(
+		2 * sizeof(HeapAllocator::Block*) <= HeapMinBlockSize,
+		"Heap blocks are too small for free list links");
+	
+	// Index of the lowest set bit. The value must not be zero.
+	int32_t FindFirstSetBit(uint32_t value)
 	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, value);
+		return (int32_t)index;
+#else
+		return __builtin_ctz(value);
+#endif
 	}
 	
-	Enum::Enum(Plugin::InternalUse iu, int32_t handle)
-		: ValueType(iu, handle)
+	// Index of the highest set bit. The value must not be zero.
+	int32_t FindLastSetBit(uint32_t value)
 	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, value);
+		return (int32_t)index;
+#else
+		return 31 - __builtin_clz(value);
+#endif
 	}
 	
-	Enum::Enum(decltype(nullptr))
-		: ValueType(nullptr)
+	// Get the free list that blocks of the given size are kept in
+	void MapHeapBlockSize(
+		size_t size,
+		int32_t& firstLevel,
+		int32_t& secondLevel)
 	{
+		if (size < HeapAllocator::SmallBlockSize)
+		{
+			firstLevel = 0;
+			secondLevel = (int32_t)(size / (HeapAllocator::SmallBlockSize
+				/ HeapAllocator::SecondLevelCount));
+		}
+		else
+		{
+			int32_t lastBit = FindLastSetBit((uint32_t)size);
+			secondLevel = (int32_t)(size >> (lastBit
+				- HeapAllocator::SecondLevelCountLog2))
+				^ HeapAllocator::SecondLevelCount;
+			firstLevel = lastBit - (HeapAllocator::FirstLevelShift - 1);
+		}
 	}
 	
-	String::String(decltype(nullptr))
-		: Object(Plugin::InternalUse::Only, 0)
+	void InsertFreeHeapBlock(
+		HeapAllocator& heap,
+		HeapAllocator::Block* block)
 	{
+		int32_t firstLevel;
+		int32_t secondLevel;
+		MapHeapBlockSize(block->GetSize(), firstLevel, secondLevel);
+		HeapAllocator::Block*& head = heap.FreeLists[firstLevel][secondLevel];
+		block->NextFree() = head;
+		block->PrevFree() = nullptr;
+		if (head)
+		{
+			head->PrevFree() = block;
+		}
+		head = block;
+		heap.FirstLevelBitmap |= 1u << firstLevel;
+		heap.SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
 	}
 	
-	String::String(Plugin::InternalUse iu, int32_t handle)
-		: Object(iu, handle)
+	void RemoveFreeHeapBlock(
+		HeapAllocator& heap,
+		HeapAllocator::Block* block)
 	{
-		if (handle)
+		int32_t firstLevel;
+		int32_t secondLevel;
+		MapHeapBlockSize(block->GetSize(), firstLevel, secondLevel);
+		HeapAllocator::Block* next = block->NextFree();
+		HeapAllocator::Block* prev = block->PrevFree();
+		if (next)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			next->PrevFree() = prev;
+		}
+		if (prev)
+		{
+			prev->NextFree() = next;
+		}
+		else
+		{
+			heap.FreeLists[firstLevel][secondLevel] = next;
+			if (!next)
+			{
+				heap.SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+				if (!heap.SecondLevelBitmaps[firstLevel])
+				{
+					heap.FirstLevelBitmap &= ~(1u << firstLevel);
+				}
+			}
 		}
 	}
 	
-	String::String(const String& other)
-		: Object(Plugin::InternalUse::Only, other.Handle)
+	// Remove and return a free block of at least the given size or return
+	// null if there isn't one
+	HeapAllocator::Block* TakeFreeHeapBlock(
+		HeapAllocator& heap,
+		size_t size)
 	{
-		if (Handle)
+		// Round up to the next list so any block in it is big enough
+		if (size >= HeapAllocator::SmallBlockSize)
 		{
-			Plugin::ReferenceManagedClass(Handle);
+			size += ((size_t)1 << (FindLastSetBit((uint32_t)size)
+				- HeapAllocator::SecondLevelCountLog2)) - 1;
+		}
+		int32_t firstLevel;
+		int32_t secondLevel;
+		MapHeapBlockSize(size, firstLevel, secondLevel);
+		
+		// Search this first-level list, then the larger ones
+		uint32_t secondLevelMap = heap.SecondLevelBitmaps[firstLevel]
+			& (~0u << secondLevel);
+		if (!secondLevelMap)
+		{
+			uint32_t firstLevelMap = heap.FirstLevelBitmap
+				& (~0u << (firstLevel + 1));
+			if (!firstLevelMap)
+			{
+				return nullptr;
+			}
+			firstLevel = FindFirstSetBit(firstLevelMap);
+			secondLevelMap = heap.SecondLevelBitmaps[firstLevel];
 		}
+		secondLevel = FindFirstSetBit(secondLevelMap);
+		HeapAllocator::Block* block = heap.FreeLists[firstLevel][secondLevel];
+		RemoveFreeHeapBlock(heap, block);
+		return block;
 	}
 	
-	String::String(String&& other)
-		: Object(Plugin::InternalUse::Only, other.Handle)
+	void HeapAllocator::Init(LinearAllocator* source, size_t poolSize)
 	{
-		other.Handle = 0;
+		Source = source;
+		PoolSize = poolSize;
+		FirstLevelBitmap = 0;
+		memset(SecondLevelBitmaps, 0, sizeof(SecondLevelBitmaps));
+		memset(FreeLists, 0, sizeof(FreeLists));
+		PoolsSize = 0;
+		UsedSize = 0;
+		PeakUsedSize = 0;
 	}
 	
-	String::~String()
+	void HeapAllocator::AddPool(void* memory, size_t size)
 	{
-		if (Handle)
+		uint8_t* begin = AlignPointer((uint8_t*)memory, Alignment);
+		size_t padding = begin - (uint8_t*)memory;
+		if (size < padding + 2 * HeapBlockHeaderSize + HeapMinBlockSize)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			return;
 		}
-	}
-	
-	String& String::operator=(const String& other)
+		size_t blockSize = (size - padding - 2 * HeapBlockHeaderSize)
+			& ~(Alignment - 1);
+		assert(blockSize < ((size_t)1 << FirstLevelMax));
+		
+		Block* block = (Block*)begin;
+		block->PrevPhysical = nullptr;
+		block->SetSize(blockSize, true);
+		
+		Block* end = block->GetNextPhysical();
+		end->PrevPhysical = block;
+		end->SetSize(0, false);
+		
+		InsertFreeHeapBlock(*this, block);
+		PoolsSize += size;
+	}
+	
+	void* HeapAllocator::Allocate(size_t size)
 	{
-		if (Handle != other.Handle)
+		if (size > HeapMaxAllocationSize)
 		{
-			if (Handle)
+			return nullptr;
+		}
+		size_t blockSize = (size + Alignment - 1) & ~(Alignment - 1);
+		if (blockSize < HeapMinBlockSize)
+		{
+			blockSize = HeapMinBlockSize;
+		}
+		
+		// Add a pool if no free block is big enough
+		Block* block = TakeFreeHeapBlock(*this, blockSize);
+		if (!block)
+		{
+			size_t poolSize = blockSize + (blockSize >> SecondLevelCountLog2)
+				+ 2 * HeapBlockHeaderSize;
+			if (poolSize < PoolSize)
 			{
-				Plugin::DereferenceManagedClass(Handle);
+				poolSize = PoolSize;
 			}
-			Handle = other.Handle;
-			if (Handle)
+			void* pool = Source->Allocate(poolSize, Alignment);
+			if (!pool)
 			{
-				Plugin::ReferenceManagedClass(Handle);
+				return nullptr;
+			}
+			AddPool(pool, poolSize);
+			block = TakeFreeHeapBlock(*this, blockSize);
+			if (!block)
+			{
+				return nullptr;
 			}
 		}
-		return *this;
-	}
-	
-	String& String::operator=(decltype(nullptr))
-	{
-		if (Handle)
+		
+		// Return the rest of the block to a free list
+		size_t remainingSize = block->GetSize() - blockSize;
+		if (remainingSize >= HeapBlockHeaderSize + HeapMinBlockSize)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Block* rest = (Block*)(block->GetMemory() + blockSize);
+			rest->PrevPhysical = block;
+			rest->SetSize(remainingSize - HeapBlockHeaderSize, true);
+			rest->GetNextPhysical()->PrevPhysical = rest;
+			InsertFreeHeapBlock(*this, rest);
+			block->SetSize(blockSize, false);
 		}
-		return *this;
-	}
-	
-	String& String::operator=(String&& other)
-	{
-		if (Handle)
+		else
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			block->SetSize(block->GetSize(), false);
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
+		
+		UsedSize += block->GetSize();
+		if (UsedSize > PeakUsedSize)
+		{
+			PeakUsedSize = UsedSize;
+		}
+		return block->GetMemory();
 	}
 	
-	String::String(const char* chars)
-		: Object(Plugin::InternalUse::Only, Plugin::StringNew(chars))
+	void HeapAllocator::Free(void* ptr)
 	{
-		Plugin::ReferenceManagedClass(Handle);
+		if (!ptr)
+		{
+			return;
+		}
+		Block* block = Block::FromMemory(ptr);
+		size_t size = block->GetSize();
+		UsedSize -= size;
+		
+		// Merge with the free blocks before and after
+		Block* prev = block->PrevPhysical;
+		if (prev && prev->IsFree())
+		{
+			RemoveFreeHeapBlock(*this, prev);
+			size += HeapBlockHeaderSize + prev->GetSize();
+			block = prev;
+		}
+		Block* next = (Block*)(block->GetMemory() + size);
+		if (next->IsFree())
+		{
+			RemoveFreeHeapBlock(*this, next);
+			size += HeapBlockHeaderSize + next->GetSize();
+		}
+		block->SetSize(size, true);
+		block->GetNextPhysical()->PrevPhysical = block;
+		InsertFreeHeapBlock(*this, block);
 	}
 	
-	ICloneable::ICloneable(Plugin::InternalUse iu, int32_t handle)
-		: Object(iu, handle)
+	size_t HeapAllocator::GetSize(void* ptr)
 	{
+		return Block::FromMemory(ptr)->GetSize();
 	}
 	
-	ICloneable::ICloneable(decltype(nullptr))
-		: Object(nullptr)
-	{
-	}
+	// Maximum number of chunks in a ChunkedFreeList
+	const int32_t MaxFreeListChunks = 64;
 	
-	namespace Collections
+	// A free list of values stored in chunks. The first chunk is in the
+	// memory Init sets aside and more are allocated from PersistentMemory
+	// as they're needed. Values never move, so their addresses and handles
+	// never change. Handles are indexes and zero is never used since it
+	// means null. The state is kept in plugin memory so it survives
+	// reloads.
+	template <typename TValue> struct ChunkedFreeList
 	{
-		IEnumerable::IEnumerable(Plugin::InternalUse iu, int32_t handle)
-			: Object(iu, handle)
+		union Entry
+		{
+			Entry* Next;
+			TValue Value;
+		};
+		
+		// Number of entries in each chunk, as a power of two
+		int32_t ChunkSizeLog2;
+		
+		int32_t NumChunks;
+		Entry* NextFree;
+		Entry* Chunks[MaxFreeListChunks];
+		
+		// Number of entries in use now and at most
+		int32_t NumUsed;
+		int32_t PeakUsed;
+		
+		static int32_t GetChunkSizeLog2(int32_t minChunkSize)
 		{
+			int32_t chunkSizeLog2 = 0;
+			while ((1 << chunkSizeLog2) < minChunkSize)
+			{
+				chunkSizeLog2++;
+			}
+			return chunkSizeLog2;
 		}
 		
-		IEnumerable::IEnumerable(decltype(nullptr))
-			: Object(nullptr)
+		static Entry* GetFirstChunk(ChunkedFreeList* list)
 		{
+			return (Entry*)AlignPointer((uint8_t*)(list + 1), CacheLineSize);
 		}
 		
-		IEnumerator IEnumerable::GetEnumerator()
+		// Set aside memory for the state and the first chunk during Init
+		static ChunkedFreeList* Place(
+			uint8_t*& curMemory,
+			int32_t minChunkSize)
+		{
+			ChunkedFreeList* list = (ChunkedFreeList*)AlignPointer(
+				curMemory,
+				CacheLineSize);
+			curMemory = (uint8_t*)(GetFirstChunk(list)
+				+ ((size_t)1 << GetChunkSizeLog2(minChunkSize)));
+			return list;
+		}
+		
+		// Link the entries of the first chunk on first boot
+		void Init(int32_t minChunkSize)
 		{
-			return IEnumerator(
-				Plugin::InternalUse::Only,
-				Plugin::EnumerableGetEnumerator(Handle));
+			ChunkSizeLog2 = GetChunkSizeLog2(minChunkSize);
+			NumChunks = 0;
+			NextFree = nullptr;
+			NumUsed = 0;
+			PeakUsed = 0;
+			AddChunk(GetFirstChunk(this));
+			NextFree = NextFree->Next;
 		}
 		
-		Plugin::EnumerableIterator begin(
-			System::Collections::IEnumerable& enumerable)
+		void AddChunk(Entry* chunk)
 		{
-			return Plugin::EnumerableIterator(enumerable);
+			int32_t chunkSize = 1 << ChunkSizeLog2;
+			for (int32_t i = 0; i < chunkSize - 1; ++i)
+			{
+				chunk[i].Next = chunk + i + 1;
+			}
+			chunk[chunkSize - 1].Next = NextFree;
+			NextFree = chunk;
+			Chunks[NumChunks] = chunk;
+			NumChunks++;
 		}
 		
-		Plugin::EnumerableIterator end(
-			System::Collections::IEnumerable& enumerable)
+		// Get memory for a value or null if there's no more room
+		TValue* Allocate()
 		{
-			return Plugin::EnumerableIterator(nullptr);
+			if (!NextFree)
+			{
+				if (NumChunks == MaxFreeListChunks)
+				{
+					return nullptr;
+				}
+				Entry* chunk = (Entry*)PersistentMemory->Allocate(
+					sizeof(Entry) << ChunkSizeLog2,
+					CacheLineSize);
+				if (!chunk)
+				{
+					return nullptr;
+				}
+				AddChunk(chunk);
+			}
+			Entry* entry = NextFree;
+			NextFree = entry->Next;
+			NumUsed++;
+			if (NumUsed > PeakUsed)
+			{
+				PeakUsed = NumUsed;
+			}
+			return &entry->Value;
 		}
 		
-		ICollection::ICollection(Plugin::InternalUse iu, int32_t handle)
-			: Object(iu, handle)
-			, IEnumerable(nullptr)
+		// Get the handle of the value at an address or -1 if it's not in
+		// the list. The address may be anywhere in the value, such as at a
+		// base class.
+		int32_t GetHandle(const void* address)
+		{
+			size_t chunkBytes = sizeof(Entry) << ChunkSizeLog2;
+			for (int32_t i = 0; i < NumChunks; ++i)
+			{
+				size_t offset = (uintptr_t)address - (uintptr_t)Chunks[i];
+				if (offset < chunkBytes)
+				{
+					return (i << ChunkSizeLog2)
+						+ (int32_t)(offset / sizeof(Entry));
+				}
+			}
+			return -1;
+		}
+		
+		TValue* Get(int32_t handle)
 		{
+			Entry* chunk = Chunks[handle >> ChunkSizeLog2];
+			return &chunk[handle & ((1 << ChunkSizeLog2) - 1)].Value;
 		}
 		
-		ICollection::ICollection(decltype(nullptr))
-			: Object(nullptr)
-			, IEnumerable(nullptr)
+		void Free(int32_t handle)
 		{
+			Entry* entry = (Entry*)Get(handle);
+			entry->Next = NextFree;
+			NextFree = entry;
+			NumUsed--;
 		}
 		
-		IList::IList(Plugin::InternalUse iu, int32_t handle)
-			: Object(iu, handle)
-			, IEnumerable(nullptr)
-			, ICollection(nullptr)
+		// Get the number of entries that can be used without adding a
+		// chunk. The first entry is never used.
+		int32_t GetCapacity()
 		{
+			return (NumChunks << ChunkSizeLog2) - 1;
 		}
 		
-		IList::IList(decltype(nullptr))
-			: Object(nullptr)
-			, IEnumerable(nullptr)
-			, ICollection(nullptr)
+		// Get the number of bytes in the state and the chunks
+		size_t GetSize()
 		{
+			return (uint8_t*)GetFirstChunk(this) - (uint8_t*)this
+				+ ((size_t)NumChunks * sizeof(Entry) << ChunkSizeLog2);
 		}
-	}
+	};
+}
+
+////////////////////////////////////////////////////////////////
+// Maps keyed by managed object handles
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	uint32_t* HandleGenerations;
+	IntrusiveList<HandleMapBase>* HandleMaps;
 	
-	Array::Array(Plugin::InternalUse iu, int32_t handle)
-		: Object(iu, handle)
-		, ICloneable(nullptr)
-		, Collections::IEnumerable(nullptr)
-		, Collections::ICollection(nullptr)
-		, Collections::IList(nullptr)
+	// What every HandleMap entry starts with
+	struct HandleMapEntryHeader
 	{
-	}
+		int32_t Handle;
+		uint32_t Generation;
+	};
 	
-	Array::Array(decltype(nullptr))
-		: Object(nullptr)
-		, ICloneable(nullptr)
-		, Collections::IEnumerable(nullptr)
-		, Collections::ICollection(nullptr)
-		, Collections::IList(nullptr)
+	static uint32_t HashHandle(int32_t handle)
 	{
+		return MixHash((uint32_t)handle);
 	}
 	
-	int32_t Array::GetLength()
+	static HandleMapEntryHeader* GetHandleMapEntry(
+		uint8_t* entries,
+		int32_t entrySize,
+		uint32_t index)
 	{
-		return Plugin::ArrayGetLength(Handle);
+		return (HandleMapEntryHeader*)(entries + (size_t)index * entrySize);
 	}
 	
-	int32_t Array::GetRank()
+	HandleMapBase::HandleMapBase(int32_t entrySize)
+		: EntrySize(entrySize)
+		, Count(0)
+		, Capacity(0)
 	{
-		return 0;
+		HandleMaps->PushBack(this);
 	}
-}
-
-/*BEGIN METHOD DEFINITIONS*/
-namespace System
-{
-	IFormattable::IFormattable(decltype(nullptr))
+	
+	HandleMapBase::~HandleMapBase()
 	{
+		FreeEntries();
+		HandleMaps->Remove(this);
 	}
 	
-	IFormattable::IFormattable(Plugin::InternalUse, int32_t handle)
+	void* HandleMapBase::FindEntry(int32_t handle)
 	{
-		Handle = handle;
-		if (handle)
+		if (!Count || !handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			return nullptr;
+		}
+		uint8_t* entries = Entries.Get();
+		uint32_t mask = (uint32_t)Capacity - 1;
+		for (uint32_t i = HashHandle(handle) & mask; ; i = (i + 1) & mask)
+		{
+			HandleMapEntryHeader* entry = GetHandleMapEntry(
+				entries,
+				EntrySize,
+				i);
+			if (!entry->Handle)
+			{
+				return nullptr;
+			}
+			if (entry->Handle == handle)
+			{
+				// Left over from an earlier object with this handle whose
+				// release this map didn't see
+				if (entry->Generation != HandleGenerations[handle])
+				{
+					RemoveEntry(handle);
+					return nullptr;
+				}
+				return entry;
+			}
 		}
 	}
 	
-	IFormattable::IFormattable(const IFormattable& other)
-		: IFormattable(Plugin::InternalUse::Only, other.Handle)
-	{
-	}
-	
-	IFormattable::IFormattable(IFormattable&& other)
-		: IFormattable(Plugin::InternalUse::Only, other.Handle)
-	{
-		other.Handle = 0;
-	}
-	
-	IFormattable::~IFormattable()
+	void* HandleMapBase::AddEntry(int32_t handle, bool& added)
 	{
-		if (Handle)
+		added = false;
+		if (!handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			return nullptr;
+		}
+		
+		// Keep the load factor at most 3/4
+		if ((Count + 1) * 4 > Capacity * 3
+			&& !Rehash(Capacity ? Capacity * 2 : 16))
+		{
+			return nullptr;
+		}
+		uint8_t* entries = Entries.Get();
+		uint32_t mask = (uint32_t)Capacity - 1;
+		uint32_t generation = HandleGenerations[handle];
+		for (uint32_t i = HashHandle(handle) & mask; ; i = (i + 1) & mask)
+		{
+			HandleMapEntryHeader* entry = GetHandleMapEntry(
+				entries,
+				EntrySize,
+				i);
+			if (entry->Handle == handle)
+			{
+				if (entry->Generation != generation)
+				{
+					memset(entry, 0, EntrySize);
+					entry->Handle = handle;
+					entry->Generation = generation;
+					added = true;
+				}
+				return entry;
+			}
+			if (!entry->Handle)
+			{
+				entry->Handle = handle;
+				entry->Generation = generation;
+				Count++;
+				added = true;
+				return entry;
+			}
 		}
 	}
 	
-	IFormattable& IFormattable::operator=(const IFormattable& other)
+	bool HandleMapBase::RemoveEntry(int32_t handle)
 	{
-		if (this->Handle)
+		if (!Count || !handle)
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			return false;
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		uint8_t* entries = Entries.Get();
+		uint32_t mask = (uint32_t)Capacity - 1;
+		uint32_t i = HashHandle(handle) & mask;
+		for (; ; i = (i + 1) & mask)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			int32_t entryHandle = GetHandleMapEntry(
+				entries,
+				EntrySize,
+				i)->Handle;
+			if (!entryHandle)
+			{
+				return false;
+			}
+			if (entryHandle == handle)
+			{
+				break;
+			}
 		}
-		return *this;
+		
+		// Move later entries in the probe sequence back into the hole
+		for (uint32_t j = (i + 1) & mask; ; j = (j + 1) & mask)
+		{
+			HandleMapEntryHeader* entry = GetHandleMapEntry(
+				entries,
+				EntrySize,
+				j);
+			if (!entry->Handle)
+			{
+				break;
+			}
+			uint32_t home = HashHandle(entry->Handle) & mask;
+			if (((j - home) & mask) >= ((j - i) & mask))
+			{
+				memcpy(
+					GetHandleMapEntry(entries, EntrySize, i),
+					entry,
+					EntrySize);
+				i = j;
+			}
+		}
+		memset(GetHandleMapEntry(entries, EntrySize, i), 0, EntrySize);
+		Count--;
+		return true;
 	}
 	
-	IFormattable& IFormattable::operator=(decltype(nullptr))
+	bool HandleMapBase::Rehash(int32_t capacity)
 	{
-		if (Handle)
+		size_t size = (size_t)capacity * EntrySize;
+		uint8_t* entries = (uint8_t*)HeapMemory->Allocate(size);
+		if (!entries)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			return false;
 		}
-		return *this;
-	}
-	
-	IFormattable& IFormattable::operator=(IFormattable&& other)
-	{
-		if (Handle)
+		memset(entries, 0, size);
+		uint8_t* oldEntries = Entries.Get();
+		uint32_t mask = (uint32_t)capacity - 1;
+		for (int32_t i = 0; i < Capacity; ++i)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			HandleMapEntryHeader* entry = GetHandleMapEntry(
+				oldEntries,
+				EntrySize,
+				i);
+			if (entry->Handle)
+			{
+				uint32_t j = HashHandle(entry->Handle) & mask;
+				while (GetHandleMapEntry(entries, EntrySize, j)->Handle)
+				{
+					j = (j + 1) & mask;
+				}
+				memcpy(
+					GetHandleMapEntry(entries, EntrySize, j),
+					entry,
+					EntrySize);
+			}
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
+		HeapMemory->Free(oldEntries);
+		Entries = entries;
+		Capacity = capacity;
+		return true;
 	}
 	
-	bool IFormattable::operator==(const IFormattable& other) const
+	void HandleMapBase::FreeEntries()
 	{
-		return Handle == other.Handle;
+		HeapMemory->Free(Entries.Get());
+		Entries = nullptr;
+		Count = 0;
+		Capacity = 0;
 	}
 	
-	bool IFormattable::operator!=(const IFormattable& other) const
+	void ReleaseHandle(int32_t handle)
 	{
-		return Handle != other.Handle;
+		HandleGenerations[handle]++;
+		for (HandleMapBase& map : *HandleMaps)
+		{
+			if (map.Count)
+			{
+				map.RemoveEntry(handle);
+			}
+		}
 	}
 }
 
-namespace System
+////////////////////////////////////////////////////////////////
+// Objects destroyed on the C# side
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
 {
-	IConvertible::IConvertible(decltype(nullptr))
+	// One bit per handle. C# sets it when the object is destroyed or its
+	// handle is released and clears it when the handle is reused.
+	uint32_t* DestroyedObjects;
+	
+	bool IsDestroyed(int32_t handle)
 	{
+		return (DestroyedObjects[handle >> 5] >> (handle & 31)) & 1;
 	}
-	
-	IConvertible::IConvertible(Plugin::InternalUse, int32_t handle)
+}
+
+////////////////////////////////////////////////////////////////
+// Reference counting of managed objects
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	int32_t RefCountsLenClass;
+	int32_t* RefCountsClass;
+
+	void ReferenceManagedClass(int32_t handle)
 	{
-		Handle = handle;
-		if (handle)
+		assert(handle >= 0 && handle < RefCountsLenClass);
+		if (handle != 0)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			RefCountsClass[handle]++;
 		}
 	}
-	
-	IConvertible::IConvertible(const IConvertible& other)
-		: IConvertible(Plugin::InternalUse::Only, other.Handle)
-	{
-	}
-	
-	IConvertible::IConvertible(IConvertible&& other)
-		: IConvertible(Plugin::InternalUse::Only, other.Handle)
+
+	void DereferenceManagedClass(int32_t handle)
 	{
-		other.Handle = 0;
+		assert(handle >= 0 && handle < RefCountsLenClass);
+		if (handle != 0)
+		{
+			int32_t numRemain = --RefCountsClass[handle];
+			if (numRemain == 0)
+			{
+				ReleaseHandle(handle);
+				ReleaseObject(handle);
+			}
+		}
 	}
 	
-	IConvertible::~IConvertible()
+	bool DereferenceManagedClassNoRelease(int32_t handle)
 	{
-		if (Handle)
+		assert(handle >= 0 && handle < RefCountsLenClass);
+		if (handle != 0)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			int32_t numRemain = --RefCountsClass[handle];
+			if (numRemain == 0)
+			{
+				ReleaseHandle(handle);
+				return true;
+			}
 		}
+		return false;
 	}
 	
-	IConvertible& IConvertible::operator=(const IConvertible& other)
+	/*BEGIN GLOBAL STATE AND FUNCTIONS*/
+	int32_t RefCountsLenSystemDecimal;
+	int32_t* RefCountsSystemDecimal;
+	
+	void ReferenceManagedSystemDecimal(int32_t handle)
 	{
-		if (this->Handle)
-		{
-			Plugin::DereferenceManagedClass(this->Handle);
-		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		assert(handle >= 0 && handle < RefCountsLenSystemDecimal);
+		if (handle != 0)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			RefCountsSystemDecimal[handle]++;
 		}
-		return *this;
 	}
 	
-	IConvertible& IConvertible::operator=(decltype(nullptr))
+	void DereferenceManagedSystemDecimal(int32_t handle)
 	{
-		if (Handle)
+		assert(handle >= 0 && handle < RefCountsLenSystemDecimal);
+		if (handle != 0)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			int32_t numRemain = --RefCountsSystemDecimal[handle];
+			if (numRemain == 0)
+			{
+				ReleaseSystemDecimal(handle);
+			}
 		}
-		return *this;
 	}
 	
-	IConvertible& IConvertible::operator=(IConvertible&& other)
+	int32_t RefCountsLenUnityEngineRaycastHit;
+	int32_t* RefCountsUnityEngineRaycastHit;
+	
+	void ReferenceManagedUnityEngineRaycastHit(int32_t handle)
 	{
-		if (Handle)
+		assert(handle >= 0 && handle < RefCountsLenUnityEngineRaycastHit);
+		if (handle != 0)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			RefCountsUnityEngineRaycastHit[handle]++;
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
 	}
 	
-	bool IConvertible::operator==(const IConvertible& other) const
+	void DereferenceManagedUnityEngineRaycastHit(int32_t handle)
 	{
-		return Handle == other.Handle;
+		assert(handle >= 0 && handle < RefCountsLenUnityEngineRaycastHit);
+		if (handle != 0)
+		{
+			int32_t numRemain = --RefCountsUnityEngineRaycastHit[handle];
+			if (numRemain == 0)
+			{
+				ReleaseUnityEngineRaycastHit(handle);
+			}
+		}
 	}
 	
-	bool IConvertible::operator!=(const IConvertible& other) const
-	{
-		return Handle != other.Handle;
-	}
-}
-
-namespace System
-{
-	IComparable::IComparable(decltype(nullptr))
+	// Free list for MyGame::BaseBallScript pointers
+	
+	ChunkedFreeList<MyGame::BaseBallScript*>* BaseBallScriptFreeList;
+	
+	int32_t StoreBaseBallScript(MyGame::BaseBallScript* del)
 	{
+		MyGame::BaseBallScript** pNext = BaseBallScriptFreeList->Allocate();
+		assert(pNext != nullptr);
+		*pNext = del;
+		return BaseBallScriptFreeList->GetHandle(pNext);
 	}
 	
-	IComparable::IComparable(Plugin::InternalUse, int32_t handle)
+	MyGame::BaseBallScript* GetBaseBallScript(int32_t handle)
 	{
-		Handle = handle;
-		if (handle)
-		{
-			Plugin::ReferenceManagedClass(handle);
-		}
+		return *BaseBallScriptFreeList->Get(handle);
 	}
 	
-	IComparable::IComparable(const IComparable& other)
-		: IComparable(Plugin::InternalUse::Only, other.Handle)
+	void RemoveBaseBallScript(int32_t handle)
 	{
+		BaseBallScriptFreeList->Free(handle);
 	}
 	
-	IComparable::IComparable(IComparable&& other)
-		: IComparable(Plugin::InternalUse::Only, other.Handle)
+	// Free list for whole MyGame::BallScript objects
+	
+	ChunkedFreeList<MyGame::BallScript>* BaseBallScriptFreeWholeList;
+	
+	MyGame::BallScript* StoreWholeBaseBallScript()
 	{
-		other.Handle = 0;
+		MyGame::BallScript* pNext = BaseBallScriptFreeWholeList->Allocate();
+		return pNext;
 	}
 	
-	IComparable::~IComparable()
+	void RemoveWholeBaseBallScript(MyGame::BaseBallScript* instance)
 	{
-		if (Handle)
+		int32_t handle = BaseBallScriptFreeWholeList->GetHandle(instance);
+		if (handle >= 0)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			BaseBallScriptFreeWholeList->Free(handle);
 		}
 	}
 	
-	IComparable& IComparable::operator=(const IComparable& other)
+	// Hot fields of MyGame::BaseBallScript objects
+	
+	SoaTable<MyGame::BaseBallScript*, float>* BaseBallScriptHotFields;
+	
+	void AddBaseBallScriptHotFields(MyGame::BaseBallScript* instance)
 	{
-		if (this->Handle)
+		int32_t row = BaseBallScriptHotFields->Length;
+		if (BaseBallScriptHotFields->PushBack(instance, instance->DirFallback))
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			instance->HotFieldsRow = row;
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+	}
+	
+	void RemoveBaseBallScriptHotFields(MyGame::BaseBallScript* instance)
+	{
+		int32_t row = instance->HotFieldsRow;
+		if (row >= 0)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			BaseBallScriptHotFields->RemoveAtSwapBack(row);
+			if (row < BaseBallScriptHotFields->Length)
+			{
+				BaseBallScriptHotFields->GetColumn<0>()[row]->HotFieldsRow = row;
+			}
+			instance->HotFieldsRow = -1;
 		}
-		return *this;
 	}
 	
-	IComparable& IComparable::operator=(decltype(nullptr))
+	// MyGame::BaseBallScript objects by the instance ID of their GameObject
+	
+	HashMap<int32_t, MyGame::BaseBallScript*>* BaseBallScriptsByGameObject;
+	
+	void AddBaseBallScriptGameObject(MyGame::BaseBallScript* instance, int32_t gameObjectInstanceId)
 	{
-		if (Handle)
+		MyGame::BaseBallScript** registered = BaseBallScriptsByGameObject->GetOrAdd(gameObjectInstanceId);
+		if (registered)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			*registered = instance;
+			instance->GameObjectInstanceId = gameObjectInstanceId;
 		}
-		return *this;
 	}
 	
-	IComparable& IComparable::operator=(IComparable&& other)
+	void RemoveBaseBallScriptGameObject(MyGame::BaseBallScript* instance)
 	{
-		if (Handle)
+		int32_t id = instance->GameObjectInstanceId;
+		if (id)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			MyGame::BaseBallScript** registered = BaseBallScriptsByGameObject->Find(id);
+			if (registered && *registered == instance)
+			{
+				BaseBallScriptsByGameObject->Remove(id);
+			}
+			instance->GameObjectInstanceId = 0;
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
 	}
 	
-	bool IComparable::operator==(const IComparable& other) const
+	/*END GLOBAL STATE AND FUNCTIONS*/
+}
+
+////////////////////////////////////////////////////////////////
+// Plugin memory usage
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// Usages written by GetMemoryUsage
+	struct MemoryUsageReport
 	{
-		return Handle == other.Handle;
-	}
+		MemoryUsage* Usages;
+		int32_t MaxUsages;
+		int32_t NumUsages;
+		
+		void Add(
+			const char* name,
+			const void* begin,
+			size_t size,
+			size_t used,
+			size_t peak,
+			size_t capacity)
+		{
+			if (NumUsages < MaxUsages)
+			{
+				MemoryUsage& usage = Usages[NumUsages];
+				usage.Name = name;
+				usage.Offset = begin
+					? (int32_t)((const uint8_t*)begin - MemoryBegin)
+					: -1;
+				usage.Size = (int32_t)size;
+				usage.Used = (int32_t)used;
+				usage.Peak = (int32_t)peak;
+				usage.Capacity = (int32_t)capacity;
+			}
+			NumUsages++;
+		}
+		
+		// Handle 0 is null, so its count holds the peak number of handles
+		void AddRefCounts(
+			const char* name,
+			int32_t* refCounts,
+			int32_t length)
+		{
+			int32_t used = 0;
+			for (int32_t i = 1; i < length; ++i)
+			{
+				if (refCounts[i])
+				{
+					used++;
+				}
+			}
+			if (used > refCounts[0])
+			{
+				refCounts[0] = used;
+			}
+			Add(
+				name,
+				refCounts,
+				length * sizeof(int32_t),
+				used,
+				refCounts[0],
+				length - 1);
+		}
+		
+		// The extra chunks are in PersistentMemory, so only the state and
+		// the first chunk are counted in the size
+		template <typename TValue> void AddFreeList(
+			const char* name,
+			ChunkedFreeList<TValue>* list)
+		{
+			Add(
+				name,
+				list,
+				list->GetSize(),
+				list->NumUsed,
+				list->PeakUsed,
+				list->GetCapacity());
+		}
+		
+		void AddLinearAllocator(
+			const char* name,
+			LinearAllocator& allocator)
+		{
+			allocator.UpdatePeak();
+			size_t size = allocator.End - allocator.Begin;
+			Add(
+				name,
+				allocator.Begin,
+				size,
+				allocator.Cur - allocator.Begin,
+				allocator.Peak - allocator.Begin,
+				size);
+		}
+	};
 	
-	bool IComparable::operator!=(const IComparable& other) const
+	int32_t GetMemoryUsage(MemoryUsage* usages, int32_t maxUsages)
 	{
-		return Handle != other.Handle;
+		MemoryUsageReport report = { usages, maxUsages, 0 };
+		
+		// Init parameters and the ref counts right after them
+		uint8_t* refCounts = (uint8_t*)RefCountsClass;
+		report.Add(
+			"Parameters",
+			MemoryBegin,
+			refCounts - MemoryBegin,
+			refCounts - MemoryBegin,
+			refCounts - MemoryBegin,
+			refCounts - MemoryBegin);
+		report.AddRefCounts(
+			"RefCountsClass",
+			RefCountsClass,
+			RefCountsLenClass);
+		
+		/*BEGIN MEMORY USAGE*/
+		report.AddRefCounts("RefCountsSystemDecimal", RefCountsSystemDecimal, RefCountsLenSystemDecimal);
+		report.AddRefCounts("RefCountsUnityEngineRaycastHit", RefCountsUnityEngineRaycastHit, RefCountsLenUnityEngineRaycastHit);
+		report.AddFreeList("BaseBallScriptFreeList", BaseBallScriptFreeList);
+		report.AddFreeList("BaseBallScriptFreeWholeList", BaseBallScriptFreeWholeList);
+		/*END MEMORY USAGE*/
+		
+		// Memory for PluginMain and the heap in it
+		report.Add(
+			"Allocators",
+			Allocators,
+			sizeof(MemoryAllocators),
+			sizeof(MemoryAllocators),
+			sizeof(MemoryAllocators),
+			sizeof(MemoryAllocators));
+		report.AddLinearAllocator(
+			"PersistentMemory",
+			Allocators->Persistent);
+		report.AddLinearAllocator(
+			"FrameMemory0",
+			Allocators->Frames[0]);
+		report.AddLinearAllocator(
+			"FrameMemory1",
+			Allocators->Frames[1]);
+		HeapAllocator& heap = Allocators->Heap;
+		report.Add(
+			"HeapMemory",
+			nullptr,
+			heap.PoolsSize,
+			heap.UsedSize,
+			heap.PeakUsedSize,
+			heap.PoolsSize);
+		
+		return report.NumUsages;
 	}
 }
 
-namespace System
+////////////////////////////////////////////////////////////////
+// Support for using IEnumerable with range for loops
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
 {
-	IEquatable_1<System::Boolean>::IEquatable_1(decltype(nullptr))
+	// End iterators are dummies full of null
+	EnumerableIterator::EnumerableIterator(decltype(nullptr))
+		: enumerator(nullptr)
+		, hasMore(false)
+		, index(0)
+		, count(0)
 	{
 	}
 	
-	IEquatable_1<System::Boolean>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	// Begin iterators keep track of an IEnumerator and a chunk of handles
+	// to the elements it has moved over
+	EnumerableIterator::EnumerableIterator(
+		System::Collections::IEnumerable& enumerable)
+		: enumerator(enumerable.GetEnumerator())
+		, hasMore(true)
+		, index(0)
+		, count(0)
 	{
-		Handle = handle;
-		if (handle)
-		{
-			Plugin::ReferenceManagedClass(handle);
-		}
+		FetchItems();
 	}
 	
-	IEquatable_1<System::Boolean>::IEquatable_1(const IEquatable_1<System::Boolean>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	// Take ownership of the other iterator's handles
+	EnumerableIterator::EnumerableIterator(EnumerableIterator&& other)
+		: enumerator(other.enumerator)
+		, hasMore(other.hasMore)
+		, index(other.index)
+		, count(other.count)
 	{
+		for (int32_t i = 0; i < count; ++i)
+		{
+			handles[i] = other.handles[i];
+		}
+		other.count = 0;
 	}
 	
-	IEquatable_1<System::Boolean>::IEquatable_1(IEquatable_1<System::Boolean>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	EnumerableIterator::~EnumerableIterator()
 	{
-		other.Handle = 0;
+		ReleaseItems();
 	}
 	
-	IEquatable_1<System::Boolean>::~IEquatable_1<System::Boolean>()
+	EnumerableIterator& EnumerableIterator::operator++()
 	{
-		if (Handle)
+		index++;
+		if (index == count && hasMore)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			FetchItems();
 		}
+		return *this;
 	}
 	
-	IEquatable_1<System::Boolean>& IEquatable_1<System::Boolean>::operator=(const IEquatable_1<System::Boolean>& other)
+	bool EnumerableIterator::operator!=(const EnumerableIterator& other)
 	{
-		if (this->Handle)
+		return index < count;
+	}
+	
+	System::Object EnumerableIterator::operator*()
+	{
+		return System::Object(Plugin::InternalUse::Only, handles[index]);
+	}
+	
+	// Move the enumerator over the next chunk of elements in one call. Each
+	// handle holds a reference until the chunk is released.
+	void EnumerableIterator::FetchItems()
+	{
+		ReleaseItems();
+		index = 0;
+		count = Plugin::EnumeratorMoveNextBatch(
+			enumerator.Handle,
+			handles,
+			EnumerableIteratorChunkSize);
+		for (int32_t i = 0; i < count; ++i)
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			Plugin::ReferenceManagedClass(handles[i]);
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			// Release the elements fetched before the exception
+			hasMore = false;
+			ReleaseItems();
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		return *this;
+		hasMore = count == EnumerableIteratorChunkSize;
 	}
 	
-	IEquatable_1<System::Boolean>& IEquatable_1<System::Boolean>::operator=(decltype(nullptr))
+	void EnumerableIterator::ReleaseItems()
 	{
-		if (Handle)
+		for (int32_t i = 0; i < count; ++i)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::DereferenceManagedClass(handles[i]);
 		}
-		return *this;
+		count = 0;
 	}
+}
+
+////////////////////////////////////////////////////////////////
+// Native multicast event dispatch
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// Heads of the lists of dispatchers. They're in plugin memory with the
+	// dispatchers so they're kept across reloads and saved in snapshots.
+	struct QueuedEventDispatcherLists
+	{
+		// Dispatchers with events queued for the next update
+		QueuedEventDispatcher* Queued;
+		
+		// Dispatchers whose queued events are being delivered
+		QueuedEventDispatcher* Dispatching;
+	};
 	
-	IEquatable_1<System::Boolean>& IEquatable_1<System::Boolean>::operator=(IEquatable_1<System::Boolean>&& other)
+	QueuedEventDispatcherLists* QueuedEventDispatchers;
+	
+	QueuedEventDispatcher::QueuedEventDispatcher()
+		: NextQueued(nullptr)
+		, IsQueued(false)
 	{
-		if (Handle)
+	}
+	
+	QueuedEventDispatcher::~QueuedEventDispatcher()
+	{
+		if (IsQueued)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			QueuedEventDispatcher** lists[] = {
+				&QueuedEventDispatchers->Queued,
+				&QueuedEventDispatchers->Dispatching
+			};
+			for (QueuedEventDispatcher** pCur : lists)
+			{
+				while (*pCur)
+				{
+					if (*pCur == this)
+					{
+						*pCur = NextQueued;
+						return;
+					}
+					pCur = &(*pCur)->NextQueued;
+				}
+			}
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
 	}
 	
-	bool IEquatable_1<System::Boolean>::operator==(const IEquatable_1<System::Boolean>& other) const
+	void QueueEventDispatch(QueuedEventDispatcher* dispatcher)
 	{
-		return Handle == other.Handle;
+		if (!dispatcher->IsQueued)
+		{
+			dispatcher->IsQueued = true;
+			dispatcher->NextQueued = QueuedEventDispatchers->Queued;
+			QueuedEventDispatchers->Queued = dispatcher;
+		}
 	}
 	
-	bool IEquatable_1<System::Boolean>::operator!=(const IEquatable_1<System::Boolean>& other) const
+	// Put the dispatchers that weren't reached back in the queue for the
+	// next update, even if a handler threw an exception
+	struct DispatchQueuedEventsScope
 	{
-		return Handle != other.Handle;
+		~DispatchQueuedEventsScope()
+		{
+			while (QueuedEventDispatchers->Dispatching)
+			{
+				QueuedEventDispatcher* dispatcher
+					= QueuedEventDispatchers->Dispatching;
+				QueuedEventDispatchers->Dispatching = dispatcher->NextQueued;
+				dispatcher->NextQueued = QueuedEventDispatchers->Queued;
+				QueuedEventDispatchers->Queued = dispatcher;
+			}
+		}
+	};
+	
+	void DispatchQueuedEvents()
+	{
+		// Events queued by handlers are delivered next update
+		QueuedEventDispatchers->Dispatching = QueuedEventDispatchers->Queued;
+		QueuedEventDispatchers->Queued = nullptr;
+		DispatchQueuedEventsScope scope;
+		while (QueuedEventDispatchers->Dispatching)
+		{
+			QueuedEventDispatcher* dispatcher
+				= QueuedEventDispatchers->Dispatching;
+			QueuedEventDispatchers->Dispatching = dispatcher->NextQueued;
+			dispatcher->NextQueued = nullptr;
+			dispatcher->IsQueued = false;
+			dispatcher->DispatchQueued();
+		}
 	}
 }
 
-namespace System
+////////////////////////////////////////////////////////////////
+// Batched physics messages
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
 {
-	IEquatable_1<System::Char>::IEquatable_1(decltype(nullptr))
-	{
-	}
+	PhysicsMessageQueue* PhysicsMessages;
 	
-	IEquatable_1<System::Char>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	// Call the receiving script's message function
+	void DispatchPhysicsMessage(PhysicsMessage& message)
 	{
-		Handle = handle;
-		if (handle)
+		switch (message.Receiver)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			/*BEGIN PHYSICS MESSAGE CASES*/
+			/*END PHYSICS MESSAGE CASES*/
+			default:
+				break;
 		}
 	}
 	
-	IEquatable_1<System::Char>::IEquatable_1(const IEquatable_1<System::Char>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	void DrainPhysicsMessages()
 	{
+		PhysicsMessageQueue* queue = PhysicsMessages;
+		PhysicsMessage* messages = (PhysicsMessage*)(queue + 1);
+		int32_t capacity = queue->Capacity;
+		
+		// Reference every other collider before handling any message so
+		// colliders in more than one message aren't released early. Messages
+		// recorded while draining are handled by the next drain.
+		int32_t count = queue->Count;
+		for (int32_t i = 0, index = queue->ReadIndex; i < count; ++i)
+		{
+			ReferenceManagedClass(messages[index].OtherHandle);
+			index = (index + 1) % capacity;
+		}
+		
+		for (int32_t i = 0; i < count; ++i)
+		{
+			PhysicsMessage message = messages[queue->ReadIndex];
+			queue->ReadIndex = (queue->ReadIndex + 1) % capacity;
+			queue->Count--;
+			PLUGIN_TRY
+			{
+				DispatchPhysicsMessage(message);
+			}
+			PLUGIN_CATCH_ALL
+			{
+				// Drop the rest of the referenced messages
+				DereferenceManagedClass(message.OtherHandle);
+				for (i++; i < count; ++i)
+				{
+					DereferenceManagedClass(
+						messages[queue->ReadIndex].OtherHandle);
+					queue->ReadIndex = (queue->ReadIndex + 1) % capacity;
+					queue->Count--;
+				}
+				PLUGIN_RETHROW;
+			}
+			DereferenceManagedClass(message.OtherHandle);
+		}
 	}
+}
+
+////////////////////////////////////////////////////////////////
+// Pooled GameObjects
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	GameObjectPoolCommandQueue* GameObjectPoolCommands;
 	
-	IEquatable_1<System::Char>::IEquatable_1(IEquatable_1<System::Char>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	bool QueueGameObjectPoolCommand(const GameObjectPoolCommand& command)
 	{
-		other.Handle = 0;
+		GameObjectPoolCommandQueue* queue = GameObjectPoolCommands;
+		if (queue->Count == queue->Capacity)
+		{
+			ApplyGameObjectPoolCommands();
+			
+			// Still full if C# was already making the commands
+			if (queue->Count == queue->Capacity)
+			{
+				queue->NumDropped++;
+				return false;
+			}
+		}
+		((GameObjectPoolCommand*)(queue + 1))[queue->Count] = command;
+		queue->Count++;
+		return true;
 	}
 	
-	IEquatable_1<System::Char>::~IEquatable_1<System::Char>()
+	bool GameObjectPool::Prewarm(const ManagedType& original, int32_t count)
 	{
-		if (Handle)
+		int32_t firstIndex = Entries.Length;
+		if (count <= 0)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			return true;
+		}
+		if (!Entries.Reserve(firstIndex + count)
+			|| !FreeIndices.Reserve(FreeIndices.Length + count))
+		{
+			return false;
 		}
+		int32_t* handles = HeapMemory->Allocate<int32_t>(count * 2);
+		if (!handles)
+		{
+			return false;
+		}
+		int32_t* instanceIds = handles + count;
+		
+		int32_t numCreated = GameObjectPoolPrewarm(
+			original.Handle,
+			count,
+			handles,
+			instanceIds);
+		for (int32_t i = 0; i < numCreated; ++i)
+		{
+			ReferenceManagedClass(handles[i]);
+			Entry entry;
+			entry.Handle = handles[i];
+			entry.InstanceId = instanceIds[i];
+			entry.IsSpawned = false;
+			Entries.PushBack(entry);
+			FreeIndices.PushBack(firstIndex + i);
+		}
+		HeapMemory->Free(handles);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return numCreated == count;
 	}
 	
-	IEquatable_1<System::Char>& IEquatable_1<System::Char>::operator=(const IEquatable_1<System::Char>& other)
+	int32_t GameObjectPool::Spawn(float x, float y, float z)
 	{
-		if (this->Handle)
+		return SpawnEntry(true, x, y, z);
+	}
+	
+	int32_t GameObjectPool::Spawn()
+	{
+		return SpawnEntry(false, 0, 0, 0);
+	}
+	
+	int32_t GameObjectPool::SpawnEntry(bool hasPosition, float x, float y, float z)
+	{
+		if (FreeIndices.Length == 0)
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			return -1;
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		int32_t index = FreeIndices[FreeIndices.Length - 1];
+		FreeIndices.PopBack();
+		Entry& entry = Entries[index];
+		entry.IsSpawned = true;
+		
+		GameObjectPoolCommand command = {};
+		command.Type = GameObjectPoolCommandType::Activate;
+		command.Handle = entry.Handle;
+		command.HasPosition = hasPosition;
+		command.Position[0] = x;
+		command.Position[1] = y;
+		command.Position[2] = z;
+		bool queued = QueueGameObjectPoolCommand(command);
+		
+		// Dropping only happens while C# is making the commands, so nothing
+		// else has changed the pool since it was taken
+		if (!queued)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			Entries[index].IsSpawned = false;
+			FreeIndices.PushBack(index);
+			index = -1;
 		}
-		return *this;
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return index;
 	}
 	
-	IEquatable_1<System::Char>& IEquatable_1<System::Char>::operator=(decltype(nullptr))
+	bool GameObjectPool::Despawn(int32_t index)
 	{
-		if (Handle)
+		Entry& entry = Entries[index];
+		if (!entry.IsSpawned)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			return true;
 		}
-		return *this;
+		entry.IsSpawned = false;
+		FreeIndices.PushBack(index);
+		
+		GameObjectPoolCommand command = {};
+		command.Type = GameObjectPoolCommandType::Deactivate;
+		command.Handle = entry.Handle;
+		bool queued = QueueGameObjectPoolCommand(command);
+		if (!queued)
+		{
+			Entries[index].IsSpawned = true;
+			FreeIndices.PopBack();
+		}
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return queued;
 	}
 	
-	IEquatable_1<System::Char>& IEquatable_1<System::Char>::operator=(IEquatable_1<System::Char>&& other)
+	bool GameObjectPool::Free()
 	{
-		if (Handle)
+		// Destroy from the back so copies whose commands are dropped keep
+		// their indices. Each command takes over the pool's reference and
+		// has C# release the handle if that was the last one. That keeps it
+		// from being reused while the command is queued, e.g. when this is
+		// called while C# is making the commands.
+		GameObjectPoolCommandQueue* queue = GameObjectPoolCommands;
+		while (Entries.Length > 0)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			int32_t handle = Entries[Entries.Length - 1].Handle;
+			GameObjectPoolCommand command = {};
+			command.Type = GameObjectPoolCommandType::Destroy;
+			command.Handle = handle;
+			if (!QueueGameObjectPoolCommand(command))
+			{
+				break;
+			}
+			if (DereferenceManagedClassNoRelease(handle))
+			{
+				((GameObjectPoolCommand*)(queue + 1))[queue->Count - 1]
+					.ReleaseHandle = 1;
+			}
+			Entries.PopBack();
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
+		ApplyGameObjectPoolCommands();
+		
+		bool freedAll = Entries.Length == 0;
+		if (freedAll)
+		{
+			Entries.Free();
+			FreeIndices.Free();
+		}
+		else
+		{
+			for (int32_t i = FreeIndices.Length - 1; i >= 0; --i)
+			{
+				if (FreeIndices[i] >= Entries.Length)
+				{
+					FreeIndices.RemoveAtSwapBack(i);
+				}
+			}
+		}
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return freedAll;
 	}
-	
-	bool IEquatable_1<System::Char>::operator==(const IEquatable_1<System::Char>& other) const
-	{
-		return Handle == other.Handle;
+}
+
+////////////////////////////////////////////////////////////////
+// Spawning GameObjects in batches
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	int32_t SpawnGameObjects(
+		const SpawnDescriptor* descriptors,
+		int32_t count,
+		const int32_t* names,
+		const SpawnComponent* components,
+		int32_t* handles)
+	{
+		if (count <= 0)
+		{
+			return 0;
+		}
+		int32_t numCreated = SpawnGameObjectBatch(
+			descriptors,
+			count,
+			names,
+			components,
+			handles);
+		if (handles)
+		{
+			for (int32_t i = 0; i < numCreated; ++i)
+			{
+				ReferenceManagedClass(handles[i]);
+			}
+			for (int32_t i = numCreated; i < count; ++i)
+			{
+				handles[i] = 0;
+			}
+		}
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return numCreated;
 	}
 	
-	bool IEquatable_1<System::Char>::operator!=(const IEquatable_1<System::Char>& other) const
+	void ReleaseSpawnedGameObjects(int32_t* handles, int32_t count)
 	{
-		return Handle != other.Handle;
+		for (int32_t i = 0; i < count; ++i)
+		{
+			if (handles[i])
+			{
+				DereferenceManagedClass(handles[i]);
+				handles[i] = 0;
+			}
+		}
 	}
 }
 
-namespace System
+////////////////////////////////////////////////////////////////
+// C# exceptions
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
 {
-	IEquatable_1<System::SByte>::IEquatable_1(decltype(nullptr))
-	{
-	}
+	// Number of CatchCsharpExceptions in scope on this thread
+	thread_local int32_t numCsharpExceptionCatchers = 0;
 	
-	IEquatable_1<System::SByte>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	void ThrowUnhandledCsharpException()
 	{
-		Handle = handle;
-		if (handle)
+		if (numCsharpExceptionCatchers == 0)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			void (*thrower)(int32_t) = unhandledCsharpException;
+			unhandledCsharpException = nullptr;
+#if PLUGIN_EXCEPTIONS
+			thrower(StoreCsharpException());
+#else
+			// C++ can't unwind, so C# throws this when C++ returns to it
+			(void)thrower;
+			System::Exception ex(
+				Plugin::InternalUse::Only,
+				StoreCsharpException());
+			SetException(ex.Handle);
+#endif
 		}
 	}
 	
-	IEquatable_1<System::SByte>::IEquatable_1(const IEquatable_1<System::SByte>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	void SetCaughtException(const char* message)
 	{
+#if PLUGIN_EXCEPTIONS
+		try
+		{
+			throw;
+		}
+		catch (System::Exception ex)
+		{
+			SetException(ex.Handle);
+		}
+		catch (...)
+		{
+			System::String msg = message;
+			System::Exception ex(msg);
+			SetException(ex.Handle);
+		}
+#else
+		(void)message;
+#endif
 	}
 	
-	IEquatable_1<System::SByte>::IEquatable_1(IEquatable_1<System::SByte>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	void ThrowSystemException(int32_t handle)
 	{
-		other.Handle = 0;
+#if !PLUGIN_EXCEPTIONS
+		(void)handle;
+#endif
+		PLUGIN_THROW(System::Exception(Plugin::InternalUse::Only, handle));
 	}
 	
-	IEquatable_1<System::SByte>::~IEquatable_1<System::SByte>()
+	CatchCsharpExceptions::CatchCsharpExceptions()
 	{
-		if (Handle)
-		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
-		}
+		numCsharpExceptionCatchers++;
 	}
 	
-	IEquatable_1<System::SByte>& IEquatable_1<System::SByte>::operator=(const IEquatable_1<System::SByte>& other)
+	CatchCsharpExceptions::~CatchCsharpExceptions()
 	{
-		if (this->Handle)
-		{
-			Plugin::DereferenceManagedClass(this->Handle);
-		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		// An enclosing catcher still gets the exception
+		numCsharpExceptionCatchers--;
+		if (numCsharpExceptionCatchers == 0)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			unhandledCsharpException = nullptr;
 		}
-		return *this;
 	}
 	
-	IEquatable_1<System::SByte>& IEquatable_1<System::SByte>::operator=(decltype(nullptr))
+	bool CatchCsharpExceptions::HasException() const
 	{
-		if (Handle)
-		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
-		}
-		return *this;
+		return unhandledCsharpException != nullptr;
 	}
 	
-	IEquatable_1<System::SByte>& IEquatable_1<System::SByte>::operator=(IEquatable_1<System::SByte>&& other)
+	System::Exception CatchCsharpExceptions::GetException()
 	{
-		if (Handle)
+		if (!unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			return nullptr;
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
+		unhandledCsharpException = nullptr;
+		return System::Exception(
+			Plugin::InternalUse::Only,
+			StoreCsharpException());
 	}
 	
-	bool IEquatable_1<System::SByte>::operator==(const IEquatable_1<System::SByte>& other) const
-	{
-		return Handle == other.Handle;
-	}
-	
-	bool IEquatable_1<System::SByte>::operator!=(const IEquatable_1<System::SByte>& other) const
+	void CatchCsharpExceptions::Clear()
 	{
-		return Handle != other.Handle;
+		unhandledCsharpException = nullptr;
 	}
 }
 
+////////////////////////////////////////////////////////////////
+// Mirrors of C# types. These wrap the C# functions to present
+// a similiar API as in C#.
+////////////////////////////////////////////////////////////////
+
 namespace System
 {
-	IEquatable_1<System::Byte>::IEquatable_1(decltype(nullptr))
+	Object::Object()
+		: Plugin::ManagedType(nullptr)
 	{
 	}
 	
-	IEquatable_1<System::Byte>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	Object::Object(Plugin::InternalUse iu, int32_t handle)
+		: ManagedType(Plugin::InternalUse::Only, handle)
 	{
-		Handle = handle;
-		if (handle)
-		{
-			Plugin::ReferenceManagedClass(handle);
-		}
 	}
 	
-	IEquatable_1<System::Byte>::IEquatable_1(const IEquatable_1<System::Byte>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	Object::Object(decltype(nullptr))
+		: ManagedType(nullptr)
 	{
 	}
-	
-	IEquatable_1<System::Byte>::IEquatable_1(IEquatable_1<System::Byte>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+
+	Object::~Object()
 	{
-		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Byte>::~IEquatable_1<System::Byte>()
+	bool Object::operator==(decltype(nullptr)) const
 	{
-		if (Handle)
-		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
-		}
+		return Handle == 0;
 	}
 	
-	IEquatable_1<System::Byte>& IEquatable_1<System::Byte>::operator=(const IEquatable_1<System::Byte>& other)
+	bool Object::operator!=(decltype(nullptr)) const
 	{
-		if (this->Handle)
-		{
-			Plugin::DereferenceManagedClass(this->Handle);
-		}
-		this->Handle = other.Handle;
-		if (this->Handle)
-		{
-			Plugin::ReferenceManagedClass(this->Handle);
-		}
-		return *this;
+		return Handle != 0;
 	}
 	
-	IEquatable_1<System::Byte>& IEquatable_1<System::Byte>::operator=(decltype(nullptr))
+	void Object::ThrowReferenceToThis()
 	{
-		if (Handle)
-		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
-		}
-		return *this;
+		PLUGIN_THROW(*this);
 	}
 	
-	IEquatable_1<System::Byte>& IEquatable_1<System::Byte>::operator=(IEquatable_1<System::Byte>&& other)
+	ValueType::ValueType(Plugin::InternalUse iu, int32_t handle)
+		: Object(iu, handle)
 	{
-		if (Handle)
-		{
-			Plugin::DereferenceManagedClass(Handle);
-		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
 	}
 	
-	bool IEquatable_1<System::Byte>::operator==(const IEquatable_1<System::Byte>& other) const
+	ValueType::ValueType(decltype(nullptr))
+		: Object(nullptr)
 	{
-		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::Byte>::operator!=(const IEquatable_1<System::Byte>& other) const
+	Enum::Enum(Plugin::InternalUse iu, int32_t handle)
+		: ValueType(iu, handle)
 	{
-		return Handle != other.Handle;
 	}
-}
-
-namespace System
-{
-	IEquatable_1<System::Int16>::IEquatable_1(decltype(nullptr))
+	
+	Enum::Enum(decltype(nullptr))
+		: ValueType(nullptr)
 	{
 	}
 	
-	IEquatable_1<System::Int16>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	String::String(decltype(nullptr))
+		: Object(Plugin::InternalUse::Only, 0)
+	{
+	}
+	
+	String::String(Plugin::InternalUse iu, int32_t handle)
+		: Object(iu, handle)
 	{
-		Handle = handle;
 		if (handle)
 		{
 			Plugin::ReferenceManagedClass(handle);
 		}
 	}
 	
-	IEquatable_1<System::Int16>::IEquatable_1(const IEquatable_1<System::Int16>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	String::String(const String& other)
+		: Object(Plugin::InternalUse::Only, other.Handle)
 	{
+		if (Handle)
+		{
+			Plugin::ReferenceManagedClass(Handle);
+		}
 	}
 	
-	IEquatable_1<System::Int16>::IEquatable_1(IEquatable_1<System::Int16>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	String::String(String&& other)
+		: Object(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Int16>::~IEquatable_1<System::Int16>()
+	String::~String()
 	{
 		if (Handle)
 		{
@@ -1788,21 +2841,24 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Int16>& IEquatable_1<System::Int16>::operator=(const IEquatable_1<System::Int16>& other)
+	String& String::operator=(const String& other)
 	{
-		if (this->Handle)
-		{
-			Plugin::DereferenceManagedClass(this->Handle);
-		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		if (Handle != other.Handle)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+			}
+			Handle = other.Handle;
+			if (Handle)
+			{
+				Plugin::ReferenceManagedClass(Handle);
+			}
 		}
 		return *this;
 	}
 	
-	IEquatable_1<System::Int16>& IEquatable_1<System::Int16>::operator=(decltype(nullptr))
+	String& String::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -1812,7 +2868,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Int16>& IEquatable_1<System::Int16>::operator=(IEquatable_1<System::Int16>&& other)
+	String& String::operator=(String&& other)
 	{
 		if (Handle)
 		{
@@ -1823,24 +2879,117 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::Int16>::operator==(const IEquatable_1<System::Int16>& other) const
+	String::String(const char* chars)
+		: Object(Plugin::InternalUse::Only, Plugin::StringNew(chars))
 	{
-		return Handle == other.Handle;
+		Plugin::ReferenceManagedClass(Handle);
 	}
 	
-	bool IEquatable_1<System::Int16>::operator!=(const IEquatable_1<System::Int16>& other) const
+	ICloneable::ICloneable(Plugin::InternalUse iu, int32_t handle)
+		: Object(iu, handle)
 	{
-		return Handle != other.Handle;
+	}
+	
+	ICloneable::ICloneable(decltype(nullptr))
+		: Object(nullptr)
+	{
+	}
+	
+	namespace Collections
+	{
+		IEnumerable::IEnumerable(Plugin::InternalUse iu, int32_t handle)
+			: Object(iu, handle)
+		{
+		}
+		
+		IEnumerable::IEnumerable(decltype(nullptr))
+			: Object(nullptr)
+		{
+		}
+		
+		IEnumerator IEnumerable::GetEnumerator()
+		{
+			return IEnumerator(
+				Plugin::InternalUse::Only,
+				Plugin::EnumerableGetEnumerator(Handle));
+		}
+		
+		Plugin::EnumerableIterator begin(
+			System::Collections::IEnumerable& enumerable)
+		{
+			return Plugin::EnumerableIterator(enumerable);
+		}
+		
+		Plugin::EnumerableIterator end(
+			System::Collections::IEnumerable& enumerable)
+		{
+			return Plugin::EnumerableIterator(nullptr);
+		}
+		
+		ICollection::ICollection(Plugin::InternalUse iu, int32_t handle)
+			: Object(iu, handle)
+			, IEnumerable(nullptr)
+		{
+		}
+		
+		ICollection::ICollection(decltype(nullptr))
+			: Object(nullptr)
+			, IEnumerable(nullptr)
+		{
+		}
+		
+		IList::IList(Plugin::InternalUse iu, int32_t handle)
+			: Object(iu, handle)
+			, IEnumerable(nullptr)
+			, ICollection(nullptr)
+		{
+		}
+		
+		IList::IList(decltype(nullptr))
+			: Object(nullptr)
+			, IEnumerable(nullptr)
+			, ICollection(nullptr)
+		{
+		}
+	}
+	
+	Array::Array(Plugin::InternalUse iu, int32_t handle)
+		: Object(iu, handle)
+		, ICloneable(nullptr)
+		, Collections::IEnumerable(nullptr)
+		, Collections::ICollection(nullptr)
+		, Collections::IList(nullptr)
+	{
+	}
+	
+	Array::Array(decltype(nullptr))
+		: Object(nullptr)
+		, ICloneable(nullptr)
+		, Collections::IEnumerable(nullptr)
+		, Collections::ICollection(nullptr)
+		, Collections::IList(nullptr)
+	{
+	}
+	
+	int32_t Array::GetLength()
+	{
+		return Plugin::ArrayGetLength(Handle);
+	}
+	
+	int32_t Array::GetRank()
+	{
+		return 0;
 	}
 }
 
+/*BEGIN METHOD DEFINITIONS*/
 namespace System
 {
-	IEquatable_1<System::UInt16>::IEquatable_1(decltype(nullptr))
+	IFormattable::IFormattable(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::UInt16>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IFormattable::IFormattable(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -1849,18 +2998,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::UInt16>::IEquatable_1(const IEquatable_1<System::UInt16>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	IFormattable::IFormattable(const IFormattable& other)
+		: IFormattable(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::UInt16>::IEquatable_1(IEquatable_1<System::UInt16>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	IFormattable::IFormattable(IFormattable&& other)
+		: IFormattable(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::UInt16>::~IEquatable_1<System::UInt16>()
+	IFormattable::~IFormattable()
 	{
 		if (Handle)
 		{
@@ -1869,7 +3018,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::UInt16>& IEquatable_1<System::UInt16>::operator=(const IEquatable_1<System::UInt16>& other)
+	IFormattable& IFormattable::operator=(const IFormattable& other)
 	{
 		if (this->Handle)
 		{
@@ -1883,7 +3032,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::UInt16>& IEquatable_1<System::UInt16>::operator=(decltype(nullptr))
+	IFormattable& IFormattable::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -1893,7 +3042,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::UInt16>& IEquatable_1<System::UInt16>::operator=(IEquatable_1<System::UInt16>&& other)
+	IFormattable& IFormattable::operator=(IFormattable&& other)
 	{
 		if (Handle)
 		{
@@ -1904,12 +3053,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::UInt16>::operator==(const IEquatable_1<System::UInt16>& other) const
+	bool IFormattable::operator==(const IFormattable& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::UInt16>::operator!=(const IEquatable_1<System::UInt16>& other) const
+	bool IFormattable::operator!=(const IFormattable& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -1917,11 +3066,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<System::Int32>::IEquatable_1(decltype(nullptr))
+	IConvertible::IConvertible(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::Int32>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IConvertible::IConvertible(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -1930,18 +3079,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Int32>::IEquatable_1(const IEquatable_1<System::Int32>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	IConvertible::IConvertible(const IConvertible& other)
+		: IConvertible(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::Int32>::IEquatable_1(IEquatable_1<System::Int32>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	IConvertible::IConvertible(IConvertible&& other)
+		: IConvertible(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Int32>::~IEquatable_1<System::Int32>()
+	IConvertible::~IConvertible()
 	{
 		if (Handle)
 		{
@@ -1950,7 +3099,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Int32>& IEquatable_1<System::Int32>::operator=(const IEquatable_1<System::Int32>& other)
+	IConvertible& IConvertible::operator=(const IConvertible& other)
 	{
 		if (this->Handle)
 		{
@@ -1964,7 +3113,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Int32>& IEquatable_1<System::Int32>::operator=(decltype(nullptr))
+	IConvertible& IConvertible::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -1974,7 +3123,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Int32>& IEquatable_1<System::Int32>::operator=(IEquatable_1<System::Int32>&& other)
+	IConvertible& IConvertible::operator=(IConvertible&& other)
 	{
 		if (Handle)
 		{
@@ -1985,12 +3134,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::Int32>::operator==(const IEquatable_1<System::Int32>& other) const
+	bool IConvertible::operator==(const IConvertible& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::Int32>::operator!=(const IEquatable_1<System::Int32>& other) const
+	bool IConvertible::operator!=(const IConvertible& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -1998,11 +3147,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<System::UInt32>::IEquatable_1(decltype(nullptr))
+	IComparable::IComparable(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::UInt32>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IComparable::IComparable(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2011,18 +3160,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::UInt32>::IEquatable_1(const IEquatable_1<System::UInt32>& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	IComparable::IComparable(const IComparable& other)
+		: IComparable(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::UInt32>::IEquatable_1(IEquatable_1<System::UInt32>&& other)
-		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
+	IComparable::IComparable(IComparable&& other)
+		: IComparable(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::UInt32>::~IEquatable_1<System::UInt32>()
+	IComparable::~IComparable()
 	{
 		if (Handle)
 		{
@@ -2031,7 +3180,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::UInt32>& IEquatable_1<System::UInt32>::operator=(const IEquatable_1<System::UInt32>& other)
+	IComparable& IComparable::operator=(const IComparable& other)
 	{
 		if (this->Handle)
 		{
@@ -2045,7 +3194,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::UInt32>& IEquatable_1<System::UInt32>::operator=(decltype(nullptr))
+	IComparable& IComparable::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2055,7 +3204,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::UInt32>& IEquatable_1<System::UInt32>::operator=(IEquatable_1<System::UInt32>&& other)
+	IComparable& IComparable::operator=(IComparable&& other)
 	{
 		if (Handle)
 		{
@@ -2066,12 +3215,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::UInt32>::operator==(const IEquatable_1<System::UInt32>& other) const
+	bool IComparable::operator==(const IComparable& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::UInt32>::operator!=(const IEquatable_1<System::UInt32>& other) const
+	bool IComparable::operator!=(const IComparable& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2079,11 +3228,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<System::Int64>::IEquatable_1(decltype(nullptr))
+	IEquatable_1<System::Boolean>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::Int64>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Boolean>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2092,18 +3241,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Int64>::IEquatable_1(const IEquatable_1<System::Int64>& other)
+	IEquatable_1<System::Boolean>::IEquatable_1(const IEquatable_1<System::Boolean>& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::Int64>::IEquatable_1(IEquatable_1<System::Int64>&& other)
+	IEquatable_1<System::Boolean>::IEquatable_1(IEquatable_1<System::Boolean>&& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Int64>::~IEquatable_1<System::Int64>()
+	IEquatable_1<System::Boolean>::~IEquatable_1<System::Boolean>()
 	{
 		if (Handle)
 		{
@@ -2112,7 +3261,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Int64>& IEquatable_1<System::Int64>::operator=(const IEquatable_1<System::Int64>& other)
+	IEquatable_1<System::Boolean>& IEquatable_1<System::Boolean>::operator=(const IEquatable_1<System::Boolean>& other)
 	{
 		if (this->Handle)
 		{
@@ -2126,7 +3275,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Int64>& IEquatable_1<System::Int64>::operator=(decltype(nullptr))
+	IEquatable_1<System::Boolean>& IEquatable_1<System::Boolean>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2136,7 +3285,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Int64>& IEquatable_1<System::Int64>::operator=(IEquatable_1<System::Int64>&& other)
+	IEquatable_1<System::Boolean>& IEquatable_1<System::Boolean>::operator=(IEquatable_1<System::Boolean>&& other)
 	{
 		if (Handle)
 		{
@@ -2147,12 +3296,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::Int64>::operator==(const IEquatable_1<System::Int64>& other) const
+	bool IEquatable_1<System::Boolean>::operator==(const IEquatable_1<System::Boolean>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::Int64>::operator!=(const IEquatable_1<System::Int64>& other) const
+	bool IEquatable_1<System::Boolean>::operator!=(const IEquatable_1<System::Boolean>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2160,11 +3309,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<System::UInt64>::IEquatable_1(decltype(nullptr))
+	IEquatable_1<System::Char>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::UInt64>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Char>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2173,18 +3322,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::UInt64>::IEquatable_1(const IEquatable_1<System::UInt64>& other)
+	IEquatable_1<System::Char>::IEquatable_1(const IEquatable_1<System::Char>& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::UInt64>::IEquatable_1(IEquatable_1<System::UInt64>&& other)
+	IEquatable_1<System::Char>::IEquatable_1(IEquatable_1<System::Char>&& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::UInt64>::~IEquatable_1<System::UInt64>()
+	IEquatable_1<System::Char>::~IEquatable_1<System::Char>()
 	{
 		if (Handle)
 		{
@@ -2193,7 +3342,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::UInt64>& IEquatable_1<System::UInt64>::operator=(const IEquatable_1<System::UInt64>& other)
+	IEquatable_1<System::Char>& IEquatable_1<System::Char>::operator=(const IEquatable_1<System::Char>& other)
 	{
 		if (this->Handle)
 		{
@@ -2207,7 +3356,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::UInt64>& IEquatable_1<System::UInt64>::operator=(decltype(nullptr))
+	IEquatable_1<System::Char>& IEquatable_1<System::Char>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2217,7 +3366,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::UInt64>& IEquatable_1<System::UInt64>::operator=(IEquatable_1<System::UInt64>&& other)
+	IEquatable_1<System::Char>& IEquatable_1<System::Char>::operator=(IEquatable_1<System::Char>&& other)
 	{
 		if (Handle)
 		{
@@ -2228,12 +3377,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::UInt64>::operator==(const IEquatable_1<System::UInt64>& other) const
+	bool IEquatable_1<System::Char>::operator==(const IEquatable_1<System::Char>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::UInt64>::operator!=(const IEquatable_1<System::UInt64>& other) const
+	bool IEquatable_1<System::Char>::operator!=(const IEquatable_1<System::Char>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2241,11 +3390,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<System::Single>::IEquatable_1(decltype(nullptr))
+	IEquatable_1<System::SByte>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::Single>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::SByte>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2254,18 +3403,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Single>::IEquatable_1(const IEquatable_1<System::Single>& other)
+	IEquatable_1<System::SByte>::IEquatable_1(const IEquatable_1<System::SByte>& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::Single>::IEquatable_1(IEquatable_1<System::Single>&& other)
+	IEquatable_1<System::SByte>::IEquatable_1(IEquatable_1<System::SByte>&& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Single>::~IEquatable_1<System::Single>()
+	IEquatable_1<System::SByte>::~IEquatable_1<System::SByte>()
 	{
 		if (Handle)
 		{
@@ -2274,7 +3423,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Single>& IEquatable_1<System::Single>::operator=(const IEquatable_1<System::Single>& other)
+	IEquatable_1<System::SByte>& IEquatable_1<System::SByte>::operator=(const IEquatable_1<System::SByte>& other)
 	{
 		if (this->Handle)
 		{
@@ -2288,7 +3437,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Single>& IEquatable_1<System::Single>::operator=(decltype(nullptr))
+	IEquatable_1<System::SByte>& IEquatable_1<System::SByte>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2298,7 +3447,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Single>& IEquatable_1<System::Single>::operator=(IEquatable_1<System::Single>&& other)
+	IEquatable_1<System::SByte>& IEquatable_1<System::SByte>::operator=(IEquatable_1<System::SByte>&& other)
 	{
 		if (Handle)
 		{
@@ -2309,12 +3458,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::Single>::operator==(const IEquatable_1<System::Single>& other) const
+	bool IEquatable_1<System::SByte>::operator==(const IEquatable_1<System::SByte>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::Single>::operator!=(const IEquatable_1<System::Single>& other) const
+	bool IEquatable_1<System::SByte>::operator!=(const IEquatable_1<System::SByte>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2322,11 +3471,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<System::Double>::IEquatable_1(decltype(nullptr))
+	IEquatable_1<System::Byte>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::Double>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Byte>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2335,18 +3484,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Double>::IEquatable_1(const IEquatable_1<System::Double>& other)
+	IEquatable_1<System::Byte>::IEquatable_1(const IEquatable_1<System::Byte>& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::Double>::IEquatable_1(IEquatable_1<System::Double>&& other)
+	IEquatable_1<System::Byte>::IEquatable_1(IEquatable_1<System::Byte>&& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Double>::~IEquatable_1<System::Double>()
+	IEquatable_1<System::Byte>::~IEquatable_1<System::Byte>()
 	{
 		if (Handle)
 		{
@@ -2355,7 +3504,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Double>& IEquatable_1<System::Double>::operator=(const IEquatable_1<System::Double>& other)
+	IEquatable_1<System::Byte>& IEquatable_1<System::Byte>::operator=(const IEquatable_1<System::Byte>& other)
 	{
 		if (this->Handle)
 		{
@@ -2369,7 +3518,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Double>& IEquatable_1<System::Double>::operator=(decltype(nullptr))
+	IEquatable_1<System::Byte>& IEquatable_1<System::Byte>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2379,7 +3528,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Double>& IEquatable_1<System::Double>::operator=(IEquatable_1<System::Double>&& other)
+	IEquatable_1<System::Byte>& IEquatable_1<System::Byte>::operator=(IEquatable_1<System::Byte>&& other)
 	{
 		if (Handle)
 		{
@@ -2390,12 +3539,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::Double>::operator==(const IEquatable_1<System::Double>& other) const
+	bool IEquatable_1<System::Byte>::operator==(const IEquatable_1<System::Byte>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::Double>::operator!=(const IEquatable_1<System::Double>& other) const
+	bool IEquatable_1<System::Byte>::operator!=(const IEquatable_1<System::Byte>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2403,11 +3552,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<System::Decimal>::IEquatable_1(decltype(nullptr))
+	IEquatable_1<System::Int16>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<System::Decimal>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Int16>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2416,18 +3565,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Decimal>::IEquatable_1(const IEquatable_1<System::Decimal>& other)
+	IEquatable_1<System::Int16>::IEquatable_1(const IEquatable_1<System::Int16>& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<System::Decimal>::IEquatable_1(IEquatable_1<System::Decimal>&& other)
+	IEquatable_1<System::Int16>::IEquatable_1(IEquatable_1<System::Int16>&& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<System::Decimal>::~IEquatable_1<System::Decimal>()
+	IEquatable_1<System::Int16>::~IEquatable_1<System::Int16>()
 	{
 		if (Handle)
 		{
@@ -2436,7 +3585,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<System::Decimal>& IEquatable_1<System::Decimal>::operator=(const IEquatable_1<System::Decimal>& other)
+	IEquatable_1<System::Int16>& IEquatable_1<System::Int16>::operator=(const IEquatable_1<System::Int16>& other)
 	{
 		if (this->Handle)
 		{
@@ -2450,7 +3599,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Decimal>& IEquatable_1<System::Decimal>::operator=(decltype(nullptr))
+	IEquatable_1<System::Int16>& IEquatable_1<System::Int16>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2460,7 +3609,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<System::Decimal>& IEquatable_1<System::Decimal>::operator=(IEquatable_1<System::Decimal>&& other)
+	IEquatable_1<System::Int16>& IEquatable_1<System::Int16>::operator=(IEquatable_1<System::Int16>&& other)
 	{
 		if (Handle)
 		{
@@ -2471,12 +3620,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<System::Decimal>::operator==(const IEquatable_1<System::Decimal>& other) const
+	bool IEquatable_1<System::Int16>::operator==(const IEquatable_1<System::Int16>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<System::Decimal>::operator!=(const IEquatable_1<System::Decimal>& other) const
+	bool IEquatable_1<System::Int16>::operator!=(const IEquatable_1<System::Int16>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2484,11 +3633,11 @@ namespace System
 
 namespace System
 {
-	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(decltype(nullptr))
+	IEquatable_1<System::UInt16>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::UInt16>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2497,18 +3646,18 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(const IEquatable_1<UnityEngine::Vector3>& other)
+	IEquatable_1<System::UInt16>::IEquatable_1(const IEquatable_1<System::UInt16>& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(IEquatable_1<UnityEngine::Vector3>&& other)
+	IEquatable_1<System::UInt16>::IEquatable_1(IEquatable_1<System::UInt16>&& other)
 		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>::~IEquatable_1<UnityEngine::Vector3>()
+	IEquatable_1<System::UInt16>::~IEquatable_1<System::UInt16>()
 	{
 		if (Handle)
 		{
@@ -2517,7 +3666,7 @@ namespace System
 		}
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>& IEquatable_1<UnityEngine::Vector3>::operator=(const IEquatable_1<UnityEngine::Vector3>& other)
+	IEquatable_1<System::UInt16>& IEquatable_1<System::UInt16>::operator=(const IEquatable_1<System::UInt16>& other)
 	{
 		if (this->Handle)
 		{
@@ -2531,7 +3680,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>& IEquatable_1<UnityEngine::Vector3>::operator=(decltype(nullptr))
+	IEquatable_1<System::UInt16>& IEquatable_1<System::UInt16>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2541,7 +3690,7 @@ namespace System
 		return *this;
 	}
 	
-	IEquatable_1<UnityEngine::Vector3>& IEquatable_1<UnityEngine::Vector3>::operator=(IEquatable_1<UnityEngine::Vector3>&& other)
+	IEquatable_1<System::UInt16>& IEquatable_1<System::UInt16>::operator=(IEquatable_1<System::UInt16>&& other)
 	{
 		if (Handle)
 		{
@@ -2552,12 +3701,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IEquatable_1<UnityEngine::Vector3>::operator==(const IEquatable_1<UnityEngine::Vector3>& other) const
+	bool IEquatable_1<System::UInt16>::operator==(const IEquatable_1<System::UInt16>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IEquatable_1<UnityEngine::Vector3>::operator!=(const IEquatable_1<UnityEngine::Vector3>& other) const
+	bool IEquatable_1<System::UInt16>::operator!=(const IEquatable_1<System::UInt16>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2565,11 +3714,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Boolean>::IComparable_1(decltype(nullptr))
+	IEquatable_1<System::Int32>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Boolean>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Int32>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2578,18 +3727,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Boolean>::IComparable_1(const IComparable_1<System::Boolean>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Int32>::IEquatable_1(const IEquatable_1<System::Int32>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Boolean>::IComparable_1(IComparable_1<System::Boolean>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Int32>::IEquatable_1(IEquatable_1<System::Int32>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Boolean>::~IComparable_1<System::Boolean>()
+	IEquatable_1<System::Int32>::~IEquatable_1<System::Int32>()
 	{
 		if (Handle)
 		{
@@ -2598,7 +3747,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Boolean>& IComparable_1<System::Boolean>::operator=(const IComparable_1<System::Boolean>& other)
+	IEquatable_1<System::Int32>& IEquatable_1<System::Int32>::operator=(const IEquatable_1<System::Int32>& other)
 	{
 		if (this->Handle)
 		{
@@ -2612,7 +3761,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Boolean>& IComparable_1<System::Boolean>::operator=(decltype(nullptr))
+	IEquatable_1<System::Int32>& IEquatable_1<System::Int32>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2622,7 +3771,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Boolean>& IComparable_1<System::Boolean>::operator=(IComparable_1<System::Boolean>&& other)
+	IEquatable_1<System::Int32>& IEquatable_1<System::Int32>::operator=(IEquatable_1<System::Int32>&& other)
 	{
 		if (Handle)
 		{
@@ -2633,12 +3782,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Boolean>::operator==(const IComparable_1<System::Boolean>& other) const
+	bool IEquatable_1<System::Int32>::operator==(const IEquatable_1<System::Int32>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Boolean>::operator!=(const IComparable_1<System::Boolean>& other) const
+	bool IEquatable_1<System::Int32>::operator!=(const IEquatable_1<System::Int32>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2646,11 +3795,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Char>::IComparable_1(decltype(nullptr))
+	IEquatable_1<System::UInt32>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Char>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::UInt32>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2659,18 +3808,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Char>::IComparable_1(const IComparable_1<System::Char>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::UInt32>::IEquatable_1(const IEquatable_1<System::UInt32>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Char>::IComparable_1(IComparable_1<System::Char>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::UInt32>::IEquatable_1(IEquatable_1<System::UInt32>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Char>::~IComparable_1<System::Char>()
+	IEquatable_1<System::UInt32>::~IEquatable_1<System::UInt32>()
 	{
 		if (Handle)
 		{
@@ -2679,7 +3828,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Char>& IComparable_1<System::Char>::operator=(const IComparable_1<System::Char>& other)
+	IEquatable_1<System::UInt32>& IEquatable_1<System::UInt32>::operator=(const IEquatable_1<System::UInt32>& other)
 	{
 		if (this->Handle)
 		{
@@ -2693,7 +3842,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Char>& IComparable_1<System::Char>::operator=(decltype(nullptr))
+	IEquatable_1<System::UInt32>& IEquatable_1<System::UInt32>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2703,7 +3852,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Char>& IComparable_1<System::Char>::operator=(IComparable_1<System::Char>&& other)
+	IEquatable_1<System::UInt32>& IEquatable_1<System::UInt32>::operator=(IEquatable_1<System::UInt32>&& other)
 	{
 		if (Handle)
 		{
@@ -2714,12 +3863,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Char>::operator==(const IComparable_1<System::Char>& other) const
+	bool IEquatable_1<System::UInt32>::operator==(const IEquatable_1<System::UInt32>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Char>::operator!=(const IComparable_1<System::Char>& other) const
+	bool IEquatable_1<System::UInt32>::operator!=(const IEquatable_1<System::UInt32>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2727,11 +3876,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::SByte>::IComparable_1(decltype(nullptr))
+	IEquatable_1<System::Int64>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::SByte>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Int64>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2740,18 +3889,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::SByte>::IComparable_1(const IComparable_1<System::SByte>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Int64>::IEquatable_1(const IEquatable_1<System::Int64>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::SByte>::IComparable_1(IComparable_1<System::SByte>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Int64>::IEquatable_1(IEquatable_1<System::Int64>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::SByte>::~IComparable_1<System::SByte>()
+	IEquatable_1<System::Int64>::~IEquatable_1<System::Int64>()
 	{
 		if (Handle)
 		{
@@ -2760,7 +3909,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::SByte>& IComparable_1<System::SByte>::operator=(const IComparable_1<System::SByte>& other)
+	IEquatable_1<System::Int64>& IEquatable_1<System::Int64>::operator=(const IEquatable_1<System::Int64>& other)
 	{
 		if (this->Handle)
 		{
@@ -2774,7 +3923,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::SByte>& IComparable_1<System::SByte>::operator=(decltype(nullptr))
+	IEquatable_1<System::Int64>& IEquatable_1<System::Int64>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2784,7 +3933,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::SByte>& IComparable_1<System::SByte>::operator=(IComparable_1<System::SByte>&& other)
+	IEquatable_1<System::Int64>& IEquatable_1<System::Int64>::operator=(IEquatable_1<System::Int64>&& other)
 	{
 		if (Handle)
 		{
@@ -2795,12 +3944,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::SByte>::operator==(const IComparable_1<System::SByte>& other) const
+	bool IEquatable_1<System::Int64>::operator==(const IEquatable_1<System::Int64>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::SByte>::operator!=(const IComparable_1<System::SByte>& other) const
+	bool IEquatable_1<System::Int64>::operator!=(const IEquatable_1<System::Int64>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2808,11 +3957,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Byte>::IComparable_1(decltype(nullptr))
+	IEquatable_1<System::UInt64>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Byte>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::UInt64>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2821,18 +3970,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Byte>::IComparable_1(const IComparable_1<System::Byte>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::UInt64>::IEquatable_1(const IEquatable_1<System::UInt64>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Byte>::IComparable_1(IComparable_1<System::Byte>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::UInt64>::IEquatable_1(IEquatable_1<System::UInt64>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Byte>::~IComparable_1<System::Byte>()
+	IEquatable_1<System::UInt64>::~IEquatable_1<System::UInt64>()
 	{
 		if (Handle)
 		{
@@ -2841,7 +3990,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Byte>& IComparable_1<System::Byte>::operator=(const IComparable_1<System::Byte>& other)
+	IEquatable_1<System::UInt64>& IEquatable_1<System::UInt64>::operator=(const IEquatable_1<System::UInt64>& other)
 	{
 		if (this->Handle)
 		{
@@ -2855,7 +4004,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Byte>& IComparable_1<System::Byte>::operator=(decltype(nullptr))
+	IEquatable_1<System::UInt64>& IEquatable_1<System::UInt64>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2865,7 +4014,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Byte>& IComparable_1<System::Byte>::operator=(IComparable_1<System::Byte>&& other)
+	IEquatable_1<System::UInt64>& IEquatable_1<System::UInt64>::operator=(IEquatable_1<System::UInt64>&& other)
 	{
 		if (Handle)
 		{
@@ -2876,12 +4025,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Byte>::operator==(const IComparable_1<System::Byte>& other) const
+	bool IEquatable_1<System::UInt64>::operator==(const IEquatable_1<System::UInt64>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Byte>::operator!=(const IComparable_1<System::Byte>& other) const
+	bool IEquatable_1<System::UInt64>::operator!=(const IEquatable_1<System::UInt64>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2889,11 +4038,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Int16>::IComparable_1(decltype(nullptr))
+	IEquatable_1<System::Single>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Int16>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Single>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2902,18 +4051,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Int16>::IComparable_1(const IComparable_1<System::Int16>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Single>::IEquatable_1(const IEquatable_1<System::Single>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Int16>::IComparable_1(IComparable_1<System::Int16>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Single>::IEquatable_1(IEquatable_1<System::Single>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Int16>::~IComparable_1<System::Int16>()
+	IEquatable_1<System::Single>::~IEquatable_1<System::Single>()
 	{
 		if (Handle)
 		{
@@ -2922,7 +4071,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Int16>& IComparable_1<System::Int16>::operator=(const IComparable_1<System::Int16>& other)
+	IEquatable_1<System::Single>& IEquatable_1<System::Single>::operator=(const IEquatable_1<System::Single>& other)
 	{
 		if (this->Handle)
 		{
@@ -2936,7 +4085,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Int16>& IComparable_1<System::Int16>::operator=(decltype(nullptr))
+	IEquatable_1<System::Single>& IEquatable_1<System::Single>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -2946,7 +4095,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Int16>& IComparable_1<System::Int16>::operator=(IComparable_1<System::Int16>&& other)
+	IEquatable_1<System::Single>& IEquatable_1<System::Single>::operator=(IEquatable_1<System::Single>&& other)
 	{
 		if (Handle)
 		{
@@ -2957,12 +4106,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Int16>::operator==(const IComparable_1<System::Int16>& other) const
+	bool IEquatable_1<System::Single>::operator==(const IEquatable_1<System::Single>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Int16>::operator!=(const IComparable_1<System::Int16>& other) const
+	bool IEquatable_1<System::Single>::operator!=(const IEquatable_1<System::Single>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -2970,11 +4119,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::UInt16>::IComparable_1(decltype(nullptr))
+	IEquatable_1<System::Double>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::UInt16>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Double>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -2983,18 +4132,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::UInt16>::IComparable_1(const IComparable_1<System::UInt16>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Double>::IEquatable_1(const IEquatable_1<System::Double>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::UInt16>::IComparable_1(IComparable_1<System::UInt16>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Double>::IEquatable_1(IEquatable_1<System::Double>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::UInt16>::~IComparable_1<System::UInt16>()
+	IEquatable_1<System::Double>::~IEquatable_1<System::Double>()
 	{
 		if (Handle)
 		{
@@ -3003,7 +4152,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::UInt16>& IComparable_1<System::UInt16>::operator=(const IComparable_1<System::UInt16>& other)
+	IEquatable_1<System::Double>& IEquatable_1<System::Double>::operator=(const IEquatable_1<System::Double>& other)
 	{
 		if (this->Handle)
 		{
@@ -3017,7 +4166,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::UInt16>& IComparable_1<System::UInt16>::operator=(decltype(nullptr))
+	IEquatable_1<System::Double>& IEquatable_1<System::Double>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3027,7 +4176,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::UInt16>& IComparable_1<System::UInt16>::operator=(IComparable_1<System::UInt16>&& other)
+	IEquatable_1<System::Double>& IEquatable_1<System::Double>::operator=(IEquatable_1<System::Double>&& other)
 	{
 		if (Handle)
 		{
@@ -3038,12 +4187,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::UInt16>::operator==(const IComparable_1<System::UInt16>& other) const
+	bool IEquatable_1<System::Double>::operator==(const IEquatable_1<System::Double>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::UInt16>::operator!=(const IComparable_1<System::UInt16>& other) const
+	bool IEquatable_1<System::Double>::operator!=(const IEquatable_1<System::Double>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3051,11 +4200,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Int32>::IComparable_1(decltype(nullptr))
+	IEquatable_1<System::Decimal>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Int32>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<System::Decimal>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -3064,18 +4213,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Int32>::IComparable_1(const IComparable_1<System::Int32>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Decimal>::IEquatable_1(const IEquatable_1<System::Decimal>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Int32>::IComparable_1(IComparable_1<System::Int32>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<System::Decimal>::IEquatable_1(IEquatable_1<System::Decimal>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Int32>::~IComparable_1<System::Int32>()
+	IEquatable_1<System::Decimal>::~IEquatable_1<System::Decimal>()
 	{
 		if (Handle)
 		{
@@ -3084,7 +4233,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Int32>& IComparable_1<System::Int32>::operator=(const IComparable_1<System::Int32>& other)
+	IEquatable_1<System::Decimal>& IEquatable_1<System::Decimal>::operator=(const IEquatable_1<System::Decimal>& other)
 	{
 		if (this->Handle)
 		{
@@ -3098,7 +4247,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Int32>& IComparable_1<System::Int32>::operator=(decltype(nullptr))
+	IEquatable_1<System::Decimal>& IEquatable_1<System::Decimal>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3108,7 +4257,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Int32>& IComparable_1<System::Int32>::operator=(IComparable_1<System::Int32>&& other)
+	IEquatable_1<System::Decimal>& IEquatable_1<System::Decimal>::operator=(IEquatable_1<System::Decimal>&& other)
 	{
 		if (Handle)
 		{
@@ -3119,12 +4268,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Int32>::operator==(const IComparable_1<System::Int32>& other) const
+	bool IEquatable_1<System::Decimal>::operator==(const IEquatable_1<System::Decimal>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Int32>::operator!=(const IComparable_1<System::Int32>& other) const
+	bool IEquatable_1<System::Decimal>::operator!=(const IEquatable_1<System::Decimal>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3132,11 +4281,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::UInt32>::IComparable_1(decltype(nullptr))
+	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::UInt32>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -3145,18 +4294,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::UInt32>::IComparable_1(const IComparable_1<System::UInt32>& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(const IEquatable_1<UnityEngine::Vector3>& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::UInt32>::IComparable_1(IComparable_1<System::UInt32>&& other)
-		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	IEquatable_1<UnityEngine::Vector3>::IEquatable_1(IEquatable_1<UnityEngine::Vector3>&& other)
+		: IEquatable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::UInt32>::~IComparable_1<System::UInt32>()
+	IEquatable_1<UnityEngine::Vector3>::~IEquatable_1<UnityEngine::Vector3>()
 	{
 		if (Handle)
 		{
@@ -3165,7 +4314,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::UInt32>& IComparable_1<System::UInt32>::operator=(const IComparable_1<System::UInt32>& other)
+	IEquatable_1<UnityEngine::Vector3>& IEquatable_1<UnityEngine::Vector3>::operator=(const IEquatable_1<UnityEngine::Vector3>& other)
 	{
 		if (this->Handle)
 		{
@@ -3179,7 +4328,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::UInt32>& IComparable_1<System::UInt32>::operator=(decltype(nullptr))
+	IEquatable_1<UnityEngine::Vector3>& IEquatable_1<UnityEngine::Vector3>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3189,7 +4338,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::UInt32>& IComparable_1<System::UInt32>::operator=(IComparable_1<System::UInt32>&& other)
+	IEquatable_1<UnityEngine::Vector3>& IEquatable_1<UnityEngine::Vector3>::operator=(IEquatable_1<UnityEngine::Vector3>&& other)
 	{
 		if (Handle)
 		{
@@ -3200,12 +4349,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::UInt32>::operator==(const IComparable_1<System::UInt32>& other) const
+	bool IEquatable_1<UnityEngine::Vector3>::operator==(const IEquatable_1<UnityEngine::Vector3>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::UInt32>::operator!=(const IComparable_1<System::UInt32>& other) const
+	bool IEquatable_1<UnityEngine::Vector3>::operator!=(const IEquatable_1<UnityEngine::Vector3>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3213,11 +4362,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Int64>::IComparable_1(decltype(nullptr))
+	IComparable_1<System::Boolean>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Int64>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IComparable_1<System::Boolean>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -3226,18 +4375,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Int64>::IComparable_1(const IComparable_1<System::Int64>& other)
+	IComparable_1<System::Boolean>::IComparable_1(const IComparable_1<System::Boolean>& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Int64>::IComparable_1(IComparable_1<System::Int64>&& other)
+	IComparable_1<System::Boolean>::IComparable_1(IComparable_1<System::Boolean>&& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Int64>::~IComparable_1<System::Int64>()
+	IComparable_1<System::Boolean>::~IComparable_1<System::Boolean>()
 	{
 		if (Handle)
 		{
@@ -3246,7 +4395,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Int64>& IComparable_1<System::Int64>::operator=(const IComparable_1<System::Int64>& other)
+	IComparable_1<System::Boolean>& IComparable_1<System::Boolean>::operator=(const IComparable_1<System::Boolean>& other)
 	{
 		if (this->Handle)
 		{
@@ -3260,7 +4409,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Int64>& IComparable_1<System::Int64>::operator=(decltype(nullptr))
+	IComparable_1<System::Boolean>& IComparable_1<System::Boolean>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3270,7 +4419,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Int64>& IComparable_1<System::Int64>::operator=(IComparable_1<System::Int64>&& other)
+	IComparable_1<System::Boolean>& IComparable_1<System::Boolean>::operator=(IComparable_1<System::Boolean>&& other)
 	{
 		if (Handle)
 		{
@@ -3281,12 +4430,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Int64>::operator==(const IComparable_1<System::Int64>& other) const
+	bool IComparable_1<System::Boolean>::operator==(const IComparable_1<System::Boolean>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Int64>::operator!=(const IComparable_1<System::Int64>& other) const
+	bool IComparable_1<System::Boolean>::operator!=(const IComparable_1<System::Boolean>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3294,11 +4443,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::UInt64>::IComparable_1(decltype(nullptr))
+	IComparable_1<System::Char>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::UInt64>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IComparable_1<System::Char>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -3307,18 +4456,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::UInt64>::IComparable_1(const IComparable_1<System::UInt64>& other)
+	IComparable_1<System::Char>::IComparable_1(const IComparable_1<System::Char>& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::UInt64>::IComparable_1(IComparable_1<System::UInt64>&& other)
+	IComparable_1<System::Char>::IComparable_1(IComparable_1<System::Char>&& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::UInt64>::~IComparable_1<System::UInt64>()
+	IComparable_1<System::Char>::~IComparable_1<System::Char>()
 	{
 		if (Handle)
 		{
@@ -3327,7 +4476,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::UInt64>& IComparable_1<System::UInt64>::operator=(const IComparable_1<System::UInt64>& other)
+	IComparable_1<System::Char>& IComparable_1<System::Char>::operator=(const IComparable_1<System::Char>& other)
 	{
 		if (this->Handle)
 		{
@@ -3341,7 +4490,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::UInt64>& IComparable_1<System::UInt64>::operator=(decltype(nullptr))
+	IComparable_1<System::Char>& IComparable_1<System::Char>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3351,7 +4500,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::UInt64>& IComparable_1<System::UInt64>::operator=(IComparable_1<System::UInt64>&& other)
+	IComparable_1<System::Char>& IComparable_1<System::Char>::operator=(IComparable_1<System::Char>&& other)
 	{
 		if (Handle)
 		{
@@ -3362,12 +4511,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::UInt64>::operator==(const IComparable_1<System::UInt64>& other) const
+	bool IComparable_1<System::Char>::operator==(const IComparable_1<System::Char>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::UInt64>::operator!=(const IComparable_1<System::UInt64>& other) const
+	bool IComparable_1<System::Char>::operator!=(const IComparable_1<System::Char>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3375,11 +4524,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Single>::IComparable_1(decltype(nullptr))
+	IComparable_1<System::SByte>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Single>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IComparable_1<System::SByte>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -3388,18 +4537,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Single>::IComparable_1(const IComparable_1<System::Single>& other)
+	IComparable_1<System::SByte>::IComparable_1(const IComparable_1<System::SByte>& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Single>::IComparable_1(IComparable_1<System::Single>&& other)
+	IComparable_1<System::SByte>::IComparable_1(IComparable_1<System::SByte>&& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Single>::~IComparable_1<System::Single>()
+	IComparable_1<System::SByte>::~IComparable_1<System::SByte>()
 	{
 		if (Handle)
 		{
@@ -3408,7 +4557,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Single>& IComparable_1<System::Single>::operator=(const IComparable_1<System::Single>& other)
+	IComparable_1<System::SByte>& IComparable_1<System::SByte>::operator=(const IComparable_1<System::SByte>& other)
 	{
 		if (this->Handle)
 		{
@@ -3422,7 +4571,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Single>& IComparable_1<System::Single>::operator=(decltype(nullptr))
+	IComparable_1<System::SByte>& IComparable_1<System::SByte>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3432,7 +4581,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Single>& IComparable_1<System::Single>::operator=(IComparable_1<System::Single>&& other)
+	IComparable_1<System::SByte>& IComparable_1<System::SByte>::operator=(IComparable_1<System::SByte>&& other)
 	{
 		if (Handle)
 		{
@@ -3443,12 +4592,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Single>::operator==(const IComparable_1<System::Single>& other) const
+	bool IComparable_1<System::SByte>::operator==(const IComparable_1<System::SByte>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Single>::operator!=(const IComparable_1<System::Single>& other) const
+	bool IComparable_1<System::SByte>::operator!=(const IComparable_1<System::SByte>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3456,11 +4605,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Double>::IComparable_1(decltype(nullptr))
+	IComparable_1<System::Byte>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Double>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IComparable_1<System::Byte>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -3469,18 +4618,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Double>::IComparable_1(const IComparable_1<System::Double>& other)
+	IComparable_1<System::Byte>::IComparable_1(const IComparable_1<System::Byte>& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Double>::IComparable_1(IComparable_1<System::Double>&& other)
+	IComparable_1<System::Byte>::IComparable_1(IComparable_1<System::Byte>&& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Double>::~IComparable_1<System::Double>()
+	IComparable_1<System::Byte>::~IComparable_1<System::Byte>()
 	{
 		if (Handle)
 		{
@@ -3489,7 +4638,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Double>& IComparable_1<System::Double>::operator=(const IComparable_1<System::Double>& other)
+	IComparable_1<System::Byte>& IComparable_1<System::Byte>::operator=(const IComparable_1<System::Byte>& other)
 	{
 		if (this->Handle)
 		{
@@ -3503,7 +4652,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Double>& IComparable_1<System::Double>::operator=(decltype(nullptr))
+	IComparable_1<System::Byte>& IComparable_1<System::Byte>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3513,7 +4662,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Double>& IComparable_1<System::Double>::operator=(IComparable_1<System::Double>&& other)
+	IComparable_1<System::Byte>& IComparable_1<System::Byte>::operator=(IComparable_1<System::Byte>&& other)
 	{
 		if (Handle)
 		{
@@ -3524,12 +4673,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Double>::operator==(const IComparable_1<System::Double>& other) const
+	bool IComparable_1<System::Byte>::operator==(const IComparable_1<System::Byte>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Double>::operator!=(const IComparable_1<System::Double>& other) const
+	bool IComparable_1<System::Byte>::operator!=(const IComparable_1<System::Byte>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3537,11 +4686,11 @@ namespace System
 
 namespace System
 {
-	IComparable_1<System::Decimal>::IComparable_1(decltype(nullptr))
+	IComparable_1<System::Int16>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	IComparable_1<System::Decimal>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	IComparable_1<System::Int16>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -3550,18 +4699,18 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Decimal>::IComparable_1(const IComparable_1<System::Decimal>& other)
+	IComparable_1<System::Int16>::IComparable_1(const IComparable_1<System::Int16>& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	IComparable_1<System::Decimal>::IComparable_1(IComparable_1<System::Decimal>&& other)
+	IComparable_1<System::Int16>::IComparable_1(IComparable_1<System::Int16>&& other)
 		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	IComparable_1<System::Decimal>::~IComparable_1<System::Decimal>()
+	IComparable_1<System::Int16>::~IComparable_1<System::Int16>()
 	{
 		if (Handle)
 		{
@@ -3570,7 +4719,7 @@ namespace System
 		}
 	}
 	
-	IComparable_1<System::Decimal>& IComparable_1<System::Decimal>::operator=(const IComparable_1<System::Decimal>& other)
+	IComparable_1<System::Int16>& IComparable_1<System::Int16>::operator=(const IComparable_1<System::Int16>& other)
 	{
 		if (this->Handle)
 		{
@@ -3584,7 +4733,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Decimal>& IComparable_1<System::Decimal>::operator=(decltype(nullptr))
+	IComparable_1<System::Int16>& IComparable_1<System::Int16>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -3594,7 +4743,7 @@ namespace System
 		return *this;
 	}
 	
-	IComparable_1<System::Decimal>& IComparable_1<System::Decimal>::operator=(IComparable_1<System::Decimal>&& other)
+	IComparable_1<System::Int16>& IComparable_1<System::Int16>::operator=(IComparable_1<System::Int16>&& other)
 	{
 		if (Handle)
 		{
@@ -3605,12 +4754,12 @@ namespace System
 		return *this;
 	}
 	
-	bool IComparable_1<System::Decimal>::operator==(const IComparable_1<System::Decimal>& other) const
+	bool IComparable_1<System::Int16>::operator==(const IComparable_1<System::Int16>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool IComparable_1<System::Decimal>::operator!=(const IComparable_1<System::Decimal>& other) const
+	bool IComparable_1<System::Int16>::operator!=(const IComparable_1<System::Int16>& other) const
 	{
 		return Handle != other.Handle;
 	}
@@ -3618,476 +4767,335 @@ namespace System
 
 namespace System
 {
-	namespace Runtime
-	{
-		namespace Serialization
-		{
-			IDeserializationCallback::IDeserializationCallback(decltype(nullptr))
-			{
-			}
-			
-			IDeserializationCallback::IDeserializationCallback(Plugin::InternalUse, int32_t handle)
-			{
-				Handle = handle;
-				if (handle)
-				{
-					Plugin::ReferenceManagedClass(handle);
-				}
-			}
-			
-			IDeserializationCallback::IDeserializationCallback(const IDeserializationCallback& other)
-				: IDeserializationCallback(Plugin::InternalUse::Only, other.Handle)
-			{
-			}
-			
-			IDeserializationCallback::IDeserializationCallback(IDeserializationCallback&& other)
-				: IDeserializationCallback(Plugin::InternalUse::Only, other.Handle)
-			{
-				other.Handle = 0;
-			}
-			
-			IDeserializationCallback::~IDeserializationCallback()
-			{
-				if (Handle)
-				{
-					Plugin::DereferenceManagedClass(Handle);
-					Handle = 0;
-				}
-			}
-			
-			IDeserializationCallback& IDeserializationCallback::operator=(const IDeserializationCallback& other)
-			{
-				if (this->Handle)
-				{
-					Plugin::DereferenceManagedClass(this->Handle);
-				}
-				this->Handle = other.Handle;
-				if (this->Handle)
-				{
-					Plugin::ReferenceManagedClass(this->Handle);
-				}
-				return *this;
-			}
-			
-			IDeserializationCallback& IDeserializationCallback::operator=(decltype(nullptr))
-			{
-				if (Handle)
-				{
-					Plugin::DereferenceManagedClass(Handle);
-					Handle = 0;
-				}
-				return *this;
-			}
-			
-			IDeserializationCallback& IDeserializationCallback::operator=(IDeserializationCallback&& other)
-			{
-				if (Handle)
-				{
-					Plugin::DereferenceManagedClass(Handle);
-				}
-				Handle = other.Handle;
-				other.Handle = 0;
-				return *this;
-			}
-			
-			bool IDeserializationCallback::operator==(const IDeserializationCallback& other) const
-			{
-				return Handle == other.Handle;
-			}
-			
-			bool IDeserializationCallback::operator!=(const IDeserializationCallback& other) const
-			{
-				return Handle != other.Handle;
-			}
-		}
-	}
-}
-
-namespace System
-{
-	Decimal::Decimal(decltype(nullptr))
+	IComparable_1<System::UInt16>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	Decimal::Decimal(Plugin::InternalUse, int32_t handle)
+	IComparable_1<System::UInt16>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
 		{
-			Plugin::ReferenceManagedSystemDecimal(Handle);
+			Plugin::ReferenceManagedClass(handle);
 		}
 	}
 	
-	Decimal::Decimal(const Decimal& other)
-		: Decimal(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::UInt16>::IComparable_1(const IComparable_1<System::UInt16>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	Decimal::Decimal(Decimal&& other)
-		: Decimal(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::UInt16>::IComparable_1(IComparable_1<System::UInt16>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	Decimal::~Decimal()
+	IComparable_1<System::UInt16>::~IComparable_1<System::UInt16>()
 	{
 		if (Handle)
 		{
-			Plugin::DereferenceManagedSystemDecimal(Handle);
+			Plugin::DereferenceManagedClass(Handle);
 			Handle = 0;
 		}
 	}
 	
-	Decimal& Decimal::operator=(const Decimal& other)
+	IComparable_1<System::UInt16>& IComparable_1<System::UInt16>::operator=(const IComparable_1<System::UInt16>& other)
 	{
 		if (this->Handle)
 		{
-			Plugin::DereferenceManagedSystemDecimal(Handle);
+			Plugin::DereferenceManagedClass(this->Handle);
 		}
 		this->Handle = other.Handle;
 		if (this->Handle)
 		{
-			Plugin::ReferenceManagedSystemDecimal(Handle);
+			Plugin::ReferenceManagedClass(this->Handle);
 		}
 		return *this;
 	}
 	
-	Decimal& Decimal::operator=(decltype(nullptr))
+	IComparable_1<System::UInt16>& IComparable_1<System::UInt16>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
-			Plugin::DereferenceManagedSystemDecimal(Handle);
+			Plugin::DereferenceManagedClass(Handle);
 			Handle = 0;
 		}
 		return *this;
 	}
 	
-	Decimal& Decimal::operator=(Decimal&& other)
+	IComparable_1<System::UInt16>& IComparable_1<System::UInt16>::operator=(IComparable_1<System::UInt16>&& other)
 	{
 		if (Handle)
 		{
-			Plugin::DereferenceManagedSystemDecimal(Handle);
+			Plugin::DereferenceManagedClass(Handle);
 		}
 		Handle = other.Handle;
 		other.Handle = 0;
 		return *this;
 	}
 	
-	bool Decimal::operator==(const Decimal& other) const
+	bool IComparable_1<System::UInt16>::operator==(const IComparable_1<System::UInt16>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool Decimal::operator!=(const Decimal& other) const
+	bool IComparable_1<System::UInt16>::operator!=(const IComparable_1<System::UInt16>& other) const
 	{
 		return Handle != other.Handle;
 	}
-	
-	System::Decimal::Decimal(System::Double value)
+}
+
+namespace System
+{
+	IComparable_1<System::Int32>::IComparable_1(decltype(nullptr))
 	{
-		auto returnValue = Plugin::SystemDecimalConstructorSystemDouble(value);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		Handle = returnValue;
-		if (returnValue)
-		{
-			Plugin::ReferenceManagedSystemDecimal(Handle);
-		}
 	}
 	
-	System::Decimal::Decimal(System::UInt64 value)
+	IComparable_1<System::Int32>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
-		auto returnValue = Plugin::SystemDecimalConstructorSystemUInt64(value);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		Handle = returnValue;
-		if (returnValue)
+		Handle = handle;
+		if (handle)
 		{
-			Plugin::ReferenceManagedSystemDecimal(Handle);
+			Plugin::ReferenceManagedClass(handle);
 		}
 	}
 	
-	System::Decimal::operator System::ValueType()
+	IComparable_1<System::Int32>::IComparable_1(const IComparable_1<System::Int32>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
-		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::ValueType(Plugin::InternalUse::Only, handle);
-		}
-		return nullptr;
 	}
 	
-	System::Decimal::operator System::Object()
+	IComparable_1<System::Int32>::IComparable_1(IComparable_1<System::Int32>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
-		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::Object(Plugin::InternalUse::Only, handle);
-		}
-		return nullptr;
+		other.Handle = 0;
 	}
 	
-	System::Decimal::operator System::IComparable()
+	IComparable_1<System::Int32>::~IComparable_1<System::Int32>()
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IComparable(Plugin::InternalUse::Only, handle);
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
-		return nullptr;
 	}
 	
-	System::Decimal::operator System::IComparable_1<System::Decimal>()
+	IComparable_1<System::Int32>& IComparable_1<System::Int32>::operator=(const IComparable_1<System::Int32>& other)
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
+		if (this->Handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::DereferenceManagedClass(this->Handle);
 		}
-		if (handle)
+		this->Handle = other.Handle;
+		if (this->Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IComparable_1<System::Decimal>(Plugin::InternalUse::Only, handle);
+			Plugin::ReferenceManagedClass(this->Handle);
 		}
-		return nullptr;
+		return *this;
 	}
 	
-	System::Decimal::operator System::IConvertible()
+	IComparable_1<System::Int32>& IComparable_1<System::Int32>::operator=(decltype(nullptr))
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IConvertible(Plugin::InternalUse::Only, handle);
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
-		return nullptr;
+		return *this;
 	}
 	
-	System::Decimal::operator System::IEquatable_1<System::Decimal>()
+	IComparable_1<System::Int32>& IComparable_1<System::Int32>::operator=(IComparable_1<System::Int32>&& other)
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IEquatable_1<System::Decimal>(Plugin::InternalUse::Only, handle);
+			Plugin::DereferenceManagedClass(Handle);
 		}
-		return nullptr;
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
 	}
 	
-	System::Decimal::operator System::Runtime::Serialization::IDeserializationCallback()
+	bool IComparable_1<System::Int32>::operator==(const IComparable_1<System::Int32>& other) const
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
-		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::Runtime::Serialization::IDeserializationCallback(Plugin::InternalUse::Only, handle);
-		}
-		return nullptr;
+		return Handle == other.Handle;
 	}
 	
-	System::Decimal::operator System::IFormattable()
+	bool IComparable_1<System::Int32>::operator!=(const IComparable_1<System::Int32>& other) const
 	{
-		int32_t handle = Plugin::BoxDecimal(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
-		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IFormattable(Plugin::InternalUse::Only, handle);
-		}
-		return nullptr;
+		return Handle != other.Handle;
 	}
 }
 
 namespace System
 {
-	System::Object::operator System::Decimal()
+	IComparable_1<System::UInt32>::IComparable_1(decltype(nullptr))
 	{
-		System::Decimal returnVal(Plugin::InternalUse::Only, Plugin::UnboxDecimal(Handle));
-		if (Plugin::unhandledCsharpException)
+	}
+	
+	IComparable_1<System::UInt32>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	{
+		Handle = handle;
+		if (handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ReferenceManagedClass(handle);
 		}
-		return returnVal;
 	}
-}
-
-namespace UnityEngine
-{
-	Vector3::Vector3()
+	
+	IComparable_1<System::UInt32>::IComparable_1(const IComparable_1<System::UInt32>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	UnityEngine::Vector3::Vector3(System::Single x, System::Single y, System::Single z)
+	IComparable_1<System::UInt32>::IComparable_1(IComparable_1<System::UInt32>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
-		auto returnValue = Plugin::UnityEngineVector3ConstructorSystemSingle_SystemSingle_SystemSingle(x, y, z);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		*this = returnValue;
+		other.Handle = 0;
 	}
 	
-	UnityEngine::Vector3 UnityEngine::Vector3::operator+(UnityEngine::Vector3& a)
+	IComparable_1<System::UInt32>::~IComparable_1<System::UInt32>()
 	{
-		auto returnValue = Plugin::UnityEngineVector3Methodop_AdditionUnityEngineVector3_UnityEngineVector3(*this, a);
-		if (Plugin::unhandledCsharpException)
+		if (Handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
-		return returnValue;
 	}
 	
-	UnityEngine::Vector3::operator System::ValueType()
+	IComparable_1<System::UInt32>& IComparable_1<System::UInt32>::operator=(const IComparable_1<System::UInt32>& other)
 	{
-		int32_t handle = Plugin::BoxVector3(*this);
-		if (Plugin::unhandledCsharpException)
+		if (this->Handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::DereferenceManagedClass(this->Handle);
 		}
-		if (handle)
+		this->Handle = other.Handle;
+		if (this->Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::ValueType(Plugin::InternalUse::Only, handle);
+			Plugin::ReferenceManagedClass(this->Handle);
 		}
-		return nullptr;
+		return *this;
 	}
 	
-	UnityEngine::Vector3::operator System::Object()
+	IComparable_1<System::UInt32>& IComparable_1<System::UInt32>::operator=(decltype(nullptr))
 	{
-		int32_t handle = Plugin::BoxVector3(*this);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::Object(Plugin::InternalUse::Only, handle);
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
-		return nullptr;
+		return *this;
 	}
 	
-	UnityEngine::Vector3::operator System::IEquatable_1<UnityEngine::Vector3>()
+	IComparable_1<System::UInt32>& IComparable_1<System::UInt32>::operator=(IComparable_1<System::UInt32>&& other)
 	{
-		int32_t handle = Plugin::BoxVector3(*this);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IEquatable_1<UnityEngine::Vector3>(Plugin::InternalUse::Only, handle);
+			Plugin::DereferenceManagedClass(Handle);
 		}
-		return nullptr;
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool IComparable_1<System::UInt32>::operator==(const IComparable_1<System::UInt32>& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool IComparable_1<System::UInt32>::operator!=(const IComparable_1<System::UInt32>& other) const
+	{
+		return Handle != other.Handle;
 	}
 }
 
 namespace System
 {
-	System::Object::operator UnityEngine::Vector3()
+	IComparable_1<System::Int64>::IComparable_1(decltype(nullptr))
 	{
-		UnityEngine::Vector3 returnVal(Plugin::UnboxVector3(Handle));
-		if (Plugin::unhandledCsharpException)
+	}
+	
+	IComparable_1<System::Int64>::IComparable_1(Plugin::InternalUse, int32_t handle)
+	{
+		Handle = handle;
+		if (handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ReferenceManagedClass(handle);
 		}
-		return returnVal;
+	}
+	
+	IComparable_1<System::Int64>::IComparable_1(const IComparable_1<System::Int64>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	IComparable_1<System::Int64>::IComparable_1(IComparable_1<System::Int64>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	IComparable_1<System::Int64>::~IComparable_1<System::Int64>()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	IComparable_1<System::Int64>& IComparable_1<System::Int64>::operator=(const IComparable_1<System::Int64>& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	IComparable_1<System::Int64>& IComparable_1<System::Int64>::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	IComparable_1<System::Int64>& IComparable_1<System::Int64>::operator=(IComparable_1<System::Int64>&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool IComparable_1<System::Int64>::operator==(const IComparable_1<System::Int64>& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool IComparable_1<System::Int64>::operator!=(const IComparable_1<System::Int64>& other) const
+	{
+		return Handle != other.Handle;
 	}
 }
 
-namespace UnityEngine
+namespace System
 {
-	Object::Object(decltype(nullptr))
+	IComparable_1<System::UInt64>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	Object::Object(Plugin::InternalUse, int32_t handle)
+	IComparable_1<System::UInt64>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -4096,18 +5104,18 @@ namespace UnityEngine
 		}
 	}
 	
-	Object::Object(const Object& other)
-		: Object(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::UInt64>::IComparable_1(const IComparable_1<System::UInt64>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	Object::Object(Object&& other)
-		: Object(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::UInt64>::IComparable_1(IComparable_1<System::UInt64>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	Object::~Object()
+	IComparable_1<System::UInt64>::~IComparable_1<System::UInt64>()
 	{
 		if (Handle)
 		{
@@ -4116,7 +5124,7 @@ namespace UnityEngine
 		}
 	}
 	
-	Object& Object::operator=(const Object& other)
+	IComparable_1<System::UInt64>& IComparable_1<System::UInt64>::operator=(const IComparable_1<System::UInt64>& other)
 	{
 		if (this->Handle)
 		{
@@ -4130,7 +5138,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	Object& Object::operator=(decltype(nullptr))
+	IComparable_1<System::UInt64>& IComparable_1<System::UInt64>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -4140,7 +5148,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	Object& Object::operator=(Object&& other)
+	IComparable_1<System::UInt64>& IComparable_1<System::UInt64>::operator=(IComparable_1<System::UInt64>&& other)
 	{
 		if (Handle)
 		{
@@ -4151,51 +5159,24 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	bool Object::operator==(const Object& other) const
+	bool IComparable_1<System::UInt64>::operator==(const IComparable_1<System::UInt64>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool Object::operator!=(const Object& other) const
+	bool IComparable_1<System::UInt64>::operator!=(const IComparable_1<System::UInt64>& other) const
 	{
 		return Handle != other.Handle;
 	}
-	
-	System::String UnityEngine::Object::GetName()
-	{
-		auto returnValue = Plugin::UnityEngineObjectPropertyGetName(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return System::String(Plugin::InternalUse::Only, returnValue);
-	}
-	
-	void UnityEngine::Object::SetName(System::String& value)
-	{
-		Plugin::UnityEngineObjectPropertySetName(Handle, value.Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-	}
 }
 
-namespace UnityEngine
+namespace System
 {
-	Component::Component(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
+	IComparable_1<System::Single>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	Component::Component(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
+	IComparable_1<System::Single>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -4204,18 +5185,18 @@ namespace UnityEngine
 		}
 	}
 	
-	Component::Component(const Component& other)
-		: Component(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::Single>::IComparable_1(const IComparable_1<System::Single>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	Component::Component(Component&& other)
-		: Component(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::Single>::IComparable_1(IComparable_1<System::Single>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	Component::~Component()
+	IComparable_1<System::Single>::~IComparable_1<System::Single>()
 	{
 		if (Handle)
 		{
@@ -4224,7 +5205,7 @@ namespace UnityEngine
 		}
 	}
 	
-	Component& Component::operator=(const Component& other)
+	IComparable_1<System::Single>& IComparable_1<System::Single>::operator=(const IComparable_1<System::Single>& other)
 	{
 		if (this->Handle)
 		{
@@ -4238,7 +5219,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	Component& Component::operator=(decltype(nullptr))
+	IComparable_1<System::Single>& IComparable_1<System::Single>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -4248,7 +5229,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	Component& Component::operator=(Component&& other)
+	IComparable_1<System::Single>& IComparable_1<System::Single>::operator=(IComparable_1<System::Single>&& other)
 	{
 		if (Handle)
 		{
@@ -4259,43 +5240,24 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	bool Component::operator==(const Component& other) const
+	bool IComparable_1<System::Single>::operator==(const IComparable_1<System::Single>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool Component::operator!=(const Component& other) const
+	bool IComparable_1<System::Single>::operator!=(const IComparable_1<System::Single>& other) const
 	{
 		return Handle != other.Handle;
 	}
-	
-	UnityEngine::Transform UnityEngine::Component::GetTransform()
-	{
-		auto returnValue = Plugin::UnityEngineComponentPropertyGetTransform(Handle);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return UnityEngine::Transform(Plugin::InternalUse::Only, returnValue);
-	}
 }
 
-namespace UnityEngine
+namespace System
 {
-	Transform::Transform(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, System::Collections::IEnumerable(nullptr)
+	IComparable_1<System::Double>::IComparable_1(decltype(nullptr))
 	{
 	}
 	
-	Transform::Transform(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, System::Collections::IEnumerable(nullptr)
+	IComparable_1<System::Double>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -4304,18 +5266,18 @@ namespace UnityEngine
 		}
 	}
 	
-	Transform::Transform(const Transform& other)
-		: Transform(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::Double>::IComparable_1(const IComparable_1<System::Double>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	Transform::Transform(Transform&& other)
-		: Transform(Plugin::InternalUse::Only, other.Handle)
+	IComparable_1<System::Double>::IComparable_1(IComparable_1<System::Double>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	Transform::~Transform()
+	IComparable_1<System::Double>::~IComparable_1<System::Double>()
 	{
 		if (Handle)
 		{
@@ -4324,7 +5286,7 @@ namespace UnityEngine
 		}
 	}
 	
-	Transform& Transform::operator=(const Transform& other)
+	IComparable_1<System::Double>& IComparable_1<System::Double>::operator=(const IComparable_1<System::Double>& other)
 	{
 		if (this->Handle)
 		{
@@ -4338,7 +5300,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	Transform& Transform::operator=(decltype(nullptr))
+	IComparable_1<System::Double>& IComparable_1<System::Double>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -4348,7 +5310,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	Transform& Transform::operator=(Transform&& other)
+	IComparable_1<System::Double>& IComparable_1<System::Double>::operator=(IComparable_1<System::Double>&& other)
 	{
 		if (Handle)
 		{
@@ -4359,236 +5321,95 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	bool Transform::operator==(const Transform& other) const
+	bool IComparable_1<System::Double>::operator==(const IComparable_1<System::Double>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool Transform::operator!=(const Transform& other) const
+	bool IComparable_1<System::Double>::operator!=(const IComparable_1<System::Double>& other) const
 	{
 		return Handle != other.Handle;
 	}
+}
+
+namespace System
+{
+	IComparable_1<System::Decimal>::IComparable_1(decltype(nullptr))
+	{
+	}
 	
-	UnityEngine::Vector3 UnityEngine::Transform::GetPosition()
+	IComparable_1<System::Decimal>::IComparable_1(Plugin::InternalUse, int32_t handle)
 	{
-		auto returnValue = Plugin::UnityEngineTransformPropertyGetPosition(Handle);
-		if (Plugin::unhandledCsharpException)
+		Handle = handle;
+		if (handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ReferenceManagedClass(handle);
 		}
-		return returnValue;
 	}
 	
-	void UnityEngine::Transform::SetPosition(UnityEngine::Vector3& value)
+	IComparable_1<System::Decimal>::IComparable_1(const IComparable_1<System::Decimal>& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
 	{
-		Plugin::UnityEngineTransformPropertySetPosition(Handle, value);
-		if (Plugin::unhandledCsharpException)
+	}
+	
+	IComparable_1<System::Decimal>::IComparable_1(IComparable_1<System::Decimal>&& other)
+		: IComparable_1(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	IComparable_1<System::Decimal>::~IComparable_1<System::Decimal>()
+	{
+		if (Handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
 	}
-}
-
-namespace System
-{
-	namespace Collections
+	
+	IComparable_1<System::Decimal>& IComparable_1<System::Decimal>::operator=(const IComparable_1<System::Decimal>& other)
 	{
-		IEnumerator::IEnumerator(decltype(nullptr))
+		if (this->Handle)
 		{
+			Plugin::DereferenceManagedClass(this->Handle);
 		}
-		
-		IEnumerator::IEnumerator(Plugin::InternalUse, int32_t handle)
+		this->Handle = other.Handle;
+		if (this->Handle)
 		{
-			Handle = handle;
-			if (handle)
-			{
-				Plugin::ReferenceManagedClass(handle);
-			}
+			Plugin::ReferenceManagedClass(this->Handle);
 		}
-		
-		IEnumerator::IEnumerator(const IEnumerator& other)
-			: IEnumerator(Plugin::InternalUse::Only, other.Handle)
+		return *this;
+	}
+	
+	IComparable_1<System::Decimal>& IComparable_1<System::Decimal>::operator=(decltype(nullptr))
+	{
+		if (Handle)
 		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
-		
-		IEnumerator::IEnumerator(IEnumerator&& other)
-			: IEnumerator(Plugin::InternalUse::Only, other.Handle)
+		return *this;
+	}
+	
+	IComparable_1<System::Decimal>& IComparable_1<System::Decimal>::operator=(IComparable_1<System::Decimal>&& other)
+	{
+		if (Handle)
 		{
-			other.Handle = 0;
-		}
-		
-		IEnumerator::~IEnumerator()
-		{
-			if (Handle)
-			{
-				Plugin::DereferenceManagedClass(Handle);
-				Handle = 0;
-			}
-		}
-		
-		IEnumerator& IEnumerator::operator=(const IEnumerator& other)
-		{
-			if (this->Handle)
-			{
-				Plugin::DereferenceManagedClass(this->Handle);
-			}
-			this->Handle = other.Handle;
-			if (this->Handle)
-			{
-				Plugin::ReferenceManagedClass(this->Handle);
-			}
-			return *this;
-		}
-		
-		IEnumerator& IEnumerator::operator=(decltype(nullptr))
-		{
-			if (Handle)
-			{
-				Plugin::DereferenceManagedClass(Handle);
-				Handle = 0;
-			}
-			return *this;
-		}
-		
-		IEnumerator& IEnumerator::operator=(IEnumerator&& other)
-		{
-			if (Handle)
-			{
-				Plugin::DereferenceManagedClass(Handle);
-			}
-			Handle = other.Handle;
-			other.Handle = 0;
-			return *this;
-		}
-		
-		bool IEnumerator::operator==(const IEnumerator& other) const
-		{
-			return Handle == other.Handle;
-		}
-		
-		bool IEnumerator::operator!=(const IEnumerator& other) const
-		{
-			return Handle != other.Handle;
-		}
-		
-		System::Object System::Collections::IEnumerator::GetCurrent()
-		{
-			auto returnValue = Plugin::SystemCollectionsIEnumeratorPropertyGetCurrent(Handle);
-			if (Plugin::unhandledCsharpException)
-			{
-				System::Exception* ex = Plugin::unhandledCsharpException;
-				Plugin::unhandledCsharpException = nullptr;
-				ex->ThrowReferenceToThis();
-				delete ex;
-			}
-			return System::Object(Plugin::InternalUse::Only, returnValue);
-		}
-		
-		System::Boolean System::Collections::IEnumerator::MoveNext()
-		{
-			auto returnValue = Plugin::SystemCollectionsIEnumeratorMethodMoveNext(Handle);
-			if (Plugin::unhandledCsharpException)
-			{
-				System::Exception* ex = Plugin::unhandledCsharpException;
-				Plugin::unhandledCsharpException = nullptr;
-				ex->ThrowReferenceToThis();
-				delete ex;
-			}
-			return returnValue;
+			Plugin::DereferenceManagedClass(Handle);
 		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
 	}
-}
-
-namespace System
-{
-	namespace Runtime
+	
+	bool IComparable_1<System::Decimal>::operator==(const IComparable_1<System::Decimal>& other) const
 	{
-		namespace Serialization
-		{
-			ISerializable::ISerializable(decltype(nullptr))
-			{
-			}
-			
-			ISerializable::ISerializable(Plugin::InternalUse, int32_t handle)
-			{
-				Handle = handle;
-				if (handle)
-				{
-					Plugin::ReferenceManagedClass(handle);
-				}
-			}
-			
-			ISerializable::ISerializable(const ISerializable& other)
-				: ISerializable(Plugin::InternalUse::Only, other.Handle)
-			{
-			}
-			
-			ISerializable::ISerializable(ISerializable&& other)
-				: ISerializable(Plugin::InternalUse::Only, other.Handle)
-			{
-				other.Handle = 0;
-			}
-			
-			ISerializable::~ISerializable()
-			{
-				if (Handle)
-				{
-					Plugin::DereferenceManagedClass(Handle);
-					Handle = 0;
-				}
-			}
-			
-			ISerializable& ISerializable::operator=(const ISerializable& other)
-			{
-				if (this->Handle)
-				{
-					Plugin::DereferenceManagedClass(this->Handle);
-				}
-				this->Handle = other.Handle;
-				if (this->Handle)
-				{
-					Plugin::ReferenceManagedClass(this->Handle);
-				}
-				return *this;
-			}
-			
-			ISerializable& ISerializable::operator=(decltype(nullptr))
-			{
-				if (Handle)
-				{
-					Plugin::DereferenceManagedClass(Handle);
-					Handle = 0;
-				}
-				return *this;
-			}
-			
-			ISerializable& ISerializable::operator=(ISerializable&& other)
-			{
-				if (Handle)
-				{
-					Plugin::DereferenceManagedClass(Handle);
-				}
-				Handle = other.Handle;
-				other.Handle = 0;
-				return *this;
-			}
-			
-			bool ISerializable::operator==(const ISerializable& other) const
-			{
-				return Handle == other.Handle;
-			}
-			
-			bool ISerializable::operator!=(const ISerializable& other) const
-			{
-				return Handle != other.Handle;
-			}
-		}
+		return Handle == other.Handle;
+	}
+	
+	bool IComparable_1<System::Decimal>::operator!=(const IComparable_1<System::Decimal>& other) const
+	{
+		return Handle != other.Handle;
 	}
 }
 
@@ -4596,13 +5417,13 @@ namespace System
 {
 	namespace Runtime
 	{
-		namespace InteropServices
+		namespace Serialization
 		{
-			_Exception::_Exception(decltype(nullptr))
+			IDeserializationCallback::IDeserializationCallback(decltype(nullptr))
 			{
 			}
 			
-			_Exception::_Exception(Plugin::InternalUse, int32_t handle)
+			IDeserializationCallback::IDeserializationCallback(Plugin::InternalUse, int32_t handle)
 			{
 				Handle = handle;
 				if (handle)
@@ -4611,18 +5432,18 @@ namespace System
 				}
 			}
 			
-			_Exception::_Exception(const _Exception& other)
-				: _Exception(Plugin::InternalUse::Only, other.Handle)
+			IDeserializationCallback::IDeserializationCallback(const IDeserializationCallback& other)
+				: IDeserializationCallback(Plugin::InternalUse::Only, other.Handle)
 			{
 			}
 			
-			_Exception::_Exception(_Exception&& other)
-				: _Exception(Plugin::InternalUse::Only, other.Handle)
+			IDeserializationCallback::IDeserializationCallback(IDeserializationCallback&& other)
+				: IDeserializationCallback(Plugin::InternalUse::Only, other.Handle)
 			{
 				other.Handle = 0;
 			}
 			
-			_Exception::~_Exception()
+			IDeserializationCallback::~IDeserializationCallback()
 			{
 				if (Handle)
 				{
@@ -4631,7 +5452,7 @@ namespace System
 				}
 			}
 			
-			_Exception& _Exception::operator=(const _Exception& other)
+			IDeserializationCallback& IDeserializationCallback::operator=(const IDeserializationCallback& other)
 			{
 				if (this->Handle)
 				{
@@ -4645,7 +5466,7 @@ namespace System
 				return *this;
 			}
 			
-			_Exception& _Exception::operator=(decltype(nullptr))
+			IDeserializationCallback& IDeserializationCallback::operator=(decltype(nullptr))
 			{
 				if (Handle)
 				{
@@ -4655,7 +5476,7 @@ namespace System
 				return *this;
 			}
 			
-			_Exception& _Exception::operator=(_Exception&& other)
+			IDeserializationCallback& IDeserializationCallback::operator=(IDeserializationCallback&& other)
 			{
 				if (Handle)
 				{
@@ -4666,12 +5487,12 @@ namespace System
 				return *this;
 			}
 			
-			bool _Exception::operator==(const _Exception& other) const
+			bool IDeserializationCallback::operator==(const IDeserializationCallback& other) const
 			{
 				return Handle == other.Handle;
 			}
 			
-			bool _Exception::operator!=(const _Exception& other) const
+			bool IDeserializationCallback::operator!=(const IDeserializationCallback& other) const
 			{
 				return Handle != other.Handle;
 			}
@@ -4679,306 +5500,340 @@ namespace System
 	}
 }
 
-namespace UnityEngine
+namespace System
 {
-	GameObject::GameObject(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
+	Decimal::Decimal(decltype(nullptr))
 	{
 	}
 	
-	GameObject::GameObject(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
+	Decimal::Decimal(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			Plugin::ReferenceManagedSystemDecimal(Handle);
 		}
 	}
 	
-	GameObject::GameObject(const GameObject& other)
-		: GameObject(Plugin::InternalUse::Only, other.Handle)
+	Decimal::Decimal(const Decimal& other)
+		: Decimal(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	GameObject::GameObject(GameObject&& other)
-		: GameObject(Plugin::InternalUse::Only, other.Handle)
+	Decimal::Decimal(Decimal&& other)
+		: Decimal(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	GameObject::~GameObject()
+	Decimal::~Decimal()
 	{
 		if (Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			Plugin::DereferenceManagedSystemDecimal(Handle);
 			Handle = 0;
 		}
 	}
 	
-	GameObject& GameObject::operator=(const GameObject& other)
+	Decimal& Decimal::operator=(const Decimal& other)
 	{
 		if (this->Handle)
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			Plugin::DereferenceManagedSystemDecimal(Handle);
 		}
 		this->Handle = other.Handle;
 		if (this->Handle)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			Plugin::ReferenceManagedSystemDecimal(Handle);
 		}
 		return *this;
 	}
 	
-	GameObject& GameObject::operator=(decltype(nullptr))
+	Decimal& Decimal::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			Plugin::DereferenceManagedSystemDecimal(Handle);
 			Handle = 0;
 		}
 		return *this;
 	}
 	
-	GameObject& GameObject::operator=(GameObject&& other)
+	Decimal& Decimal::operator=(Decimal&& other)
 	{
 		if (Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			Plugin::DereferenceManagedSystemDecimal(Handle);
 		}
 		Handle = other.Handle;
 		other.Handle = 0;
 		return *this;
 	}
 	
-	bool GameObject::operator==(const GameObject& other) const
+	bool Decimal::operator==(const Decimal& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool GameObject::operator!=(const GameObject& other) const
+	bool Decimal::operator!=(const Decimal& other) const
 	{
 		return Handle != other.Handle;
 	}
 	
-	template<> MyGame::BaseBallScript UnityEngine::GameObject::AddComponent<MyGame::BaseBallScript>()
+	System::Decimal::Decimal(System::Double value)
 	{
-		auto returnValue = Plugin::UnityEngineGameObjectMethodAddComponentMyGameBaseBallScript(Handle);
+		auto returnValue = Plugin::SystemDecimalConstructorSystemDouble(value);
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		Handle = returnValue;
+		if (returnValue)
+		{
+			Plugin::ReferenceManagedSystemDecimal(Handle);
 		}
-		return MyGame::BaseBallScript(Plugin::InternalUse::Only, returnValue);
 	}
 	
-	UnityEngine::GameObject UnityEngine::GameObject::CreatePrimitive(UnityEngine::PrimitiveType type)
+	System::Decimal::Decimal(System::UInt64 value)
 	{
-		auto returnValue = Plugin::UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveType(type);
+		auto returnValue = Plugin::SystemDecimalConstructorSystemUInt64(value);
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		Handle = returnValue;
+		if (returnValue)
+		{
+			Plugin::ReferenceManagedSystemDecimal(Handle);
 		}
-		return UnityEngine::GameObject(Plugin::InternalUse::Only, returnValue);
-	}
-}
-
-namespace UnityEngine
-{
-	Debug::Debug(decltype(nullptr))
-	{
 	}
 	
-	Debug::Debug(Plugin::InternalUse, int32_t handle)
+	System::Decimal::operator System::ValueType()
 	{
-		Handle = handle;
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
 		if (handle)
 		{
 			Plugin::ReferenceManagedClass(handle);
+			return System::ValueType(Plugin::InternalUse::Only, handle);
 		}
+		return nullptr;
 	}
 	
-	Debug::Debug(const Debug& other)
-		: Debug(Plugin::InternalUse::Only, other.Handle)
-	{
-	}
-	
-	Debug::Debug(Debug&& other)
-		: Debug(Plugin::InternalUse::Only, other.Handle)
+	System::Decimal::operator System::Object()
 	{
-		other.Handle = 0;
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::Object(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
 	}
 	
-	Debug::~Debug()
+	System::Decimal::operator System::IComparable()
 	{
-		if (Handle)
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IComparable(Plugin::InternalUse::Only, handle);
 		}
+		return nullptr;
 	}
 	
-	Debug& Debug::operator=(const Debug& other)
+	System::Decimal::operator System::IComparable_1<System::Decimal>()
 	{
-		if (this->Handle)
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		if (handle)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			Plugin::ReferenceManagedClass(handle);
+			return System::IComparable_1<System::Decimal>(Plugin::InternalUse::Only, handle);
 		}
-		return *this;
+		return nullptr;
 	}
 	
-	Debug& Debug::operator=(decltype(nullptr))
+	System::Decimal::operator System::IConvertible()
 	{
-		if (Handle)
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		return *this;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IConvertible(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
 	}
 	
-	Debug& Debug::operator=(Debug&& other)
+	System::Decimal::operator System::IEquatable_1<System::Decimal>()
 	{
-		if (Handle)
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IEquatable_1<System::Decimal>(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
 	}
 	
-	bool Debug::operator==(const Debug& other) const
+	System::Decimal::operator System::Runtime::Serialization::IDeserializationCallback()
 	{
-		return Handle == other.Handle;
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::Runtime::Serialization::IDeserializationCallback(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
 	}
 	
-	bool Debug::operator!=(const Debug& other) const
+	System::Decimal::operator System::IFormattable()
 	{
-		return Handle != other.Handle;
+		int32_t handle = Plugin::BoxDecimal(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IFormattable(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
 	}
-	
-	void UnityEngine::Debug::Log(System::Object& message)
+}
+
+namespace System
+{
+	System::Object::operator System::Decimal()
 	{
-		Plugin::UnityEngineDebugMethodLogSystemObject(message.Handle);
+		System::Decimal returnVal(Plugin::InternalUse::Only, Plugin::UnboxDecimal(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return returnVal;
 	}
 }
 
 namespace UnityEngine
 {
-	Behaviour::Behaviour(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
+	Vector3::Vector3()
 	{
 	}
 	
-	Behaviour::Behaviour(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
+	UnityEngine::Vector3::Vector3(System::Single x, System::Single y, System::Single z)
 	{
-		Handle = handle;
-		if (handle)
+		auto returnValue = Plugin::UnityEngineVector3ConstructorSystemSingle_SystemSingle_SystemSingle(x, y, z);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		*this = returnValue;
 	}
 	
-	Behaviour::Behaviour(const Behaviour& other)
-		: Behaviour(Plugin::InternalUse::Only, other.Handle)
-	{
-	}
-	
-	Behaviour::Behaviour(Behaviour&& other)
-		: Behaviour(Plugin::InternalUse::Only, other.Handle)
-	{
-		other.Handle = 0;
-	}
-	
-	Behaviour::~Behaviour()
+	UnityEngine::Vector3 UnityEngine::Vector3::operator+(UnityEngine::Vector3& a)
 	{
-		if (Handle)
+		auto returnValue = Plugin::UnityEngineVector3Methodop_AdditionUnityEngineVector3_UnityEngineVector3(*this, a);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return returnValue;
 	}
 	
-	Behaviour& Behaviour::operator=(const Behaviour& other)
+	UnityEngine::Vector3::operator System::ValueType()
 	{
-		if (this->Handle)
+		int32_t handle = Plugin::BoxVector3(*this);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		if (handle)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			Plugin::ReferenceManagedClass(handle);
+			return System::ValueType(Plugin::InternalUse::Only, handle);
 		}
-		return *this;
+		return nullptr;
 	}
 	
-	Behaviour& Behaviour::operator=(decltype(nullptr))
+	UnityEngine::Vector3::operator System::Object()
 	{
-		if (Handle)
+		int32_t handle = Plugin::BoxVector3(*this);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		return *this;
-	}
-	
-	Behaviour& Behaviour::operator=(Behaviour&& other)
-	{
-		if (Handle)
+		if (handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			Plugin::ReferenceManagedClass(handle);
+			return System::Object(Plugin::InternalUse::Only, handle);
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
+		return nullptr;
 	}
 	
-	bool Behaviour::operator==(const Behaviour& other) const
+	UnityEngine::Vector3::operator System::IEquatable_1<UnityEngine::Vector3>()
 	{
-		return Handle == other.Handle;
+		int32_t handle = Plugin::BoxVector3(*this);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IEquatable_1<UnityEngine::Vector3>(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
 	}
-	
-	bool Behaviour::operator!=(const Behaviour& other) const
+}
+
+namespace System
+{
+	System::Object::operator UnityEngine::Vector3()
 	{
-		return Handle != other.Handle;
+		UnityEngine::Vector3 returnVal(Plugin::UnboxVector3(Handle));
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return returnVal;
 	}
 }
 
 namespace UnityEngine
 {
-	MonoBehaviour::MonoBehaviour(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
+	Object::Object(decltype(nullptr))
 	{
 	}
 	
-	MonoBehaviour::MonoBehaviour(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
+	Object::Object(Plugin::InternalUse, int32_t handle)
 	{
 		Handle = handle;
 		if (handle)
@@ -4987,18 +5842,18 @@ namespace UnityEngine
 		}
 	}
 	
-	MonoBehaviour::MonoBehaviour(const MonoBehaviour& other)
-		: MonoBehaviour(Plugin::InternalUse::Only, other.Handle)
+	Object::Object(const Object& other)
+		: Object(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	MonoBehaviour::MonoBehaviour(MonoBehaviour&& other)
-		: MonoBehaviour(Plugin::InternalUse::Only, other.Handle)
+	Object::Object(Object&& other)
+		: Object(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	MonoBehaviour::~MonoBehaviour()
+	Object::~Object()
 	{
 		if (Handle)
 		{
@@ -5007,7 +5862,7 @@ namespace UnityEngine
 		}
 	}
 	
-	MonoBehaviour& MonoBehaviour::operator=(const MonoBehaviour& other)
+	Object& Object::operator=(const Object& other)
 	{
 		if (this->Handle)
 		{
@@ -5021,7 +5876,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	MonoBehaviour& MonoBehaviour::operator=(decltype(nullptr))
+	Object& Object::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -5031,7 +5886,7 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	MonoBehaviour& MonoBehaviour::operator=(MonoBehaviour&& other)
+	Object& Object::operator=(Object&& other)
 	{
 		if (Handle)
 		{
@@ -5042,41 +5897,50 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	bool MonoBehaviour::operator==(const MonoBehaviour& other) const
+	bool Object::operator==(const Object& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool MonoBehaviour::operator!=(const MonoBehaviour& other) const
+	bool Object::operator!=(const Object& other) const
 	{
 		return Handle != other.Handle;
 	}
 	
-	UnityEngine::Transform UnityEngine::MonoBehaviour::GetTransform()
+	bool UnityEngine::Object::IsAlive() const
 	{
-		auto returnValue = Plugin::UnityEngineMonoBehaviourPropertyGetTransform(Handle);
+		return Handle != 0 && !Plugin::IsDestroyed(Handle);
+	}
+	
+	System::String UnityEngine::Object::GetName()
+	{
+		auto returnValue = Plugin::UnityEngineObjectPropertyGetName(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		return UnityEngine::Transform(Plugin::InternalUse::Only, returnValue);
+		return System::String(Plugin::InternalUse::Only, returnValue);
 	}
-}
+	
+	void UnityEngine::Object::SetName(System::String& value)
+	{
+		Plugin::UnityEngineObjectPropertySetName(Handle, value.Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+	}
+}
 
-namespace System
+namespace UnityEngine
 {
-	Exception::Exception(decltype(nullptr))
-		: System::Runtime::InteropServices::_Exception(nullptr)
-		, System::Runtime::Serialization::ISerializable(nullptr)
+	Component::Component(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
 	{
 	}
 	
-	Exception::Exception(Plugin::InternalUse, int32_t handle)
-		: System::Runtime::InteropServices::_Exception(nullptr)
-		, System::Runtime::Serialization::ISerializable(nullptr)
+	Component::Component(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
 	{
 		Handle = handle;
 		if (handle)
@@ -5085,18 +5949,18 @@ namespace System
 		}
 	}
 	
-	Exception::Exception(const Exception& other)
-		: Exception(Plugin::InternalUse::Only, other.Handle)
+	Component::Component(const Component& other)
+		: Component(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	Exception::Exception(Exception&& other)
-		: Exception(Plugin::InternalUse::Only, other.Handle)
+	Component::Component(Component&& other)
+		: Component(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	Exception::~Exception()
+	Component::~Component()
 	{
 		if (Handle)
 		{
@@ -5105,7 +5969,7 @@ namespace System
 		}
 	}
 	
-	Exception& Exception::operator=(const Exception& other)
+	Component& Component::operator=(const Component& other)
 	{
 		if (this->Handle)
 		{
@@ -5119,7 +5983,7 @@ namespace System
 		return *this;
 	}
 	
-	Exception& Exception::operator=(decltype(nullptr))
+	Component& Component::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -5129,7 +5993,7 @@ namespace System
 		return *this;
 	}
 	
-	Exception& Exception::operator=(Exception&& other)
+	Component& Component::operator=(Component&& other)
 	{
 		if (Handle)
 		{
@@ -5140,49 +6004,40 @@ namespace System
 		return *this;
 	}
 	
-	bool Exception::operator==(const Exception& other) const
+	bool Component::operator==(const Component& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool Exception::operator!=(const Exception& other) const
+	bool Component::operator!=(const Component& other) const
 	{
 		return Handle != other.Handle;
 	}
 	
-	System::Exception::Exception(System::String& message)
-		: System::Runtime::InteropServices::_Exception(nullptr)
-		, System::Runtime::Serialization::ISerializable(nullptr)
+	UnityEngine::Transform UnityEngine::Component::GetTransform()
 	{
-		auto returnValue = Plugin::SystemExceptionConstructorSystemString(message.Handle);
+		auto returnValue = Plugin::UnityEngineComponentPropertyGetTransform(Handle);
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		Handle = returnValue;
-		if (returnValue)
-		{
-			Plugin::ReferenceManagedClass(returnValue);
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return UnityEngine::Transform(Plugin::InternalUse::Only, returnValue);
 	}
 }
 
-namespace System
+namespace UnityEngine
 {
-	SystemException::SystemException(decltype(nullptr))
-		: System::Runtime::InteropServices::_Exception(nullptr)
-		, System::Runtime::Serialization::ISerializable(nullptr)
-		, System::Exception(nullptr)
+	Transform::Transform(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, System::Collections::IEnumerable(nullptr)
 	{
 	}
 	
-	SystemException::SystemException(Plugin::InternalUse, int32_t handle)
-		: System::Runtime::InteropServices::_Exception(nullptr)
-		, System::Runtime::Serialization::ISerializable(nullptr)
-		, System::Exception(nullptr)
+	Transform::Transform(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, System::Collections::IEnumerable(nullptr)
 	{
 		Handle = handle;
 		if (handle)
@@ -5191,18 +6046,18 @@ namespace System
 		}
 	}
 	
-	SystemException::SystemException(const SystemException& other)
-		: SystemException(Plugin::InternalUse::Only, other.Handle)
+	Transform::Transform(const Transform& other)
+		: Transform(Plugin::InternalUse::Only, other.Handle)
 	{
 	}
 	
-	SystemException::SystemException(SystemException&& other)
-		: SystemException(Plugin::InternalUse::Only, other.Handle)
+	Transform::Transform(Transform&& other)
+		: Transform(Plugin::InternalUse::Only, other.Handle)
 	{
 		other.Handle = 0;
 	}
 	
-	SystemException::~SystemException()
+	Transform::~Transform()
 	{
 		if (Handle)
 		{
@@ -5211,7 +6066,7 @@ namespace System
 		}
 	}
 	
-	SystemException& SystemException::operator=(const SystemException& other)
+	Transform& Transform::operator=(const Transform& other)
 	{
 		if (this->Handle)
 		{
@@ -5225,7 +6080,7 @@ namespace System
 		return *this;
 	}
 	
-	SystemException& SystemException::operator=(decltype(nullptr))
+	Transform& Transform::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
@@ -5235,7 +6090,7 @@ namespace System
 		return *this;
 	}
 	
-	SystemException& SystemException::operator=(SystemException&& other)
+	Transform& Transform::operator=(Transform&& other)
 	{
 		if (Handle)
 		{
@@ -5246,296 +6101,2725 @@ namespace System
 		return *this;
 	}
 	
-	bool SystemException::operator==(const SystemException& other) const
+	bool Transform::operator==(const Transform& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool SystemException::operator!=(const SystemException& other) const
+	bool Transform::operator!=(const Transform& other) const
 	{
 		return Handle != other.Handle;
 	}
-}
-
-namespace System
-{
-	NullReferenceException::NullReferenceException(decltype(nullptr))
-		: System::Runtime::InteropServices::_Exception(nullptr)
-		, System::Runtime::Serialization::ISerializable(nullptr)
-		, System::Exception(nullptr)
-		, System::SystemException(nullptr)
-	{
-	}
 	
-	NullReferenceException::NullReferenceException(Plugin::InternalUse, int32_t handle)
-		: System::Runtime::InteropServices::_Exception(nullptr)
-		, System::Runtime::Serialization::ISerializable(nullptr)
-		, System::Exception(nullptr)
-		, System::SystemException(nullptr)
+	UnityEngine::Vector3 UnityEngine::Transform::GetPosition()
 	{
-		Handle = handle;
-		if (handle)
+		auto returnValue = Plugin::UnityEngineTransformPropertyGetPosition(Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return returnValue;
 	}
 	
-	NullReferenceException::NullReferenceException(const NullReferenceException& other)
-		: NullReferenceException(Plugin::InternalUse::Only, other.Handle)
-	{
-	}
-	
-	NullReferenceException::NullReferenceException(NullReferenceException&& other)
-		: NullReferenceException(Plugin::InternalUse::Only, other.Handle)
-	{
-		other.Handle = 0;
-	}
-	
-	NullReferenceException::~NullReferenceException()
+	void UnityEngine::Transform::SetPosition(UnityEngine::Vector3& value)
 	{
-		if (Handle)
+		Plugin::UnityEngineTransformPropertySetPosition(Handle, value);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::ThrowUnhandledCsharpException();
 		}
 	}
-	
-	NullReferenceException& NullReferenceException::operator=(const NullReferenceException& other)
+}
+
+namespace System
+{
+	namespace Collections
 	{
-		if (this->Handle)
+		IEnumerator::IEnumerator(decltype(nullptr))
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		
+		IEnumerator::IEnumerator(Plugin::InternalUse, int32_t handle)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			Handle = handle;
+			if (handle)
+			{
+				Plugin::ReferenceManagedClass(handle);
+			}
 		}
-		return *this;
-	}
-	
-	NullReferenceException& NullReferenceException::operator=(decltype(nullptr))
-	{
-		if (Handle)
+		
+		IEnumerator::IEnumerator(const IEnumerator& other)
+			: IEnumerator(Plugin::InternalUse::Only, other.Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
 		}
-		return *this;
-	}
-	
-	NullReferenceException& NullReferenceException::operator=(NullReferenceException&& other)
-	{
-		if (Handle)
+		
+		IEnumerator::IEnumerator(IEnumerator&& other)
+			: IEnumerator(Plugin::InternalUse::Only, other.Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			other.Handle = 0;
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
-	}
-	
-	bool NullReferenceException::operator==(const NullReferenceException& other) const
-	{
-		return Handle == other.Handle;
-	}
-	
-	bool NullReferenceException::operator!=(const NullReferenceException& other) const
-	{
-		return Handle != other.Handle;
-	}
-}
-
-namespace UnityEngine
-{
-	PrimitiveType::PrimitiveType(int32_t value)
-		: Value(value)
-	{
-	}
-	
-	UnityEngine::PrimitiveType::operator int32_t() const
-	{
-		return Value;
-	}
-	
-	bool UnityEngine::PrimitiveType::operator==(PrimitiveType other)
-	{
-		return Value == other.Value;
-	}
-	
-	bool UnityEngine::PrimitiveType::operator!=(PrimitiveType other)
-	{
-		return Value != other.Value;
-	}
-	
-	UnityEngine::PrimitiveType::operator System::Enum()
-	{
-		int32_t handle = Plugin::BoxPrimitiveType(*this);
-		if (Plugin::unhandledCsharpException)
+		
+		IEnumerator::~IEnumerator()
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+				Handle = 0;
+			}
 		}
-		if (handle)
+		
+		IEnumerator& IEnumerator::operator=(const IEnumerator& other)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::Enum(Plugin::InternalUse::Only, handle);
+			if (this->Handle)
+			{
+				Plugin::DereferenceManagedClass(this->Handle);
+			}
+			this->Handle = other.Handle;
+			if (this->Handle)
+			{
+				Plugin::ReferenceManagedClass(this->Handle);
+			}
+			return *this;
 		}
-		return nullptr;
-	}
-	
-	UnityEngine::PrimitiveType::operator System::ValueType()
-	{
-		int32_t handle = Plugin::BoxPrimitiveType(*this);
-		if (Plugin::unhandledCsharpException)
+		
+		IEnumerator& IEnumerator::operator=(decltype(nullptr))
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+				Handle = 0;
+			}
+			return *this;
 		}
-		if (handle)
+		
+		IEnumerator& IEnumerator::operator=(IEnumerator&& other)
+		{
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+			}
+			Handle = other.Handle;
+			other.Handle = 0;
+			return *this;
+		}
+		
+		bool IEnumerator::operator==(const IEnumerator& other) const
+		{
+			return Handle == other.Handle;
+		}
+		
+		bool IEnumerator::operator!=(const IEnumerator& other) const
+		{
+			return Handle != other.Handle;
+		}
+		
+		System::Object System::Collections::IEnumerator::GetCurrent()
+		{
+			auto returnValue = Plugin::SystemCollectionsIEnumeratorPropertyGetCurrent(Handle);
+			if (Plugin::unhandledCsharpException)
+			{
+				Plugin::ThrowUnhandledCsharpException();
+			}
+			return System::Object(Plugin::InternalUse::Only, returnValue);
+		}
+		
+		System::Boolean System::Collections::IEnumerator::MoveNext()
+		{
+			auto returnValue = Plugin::SystemCollectionsIEnumeratorMethodMoveNext(Handle);
+			if (Plugin::unhandledCsharpException)
+			{
+				Plugin::ThrowUnhandledCsharpException();
+			}
+			return returnValue;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Runtime
+	{
+		namespace Serialization
+		{
+			ISerializable::ISerializable(decltype(nullptr))
+			{
+			}
+			
+			ISerializable::ISerializable(Plugin::InternalUse, int32_t handle)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			ISerializable::ISerializable(const ISerializable& other)
+				: ISerializable(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			ISerializable::ISerializable(ISerializable&& other)
+				: ISerializable(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			ISerializable::~ISerializable()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			ISerializable& ISerializable::operator=(const ISerializable& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			ISerializable& ISerializable::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			ISerializable& ISerializable::operator=(ISerializable&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool ISerializable::operator==(const ISerializable& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool ISerializable::operator!=(const ISerializable& other) const
+			{
+				return Handle != other.Handle;
+			}
+		}
+	}
+}
+
+namespace System
+{
+	namespace Runtime
+	{
+		namespace InteropServices
+		{
+			_Exception::_Exception(decltype(nullptr))
+			{
+			}
+			
+			_Exception::_Exception(Plugin::InternalUse, int32_t handle)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			_Exception::_Exception(const _Exception& other)
+				: _Exception(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			_Exception::_Exception(_Exception&& other)
+				: _Exception(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			_Exception::~_Exception()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			_Exception& _Exception::operator=(const _Exception& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			_Exception& _Exception::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			_Exception& _Exception::operator=(_Exception&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool _Exception::operator==(const _Exception& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool _Exception::operator!=(const _Exception& other) const
+			{
+				return Handle != other.Handle;
+			}
+		}
+	}
+}
+
+namespace UnityEngine
+{
+	GameObject::GameObject(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+	{
+	}
+	
+	GameObject::GameObject(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	GameObject::GameObject(const GameObject& other)
+		: GameObject(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	GameObject::GameObject(GameObject&& other)
+		: GameObject(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	GameObject::~GameObject()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	GameObject& GameObject::operator=(const GameObject& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	GameObject& GameObject::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	GameObject& GameObject::operator=(GameObject&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool GameObject::operator==(const GameObject& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool GameObject::operator!=(const GameObject& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	template<> MyGame::BaseBallScript UnityEngine::GameObject::AddComponent<MyGame::BaseBallScript>()
+	{
+		auto returnValue = Plugin::UnityEngineGameObjectMethodAddComponentMyGameBaseBallScript(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return MyGame::BaseBallScript(Plugin::InternalUse::Only, returnValue);
+	}
+	
+	UnityEngine::GameObject UnityEngine::GameObject::CreatePrimitive(UnityEngine::PrimitiveType type)
+	{
+		auto returnValue = Plugin::UnityEngineGameObjectMethodCreatePrimitiveUnityEnginePrimitiveType(type);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return UnityEngine::GameObject(Plugin::InternalUse::Only, returnValue);
+	}
+}
+
+namespace UnityEngine
+{
+	Debug::Debug(decltype(nullptr))
+	{
+	}
+	
+	Debug::Debug(Plugin::InternalUse, int32_t handle)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	Debug::Debug(const Debug& other)
+		: Debug(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	Debug::Debug(Debug&& other)
+		: Debug(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	Debug::~Debug()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	Debug& Debug::operator=(const Debug& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	Debug& Debug::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	Debug& Debug::operator=(Debug&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool Debug::operator==(const Debug& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool Debug::operator!=(const Debug& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	void UnityEngine::Debug::Log(System::Object& message)
+	{
+		Plugin::UnityEngineDebugMethodLogSystemObject(message.Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+	}
+}
+
+namespace UnityEngine
+{
+	Behaviour::Behaviour(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+	{
+	}
+	
+	Behaviour::Behaviour(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	Behaviour::Behaviour(const Behaviour& other)
+		: Behaviour(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	Behaviour::Behaviour(Behaviour&& other)
+		: Behaviour(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	Behaviour::~Behaviour()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	Behaviour& Behaviour::operator=(const Behaviour& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	Behaviour& Behaviour::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	Behaviour& Behaviour::operator=(Behaviour&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool Behaviour::operator==(const Behaviour& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool Behaviour::operator!=(const Behaviour& other) const
+	{
+		return Handle != other.Handle;
+	}
+}
+
+namespace UnityEngine
+{
+	MonoBehaviour::MonoBehaviour(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+	{
+	}
+	
+	MonoBehaviour::MonoBehaviour(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	MonoBehaviour::MonoBehaviour(const MonoBehaviour& other)
+		: MonoBehaviour(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	MonoBehaviour::MonoBehaviour(MonoBehaviour&& other)
+		: MonoBehaviour(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	MonoBehaviour::~MonoBehaviour()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	MonoBehaviour& MonoBehaviour::operator=(const MonoBehaviour& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	MonoBehaviour& MonoBehaviour::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	MonoBehaviour& MonoBehaviour::operator=(MonoBehaviour&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool MonoBehaviour::operator==(const MonoBehaviour& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool MonoBehaviour::operator!=(const MonoBehaviour& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	UnityEngine::Transform UnityEngine::MonoBehaviour::GetTransform()
+	{
+		auto returnValue = Plugin::UnityEngineMonoBehaviourPropertyGetTransform(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return UnityEngine::Transform(Plugin::InternalUse::Only, returnValue);
+	}
+}
+
+namespace System
+{
+	Exception::Exception(decltype(nullptr))
+		: System::Runtime::InteropServices::_Exception(nullptr)
+		, System::Runtime::Serialization::ISerializable(nullptr)
+	{
+	}
+	
+	Exception::Exception(Plugin::InternalUse, int32_t handle)
+		: System::Runtime::InteropServices::_Exception(nullptr)
+		, System::Runtime::Serialization::ISerializable(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	Exception::Exception(const Exception& other)
+		: Exception(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	Exception::Exception(Exception&& other)
+		: Exception(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	Exception::~Exception()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	Exception& Exception::operator=(const Exception& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	Exception& Exception::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	Exception& Exception::operator=(Exception&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool Exception::operator==(const Exception& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool Exception::operator!=(const Exception& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	System::Exception::Exception(System::String& message)
+		: System::Runtime::InteropServices::_Exception(nullptr)
+		, System::Runtime::Serialization::ISerializable(nullptr)
+	{
+		auto returnValue = Plugin::SystemExceptionConstructorSystemString(message.Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		Handle = returnValue;
+		if (returnValue)
+		{
+			Plugin::ReferenceManagedClass(returnValue);
+		}
+	}
+}
+
+namespace System
+{
+	SystemException::SystemException(decltype(nullptr))
+		: System::Runtime::InteropServices::_Exception(nullptr)
+		, System::Runtime::Serialization::ISerializable(nullptr)
+		, System::Exception(nullptr)
+	{
+	}
+	
+	SystemException::SystemException(Plugin::InternalUse, int32_t handle)
+		: System::Runtime::InteropServices::_Exception(nullptr)
+		, System::Runtime::Serialization::ISerializable(nullptr)
+		, System::Exception(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	SystemException::SystemException(const SystemException& other)
+		: SystemException(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	SystemException::SystemException(SystemException&& other)
+		: SystemException(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	SystemException::~SystemException()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	SystemException& SystemException::operator=(const SystemException& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	SystemException& SystemException::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	SystemException& SystemException::operator=(SystemException&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool SystemException::operator==(const SystemException& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool SystemException::operator!=(const SystemException& other) const
+	{
+		return Handle != other.Handle;
+	}
+}
+
+namespace System
+{
+	NullReferenceException::NullReferenceException(decltype(nullptr))
+		: System::Runtime::InteropServices::_Exception(nullptr)
+		, System::Runtime::Serialization::ISerializable(nullptr)
+		, System::Exception(nullptr)
+		, System::SystemException(nullptr)
+	{
+	}
+	
+	NullReferenceException::NullReferenceException(Plugin::InternalUse, int32_t handle)
+		: System::Runtime::InteropServices::_Exception(nullptr)
+		, System::Runtime::Serialization::ISerializable(nullptr)
+		, System::Exception(nullptr)
+		, System::SystemException(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	NullReferenceException::NullReferenceException(const NullReferenceException& other)
+		: NullReferenceException(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	NullReferenceException::NullReferenceException(NullReferenceException&& other)
+		: NullReferenceException(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	NullReferenceException::~NullReferenceException()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	NullReferenceException& NullReferenceException::operator=(const NullReferenceException& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	NullReferenceException& NullReferenceException::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	NullReferenceException& NullReferenceException::operator=(NullReferenceException&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool NullReferenceException::operator==(const NullReferenceException& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool NullReferenceException::operator!=(const NullReferenceException& other) const
+	{
+		return Handle != other.Handle;
+	}
+}
+
+namespace UnityEngine
+{
+	PrimitiveType::PrimitiveType(int32_t value)
+		: Value(value)
+	{
+	}
+	
+	UnityEngine::PrimitiveType::operator int32_t() const
+	{
+		return Value;
+	}
+	
+	bool UnityEngine::PrimitiveType::operator==(PrimitiveType other)
+	{
+		return Value == other.Value;
+	}
+	
+	bool UnityEngine::PrimitiveType::operator!=(PrimitiveType other)
+	{
+		return Value != other.Value;
+	}
+	
+	UnityEngine::PrimitiveType::operator System::Enum()
+	{
+		int32_t handle = Plugin::BoxPrimitiveType(*this);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::Enum(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+	
+	UnityEngine::PrimitiveType::operator System::ValueType()
+	{
+		int32_t handle = Plugin::BoxPrimitiveType(*this);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::ValueType(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+	
+	UnityEngine::PrimitiveType::operator System::Object()
+	{
+		int32_t handle = Plugin::BoxPrimitiveType(*this);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::Object(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+	
+	UnityEngine::PrimitiveType::operator System::IComparable()
+	{
+		int32_t handle = Plugin::BoxPrimitiveType(*this);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IComparable(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+	
+	UnityEngine::PrimitiveType::operator System::IConvertible()
+	{
+		int32_t handle = Plugin::BoxPrimitiveType(*this);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IConvertible(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+	
+	UnityEngine::PrimitiveType::operator System::IFormattable()
+	{
+		int32_t handle = Plugin::BoxPrimitiveType(*this);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::IFormattable(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+	
+}
+const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Sphere(0);
+const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Capsule(1);
+const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Cylinder(2);
+const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Cube(3);
+const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Plane(4);
+const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Quad(5);
+
+namespace System
+{
+	System::Object::operator UnityEngine::PrimitiveType()
+	{
+		UnityEngine::PrimitiveType returnVal(Plugin::UnboxPrimitiveType(Handle));
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return returnVal;
+	}
+}
+
+namespace UnityEngine
+{
+	Collider::Collider(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+	{
+	}
+	
+	Collider::Collider(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	Collider::Collider(const Collider& other)
+		: Collider(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	Collider::Collider(Collider&& other)
+		: Collider(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	Collider::~Collider()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	Collider& Collider::operator=(const Collider& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	Collider& Collider::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	Collider& Collider::operator=(Collider&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool Collider::operator==(const Collider& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool Collider::operator!=(const Collider& other) const
+	{
+		return Handle != other.Handle;
+	}
+}
+
+namespace UnityEngine
+{
+	RaycastHit::RaycastHit(decltype(nullptr))
+	{
+	}
+	
+	RaycastHit::RaycastHit(Plugin::InternalUse, int32_t handle)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedUnityEngineRaycastHit(Handle);
+		}
+	}
+	
+	RaycastHit::RaycastHit(const RaycastHit& other)
+		: RaycastHit(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	RaycastHit::RaycastHit(RaycastHit&& other)
+		: RaycastHit(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	RaycastHit::~RaycastHit()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedUnityEngineRaycastHit(Handle);
+			Handle = 0;
+		}
+	}
+	
+	RaycastHit& RaycastHit::operator=(const RaycastHit& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedUnityEngineRaycastHit(Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedUnityEngineRaycastHit(Handle);
+		}
+		return *this;
+	}
+	
+	RaycastHit& RaycastHit::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedUnityEngineRaycastHit(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	RaycastHit& RaycastHit::operator=(RaycastHit&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedUnityEngineRaycastHit(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool RaycastHit::operator==(const RaycastHit& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool RaycastHit::operator!=(const RaycastHit& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	UnityEngine::RaycastHitValue UnityEngine::RaycastHit::GetValue()
+	{
+		UnityEngine::RaycastHitValue value;
+		Plugin::UnityEngineRaycastHitGetValue(Handle, &value);
+		Plugin::ReferenceManagedClass(value.colliderHandle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return value;
+	}
+	
+	UnityEngine::RaycastHit::operator System::ValueType()
+	{
+		int32_t handle = Plugin::BoxRaycastHit(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::ValueType(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+	
+	UnityEngine::RaycastHit::operator System::Object()
+	{
+		int32_t handle = Plugin::BoxRaycastHit(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+			return System::Object(Plugin::InternalUse::Only, handle);
+		}
+		return nullptr;
+	}
+}
+
+namespace UnityEngine
+{
+	RaycastHitValue::RaycastHitValue()
+	{
+		colliderHandle = 0;
+	}
+	
+	RaycastHitValue::RaycastHitValue(const RaycastHitValue& other)
+	{
+		point = other.point;
+		normal = other.normal;
+		distance = other.distance;
+		colliderHandle = other.colliderHandle;
+		Plugin::ReferenceManagedClass(colliderHandle);
+	}
+	
+	RaycastHitValue::RaycastHitValue(RaycastHitValue&& other)
+	{
+		point = other.point;
+		normal = other.normal;
+		distance = other.distance;
+		colliderHandle = other.colliderHandle;
+		other.colliderHandle = 0;
+	}
+	
+	RaycastHitValue::~RaycastHitValue()
+	{
+		Plugin::DereferenceManagedClass(colliderHandle);
+	}
+	
+	RaycastHitValue& RaycastHitValue::operator=(const RaycastHitValue& other)
+	{
+		Plugin::ReferenceManagedClass(other.colliderHandle);
+		Plugin::DereferenceManagedClass(colliderHandle);
+		point = other.point;
+		normal = other.normal;
+		distance = other.distance;
+		colliderHandle = other.colliderHandle;
+		return *this;
+	}
+	
+	RaycastHitValue& RaycastHitValue::operator=(RaycastHitValue&& other)
+	{
+		if (this != &other)
+		{
+			Plugin::DereferenceManagedClass(colliderHandle);
+			point = other.point;
+			normal = other.normal;
+			distance = other.distance;
+			colliderHandle = other.colliderHandle;
+			other.colliderHandle = 0;
+		}
+		return *this;
+	}
+	
+	UnityEngine::Collider RaycastHitValue::GetCollider() const
+	{
+		return UnityEngine::Collider(Plugin::InternalUse::Only, colliderHandle);
+	}
+}
+
+namespace System
+{
+	System::Object::operator UnityEngine::RaycastHit()
+	{
+		UnityEngine::RaycastHit returnVal(Plugin::InternalUse::Only, Plugin::UnboxRaycastHit(Handle));
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return returnVal;
+	}
+}
+
+namespace System
+{
+	IDisposable::IDisposable(decltype(nullptr))
+	{
+	}
+	
+	IDisposable::IDisposable(Plugin::InternalUse, int32_t handle)
+	{
+		Handle = handle;
+		if (handle)
+		{
+			Plugin::ReferenceManagedClass(handle);
+		}
+	}
+	
+	IDisposable::IDisposable(const IDisposable& other)
+		: IDisposable(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	IDisposable::IDisposable(IDisposable&& other)
+		: IDisposable(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	IDisposable::~IDisposable()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	IDisposable& IDisposable::operator=(const IDisposable& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	IDisposable& IDisposable::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	IDisposable& IDisposable::operator=(IDisposable&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool IDisposable::operator==(const IDisposable& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool IDisposable::operator!=(const IDisposable& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	void System::IDisposable::Dispose()
+	{
+		Plugin::SystemIDisposableMethodDispose(Handle);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		IStructuralComparable::IStructuralComparable(decltype(nullptr))
+		{
+		}
+		
+		IStructuralComparable::IStructuralComparable(Plugin::InternalUse, int32_t handle)
+		{
+			Handle = handle;
+			if (handle)
+			{
+				Plugin::ReferenceManagedClass(handle);
+			}
+		}
+		
+		IStructuralComparable::IStructuralComparable(const IStructuralComparable& other)
+			: IStructuralComparable(Plugin::InternalUse::Only, other.Handle)
+		{
+		}
+		
+		IStructuralComparable::IStructuralComparable(IStructuralComparable&& other)
+			: IStructuralComparable(Plugin::InternalUse::Only, other.Handle)
+		{
+			other.Handle = 0;
+		}
+		
+		IStructuralComparable::~IStructuralComparable()
+		{
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+				Handle = 0;
+			}
+		}
+		
+		IStructuralComparable& IStructuralComparable::operator=(const IStructuralComparable& other)
+		{
+			if (this->Handle)
+			{
+				Plugin::DereferenceManagedClass(this->Handle);
+			}
+			this->Handle = other.Handle;
+			if (this->Handle)
+			{
+				Plugin::ReferenceManagedClass(this->Handle);
+			}
+			return *this;
+		}
+		
+		IStructuralComparable& IStructuralComparable::operator=(decltype(nullptr))
+		{
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+				Handle = 0;
+			}
+			return *this;
+		}
+		
+		IStructuralComparable& IStructuralComparable::operator=(IStructuralComparable&& other)
+		{
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+			}
+			Handle = other.Handle;
+			other.Handle = 0;
+			return *this;
+		}
+		
+		bool IStructuralComparable::operator==(const IStructuralComparable& other) const
+		{
+			return Handle == other.Handle;
+		}
+		
+		bool IStructuralComparable::operator!=(const IStructuralComparable& other) const
+		{
+			return Handle != other.Handle;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		IStructuralEquatable::IStructuralEquatable(decltype(nullptr))
+		{
+		}
+		
+		IStructuralEquatable::IStructuralEquatable(Plugin::InternalUse, int32_t handle)
+		{
+			Handle = handle;
+			if (handle)
+			{
+				Plugin::ReferenceManagedClass(handle);
+			}
+		}
+		
+		IStructuralEquatable::IStructuralEquatable(const IStructuralEquatable& other)
+			: IStructuralEquatable(Plugin::InternalUse::Only, other.Handle)
+		{
+		}
+		
+		IStructuralEquatable::IStructuralEquatable(IStructuralEquatable&& other)
+			: IStructuralEquatable(Plugin::InternalUse::Only, other.Handle)
+		{
+			other.Handle = 0;
+		}
+		
+		IStructuralEquatable::~IStructuralEquatable()
+		{
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+				Handle = 0;
+			}
+		}
+		
+		IStructuralEquatable& IStructuralEquatable::operator=(const IStructuralEquatable& other)
+		{
+			if (this->Handle)
+			{
+				Plugin::DereferenceManagedClass(this->Handle);
+			}
+			this->Handle = other.Handle;
+			if (this->Handle)
+			{
+				Plugin::ReferenceManagedClass(this->Handle);
+			}
+			return *this;
+		}
+		
+		IStructuralEquatable& IStructuralEquatable::operator=(decltype(nullptr))
+		{
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+				Handle = 0;
+			}
+			return *this;
+		}
+		
+		IStructuralEquatable& IStructuralEquatable::operator=(IStructuralEquatable&& other)
+		{
+			if (Handle)
+			{
+				Plugin::DereferenceManagedClass(Handle);
+			}
+			Handle = other.Handle;
+			other.Handle = 0;
+			return *this;
+		}
+		
+		bool IStructuralEquatable::operator==(const IStructuralEquatable& other) const
+		{
+			return Handle == other.Handle;
+		}
+		
+		bool IStructuralEquatable::operator!=(const IStructuralEquatable& other) const
+		{
+			return Handle != other.Handle;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			IEnumerable_1<UnityEngine::RaycastHit>::IEnumerable_1(decltype(nullptr))
+				: System::Collections::IEnumerable(nullptr)
+			{
+			}
+			
+			IEnumerable_1<UnityEngine::RaycastHit>::IEnumerable_1(Plugin::InternalUse, int32_t handle)
+				: System::Collections::IEnumerable(nullptr)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			IEnumerable_1<UnityEngine::RaycastHit>::IEnumerable_1(const IEnumerable_1<UnityEngine::RaycastHit>& other)
+				: IEnumerable_1(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			IEnumerable_1<UnityEngine::RaycastHit>::IEnumerable_1(IEnumerable_1<UnityEngine::RaycastHit>&& other)
+				: IEnumerable_1(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			IEnumerable_1<UnityEngine::RaycastHit>::~IEnumerable_1<UnityEngine::RaycastHit>()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			IEnumerable_1<UnityEngine::RaycastHit>& IEnumerable_1<UnityEngine::RaycastHit>::operator=(const IEnumerable_1<UnityEngine::RaycastHit>& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			IEnumerable_1<UnityEngine::RaycastHit>& IEnumerable_1<UnityEngine::RaycastHit>::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			IEnumerable_1<UnityEngine::RaycastHit>& IEnumerable_1<UnityEngine::RaycastHit>::operator=(IEnumerable_1<UnityEngine::RaycastHit>&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool IEnumerable_1<UnityEngine::RaycastHit>::operator==(const IEnumerable_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool IEnumerable_1<UnityEngine::RaycastHit>::operator!=(const IEnumerable_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle != other.Handle;
+			}
+			
+			System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit> System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>::GetEnumerator()
+			{
+				auto returnValue = Plugin::SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumerator(Handle);
+				if (Plugin::unhandledCsharpException)
+				{
+					Plugin::ThrowUnhandledCsharpException();
+				}
+				return System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit>(Plugin::InternalUse::Only, returnValue);
+			}
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			IEnumerator_1<UnityEngine::RaycastHit>::IEnumerator_1(decltype(nullptr))
+				: System::IDisposable(nullptr)
+				, System::Collections::IEnumerator(nullptr)
+			{
+			}
+			
+			IEnumerator_1<UnityEngine::RaycastHit>::IEnumerator_1(Plugin::InternalUse, int32_t handle)
+				: System::IDisposable(nullptr)
+				, System::Collections::IEnumerator(nullptr)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			IEnumerator_1<UnityEngine::RaycastHit>::IEnumerator_1(const IEnumerator_1<UnityEngine::RaycastHit>& other)
+				: IEnumerator_1(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			IEnumerator_1<UnityEngine::RaycastHit>::IEnumerator_1(IEnumerator_1<UnityEngine::RaycastHit>&& other)
+				: IEnumerator_1(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			IEnumerator_1<UnityEngine::RaycastHit>::~IEnumerator_1<UnityEngine::RaycastHit>()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			IEnumerator_1<UnityEngine::RaycastHit>& IEnumerator_1<UnityEngine::RaycastHit>::operator=(const IEnumerator_1<UnityEngine::RaycastHit>& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			IEnumerator_1<UnityEngine::RaycastHit>& IEnumerator_1<UnityEngine::RaycastHit>::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			IEnumerator_1<UnityEngine::RaycastHit>& IEnumerator_1<UnityEngine::RaycastHit>::operator=(IEnumerator_1<UnityEngine::RaycastHit>&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool IEnumerator_1<UnityEngine::RaycastHit>::operator==(const IEnumerator_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool IEnumerator_1<UnityEngine::RaycastHit>::operator!=(const IEnumerator_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle != other.Handle;
+			}
+			
+			UnityEngine::RaycastHit System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit>::GetCurrent()
+			{
+				auto returnValue = Plugin::SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrent(Handle);
+				if (Plugin::unhandledCsharpException)
+				{
+					Plugin::ThrowUnhandledCsharpException();
+				}
+				return UnityEngine::RaycastHit(Plugin::InternalUse::Only, returnValue);
+			}
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			ICollection_1<UnityEngine::RaycastHit>::ICollection_1(decltype(nullptr))
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+			{
+			}
+			
+			ICollection_1<UnityEngine::RaycastHit>::ICollection_1(Plugin::InternalUse, int32_t handle)
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			ICollection_1<UnityEngine::RaycastHit>::ICollection_1(const ICollection_1<UnityEngine::RaycastHit>& other)
+				: ICollection_1(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			ICollection_1<UnityEngine::RaycastHit>::ICollection_1(ICollection_1<UnityEngine::RaycastHit>&& other)
+				: ICollection_1(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			ICollection_1<UnityEngine::RaycastHit>::~ICollection_1<UnityEngine::RaycastHit>()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			ICollection_1<UnityEngine::RaycastHit>& ICollection_1<UnityEngine::RaycastHit>::operator=(const ICollection_1<UnityEngine::RaycastHit>& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			ICollection_1<UnityEngine::RaycastHit>& ICollection_1<UnityEngine::RaycastHit>::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			ICollection_1<UnityEngine::RaycastHit>& ICollection_1<UnityEngine::RaycastHit>::operator=(ICollection_1<UnityEngine::RaycastHit>&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool ICollection_1<UnityEngine::RaycastHit>::operator==(const ICollection_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool ICollection_1<UnityEngine::RaycastHit>::operator!=(const ICollection_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle != other.Handle;
+			}
+		}
+	}
+}
+
+namespace Plugin
+{
+	SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator(decltype(nullptr))
+		: enumerator(nullptr)
+		, hasMore(false)
+	{
+	}
+	
+	SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator(System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>& enumerable)
+		: enumerator(enumerable.GetEnumerator())
+	{
+		hasMore = enumerator.MoveNext();
+	}
+	
+	SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator::~SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator()
+	{
+		if (enumerator != nullptr)
+		{
+			enumerator.Dispose();
+		}
+	}
+	
+	SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator& SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator::operator++()
+	{
+		hasMore = enumerator.MoveNext();
+		return *this;
+	}
+	
+	bool SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator::operator!=(const SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator& other)
+	{
+		return hasMore;
+	}
+	
+	UnityEngine::RaycastHit SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator::operator*()
+	{
+		return enumerator.GetCurrent();
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator begin(System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator(enumerable);
+			}
+			
+			Plugin::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator end(System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator(nullptr);
+			}
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			IList_1<UnityEngine::RaycastHit>::IList_1(decltype(nullptr))
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+				, System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>(nullptr)
+			{
+			}
+			
+			IList_1<UnityEngine::RaycastHit>::IList_1(Plugin::InternalUse, int32_t handle)
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+				, System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>(nullptr)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			IList_1<UnityEngine::RaycastHit>::IList_1(const IList_1<UnityEngine::RaycastHit>& other)
+				: IList_1(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			IList_1<UnityEngine::RaycastHit>::IList_1(IList_1<UnityEngine::RaycastHit>&& other)
+				: IList_1(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			IList_1<UnityEngine::RaycastHit>::~IList_1<UnityEngine::RaycastHit>()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			IList_1<UnityEngine::RaycastHit>& IList_1<UnityEngine::RaycastHit>::operator=(const IList_1<UnityEngine::RaycastHit>& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			IList_1<UnityEngine::RaycastHit>& IList_1<UnityEngine::RaycastHit>::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			IList_1<UnityEngine::RaycastHit>& IList_1<UnityEngine::RaycastHit>::operator=(IList_1<UnityEngine::RaycastHit>&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool IList_1<UnityEngine::RaycastHit>::operator==(const IList_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool IList_1<UnityEngine::RaycastHit>::operator!=(const IList_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle != other.Handle;
+			}
+		}
+	}
+}
+
+namespace Plugin
+{
+	SystemCollectionsGenericIListUnityEngineRaycastHitIterator::SystemCollectionsGenericIListUnityEngineRaycastHitIterator(decltype(nullptr))
+		: enumerator(nullptr)
+		, hasMore(false)
+	{
+	}
+	
+	SystemCollectionsGenericIListUnityEngineRaycastHitIterator::SystemCollectionsGenericIListUnityEngineRaycastHitIterator(System::Collections::Generic::IList_1<UnityEngine::RaycastHit>& enumerable)
+		: enumerator(enumerable.GetEnumerator())
+	{
+		hasMore = enumerator.MoveNext();
+	}
+	
+	SystemCollectionsGenericIListUnityEngineRaycastHitIterator::~SystemCollectionsGenericIListUnityEngineRaycastHitIterator()
+	{
+		if (enumerator != nullptr)
+		{
+			enumerator.Dispose();
+		}
+	}
+	
+	SystemCollectionsGenericIListUnityEngineRaycastHitIterator& SystemCollectionsGenericIListUnityEngineRaycastHitIterator::operator++()
+	{
+		hasMore = enumerator.MoveNext();
+		return *this;
+	}
+	
+	bool SystemCollectionsGenericIListUnityEngineRaycastHitIterator::operator!=(const SystemCollectionsGenericIListUnityEngineRaycastHitIterator& other)
+	{
+		return hasMore;
+	}
+	
+	UnityEngine::RaycastHit SystemCollectionsGenericIListUnityEngineRaycastHitIterator::operator*()
+	{
+		return enumerator.GetCurrent();
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericIListUnityEngineRaycastHitIterator begin(System::Collections::Generic::IList_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericIListUnityEngineRaycastHitIterator(enumerable);
+			}
+			
+			Plugin::SystemCollectionsGenericIListUnityEngineRaycastHitIterator end(System::Collections::Generic::IList_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericIListUnityEngineRaycastHitIterator(nullptr);
+			}
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>::IReadOnlyCollection_1(decltype(nullptr))
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+			{
+			}
+			
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>::IReadOnlyCollection_1(Plugin::InternalUse, int32_t handle)
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>::IReadOnlyCollection_1(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other)
+				: IReadOnlyCollection_1(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>::IReadOnlyCollection_1(IReadOnlyCollection_1<UnityEngine::RaycastHit>&& other)
+				: IReadOnlyCollection_1(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>::~IReadOnlyCollection_1<UnityEngine::RaycastHit>()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>& IReadOnlyCollection_1<UnityEngine::RaycastHit>::operator=(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>& IReadOnlyCollection_1<UnityEngine::RaycastHit>::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			IReadOnlyCollection_1<UnityEngine::RaycastHit>& IReadOnlyCollection_1<UnityEngine::RaycastHit>::operator=(IReadOnlyCollection_1<UnityEngine::RaycastHit>&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool IReadOnlyCollection_1<UnityEngine::RaycastHit>::operator==(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool IReadOnlyCollection_1<UnityEngine::RaycastHit>::operator!=(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle != other.Handle;
+			}
+		}
+	}
+}
+
+namespace Plugin
+{
+	SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator(decltype(nullptr))
+		: enumerator(nullptr)
+		, hasMore(false)
+	{
+	}
+	
+	SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator(System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>& enumerable)
+		: enumerator(enumerable.GetEnumerator())
+	{
+		hasMore = enumerator.MoveNext();
+	}
+	
+	SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator::~SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator()
+	{
+		if (enumerator != nullptr)
+		{
+			enumerator.Dispose();
+		}
+	}
+	
+	SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator& SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator::operator++()
+	{
+		hasMore = enumerator.MoveNext();
+		return *this;
+	}
+	
+	bool SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator::operator!=(const SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator& other)
+	{
+		return hasMore;
+	}
+	
+	UnityEngine::RaycastHit SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator::operator*()
+	{
+		return enumerator.GetCurrent();
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator begin(System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator(enumerable);
+			}
+			
+			Plugin::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator end(System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator(nullptr);
+			}
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			IReadOnlyList_1<UnityEngine::RaycastHit>::IReadOnlyList_1(decltype(nullptr))
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+				, System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>(nullptr)
+			{
+			}
+			
+			IReadOnlyList_1<UnityEngine::RaycastHit>::IReadOnlyList_1(Plugin::InternalUse, int32_t handle)
+				: System::Collections::IEnumerable(nullptr)
+				, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+				, System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>(nullptr)
+			{
+				Handle = handle;
+				if (handle)
+				{
+					Plugin::ReferenceManagedClass(handle);
+				}
+			}
+			
+			IReadOnlyList_1<UnityEngine::RaycastHit>::IReadOnlyList_1(const IReadOnlyList_1<UnityEngine::RaycastHit>& other)
+				: IReadOnlyList_1(Plugin::InternalUse::Only, other.Handle)
+			{
+			}
+			
+			IReadOnlyList_1<UnityEngine::RaycastHit>::IReadOnlyList_1(IReadOnlyList_1<UnityEngine::RaycastHit>&& other)
+				: IReadOnlyList_1(Plugin::InternalUse::Only, other.Handle)
+			{
+				other.Handle = 0;
+			}
+			
+			IReadOnlyList_1<UnityEngine::RaycastHit>::~IReadOnlyList_1<UnityEngine::RaycastHit>()
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+			}
+			
+			IReadOnlyList_1<UnityEngine::RaycastHit>& IReadOnlyList_1<UnityEngine::RaycastHit>::operator=(const IReadOnlyList_1<UnityEngine::RaycastHit>& other)
+			{
+				if (this->Handle)
+				{
+					Plugin::DereferenceManagedClass(this->Handle);
+				}
+				this->Handle = other.Handle;
+				if (this->Handle)
+				{
+					Plugin::ReferenceManagedClass(this->Handle);
+				}
+				return *this;
+			}
+			
+			IReadOnlyList_1<UnityEngine::RaycastHit>& IReadOnlyList_1<UnityEngine::RaycastHit>::operator=(decltype(nullptr))
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+					Handle = 0;
+				}
+				return *this;
+			}
+			
+			IReadOnlyList_1<UnityEngine::RaycastHit>& IReadOnlyList_1<UnityEngine::RaycastHit>::operator=(IReadOnlyList_1<UnityEngine::RaycastHit>&& other)
+			{
+				if (Handle)
+				{
+					Plugin::DereferenceManagedClass(Handle);
+				}
+				Handle = other.Handle;
+				other.Handle = 0;
+				return *this;
+			}
+			
+			bool IReadOnlyList_1<UnityEngine::RaycastHit>::operator==(const IReadOnlyList_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle == other.Handle;
+			}
+			
+			bool IReadOnlyList_1<UnityEngine::RaycastHit>::operator!=(const IReadOnlyList_1<UnityEngine::RaycastHit>& other) const
+			{
+				return Handle != other.Handle;
+			}
+		}
+	}
+}
+
+namespace Plugin
+{
+	SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator(decltype(nullptr))
+		: enumerator(nullptr)
+		, hasMore(false)
+	{
+	}
+	
+	SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator(System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>& enumerable)
+		: enumerator(enumerable.GetEnumerator())
+	{
+		hasMore = enumerator.MoveNext();
+	}
+	
+	SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator::~SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator()
+	{
+		if (enumerator != nullptr)
+		{
+			enumerator.Dispose();
+		}
+	}
+	
+	SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator& SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator::operator++()
+	{
+		hasMore = enumerator.MoveNext();
+		return *this;
+	}
+	
+	bool SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator::operator!=(const SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator& other)
+	{
+		return hasMore;
+	}
+	
+	UnityEngine::RaycastHit SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator::operator*()
+	{
+		return enumerator.GetCurrent();
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator begin(System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator(enumerable);
+			}
+			
+			Plugin::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator end(System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>& enumerable)
+			{
+				return Plugin::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator(nullptr);
+			}
+		}
+	}
+}
+
+namespace UnityEngine
+{
+	Time::Time(decltype(nullptr))
+	{
+	}
+	
+	Time::Time(Plugin::InternalUse, int32_t handle)
+	{
+		Handle = handle;
+		if (handle)
 		{
 			Plugin::ReferenceManagedClass(handle);
-			return System::ValueType(Plugin::InternalUse::Only, handle);
 		}
-		return nullptr;
 	}
 	
-	UnityEngine::PrimitiveType::operator System::Object()
+	Time::Time(const Time& other)
+		: Time(Plugin::InternalUse::Only, other.Handle)
+	{
+	}
+	
+	Time::Time(Time&& other)
+		: Time(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	Time::~Time()
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+	}
+	
+	Time& Time::operator=(const Time& other)
+	{
+		if (this->Handle)
+		{
+			Plugin::DereferenceManagedClass(this->Handle);
+		}
+		this->Handle = other.Handle;
+		if (this->Handle)
+		{
+			Plugin::ReferenceManagedClass(this->Handle);
+		}
+		return *this;
+	}
+	
+	Time& Time::operator=(decltype(nullptr))
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
+		}
+		return *this;
+	}
+	
+	Time& Time::operator=(Time&& other)
+	{
+		if (Handle)
+		{
+			Plugin::DereferenceManagedClass(Handle);
+		}
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool Time::operator==(const Time& other) const
+	{
+		return Handle == other.Handle;
+	}
+	
+	bool Time::operator!=(const Time& other) const
+	{
+		return Handle != other.Handle;
+	}
+	
+	System::Single UnityEngine::Time::GetDeltaTime()
 	{
-		int32_t handle = Plugin::BoxPrimitiveType(*this);
+		auto returnValue = Plugin::UnityEngineTimePropertyGetDeltaTime();
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return returnValue;
+	}
+}
+
+namespace MyGame
+{
+	AbstractBaseBallScript::AbstractBaseBallScript(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+	{
+	}
+	
+	AbstractBaseBallScript::AbstractBaseBallScript(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+	{
+		Handle = handle;
 		if (handle)
 		{
 			Plugin::ReferenceManagedClass(handle);
-			return System::Object(Plugin::InternalUse::Only, handle);
 		}
-		return nullptr;
 	}
 	
-	UnityEngine::PrimitiveType::operator System::IComparable()
+	AbstractBaseBallScript::AbstractBaseBallScript(const AbstractBaseBallScript& other)
+		: AbstractBaseBallScript(Plugin::InternalUse::Only, other.Handle)
 	{
-		int32_t handle = Plugin::BoxPrimitiveType(*this);
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		if (handle)
+	}
+	
+	AbstractBaseBallScript::AbstractBaseBallScript(AbstractBaseBallScript&& other)
+		: AbstractBaseBallScript(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+	}
+	
+	AbstractBaseBallScript::~AbstractBaseBallScript()
+	{
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IComparable(Plugin::InternalUse::Only, handle);
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
-		return nullptr;
 	}
 	
-	UnityEngine::PrimitiveType::operator System::IConvertible()
+	AbstractBaseBallScript& AbstractBaseBallScript::operator=(const AbstractBaseBallScript& other)
 	{
-		int32_t handle = Plugin::BoxPrimitiveType(*this);
-		if (Plugin::unhandledCsharpException)
+		if (this->Handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::DereferenceManagedClass(this->Handle);
 		}
-		if (handle)
+		this->Handle = other.Handle;
+		if (this->Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IConvertible(Plugin::InternalUse::Only, handle);
+			Plugin::ReferenceManagedClass(this->Handle);
 		}
-		return nullptr;
+		return *this;
 	}
 	
-	UnityEngine::PrimitiveType::operator System::IFormattable()
+	AbstractBaseBallScript& AbstractBaseBallScript::operator=(decltype(nullptr))
 	{
-		int32_t handle = Plugin::BoxPrimitiveType(*this);
-		if (Plugin::unhandledCsharpException)
+		if (Handle)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::DereferenceManagedClass(Handle);
+			Handle = 0;
 		}
-		if (handle)
+		return *this;
+	}
+	
+	AbstractBaseBallScript& AbstractBaseBallScript::operator=(AbstractBaseBallScript&& other)
+	{
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
-			return System::IFormattable(Plugin::InternalUse::Only, handle);
+			Plugin::DereferenceManagedClass(Handle);
 		}
-		return nullptr;
+		Handle = other.Handle;
+		other.Handle = 0;
+		return *this;
+	}
+	
+	bool AbstractBaseBallScript::operator==(const AbstractBaseBallScript& other) const
+	{
+		return Handle == other.Handle;
 	}
 	
+	bool AbstractBaseBallScript::operator!=(const AbstractBaseBallScript& other) const
+	{
+		return Handle != other.Handle;
+	}
 }
-const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Sphere(0);
-const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Capsule(1);
-const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Cylinder(2);
-const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Cube(3);
-const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Plane(4);
-const UnityEngine::PrimitiveType UnityEngine::PrimitiveType::Quad(5);
 
-namespace System
+namespace MyGame
 {
-	System::Object::operator UnityEngine::PrimitiveType()
+	MyGame::BaseBallScript::BaseBallScript()
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseBallScript(nullptr)
 	{
-		UnityEngine::PrimitiveType returnVal(Plugin::UnboxPrimitiveType(Handle));
+		CppHandle = Plugin::StoreBaseBallScript(this);
+		System::Int32* handle = (System::Int32*)&Handle;
+		int32_t cppHandle = CppHandle;
+		void* cppPointer = this;
+		Plugin::BaseBallScriptConstructor(cppHandle, cppPointer, &handle->Value);
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		if (Handle)
+		{
+			Plugin::ReferenceManagedClass(Handle);
+		}
+		else
+		{
+			Plugin::RemoveBaseBallScript(CppHandle);
+			CppHandle = 0;
+		}
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		return returnVal;
 	}
-}
-
-namespace UnityEngine
-{
-	Time::Time(decltype(nullptr))
+	
+	BaseBallScript::BaseBallScript(decltype(nullptr))
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseBallScript(nullptr)
 	{
+		CppHandle = Plugin::StoreBaseBallScript(this);
 	}
 	
-	Time::Time(Plugin::InternalUse, int32_t handle)
+	MyGame::BaseBallScript::BaseBallScript(const MyGame::BaseBallScript& other)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseBallScript(nullptr)
 	{
-		Handle = handle;
-		if (handle)
+		Handle = other.Handle;
+		CppHandle = Plugin::StoreBaseBallScript(this);
+		if (Handle)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			Plugin::ReferenceManagedClass(Handle);
 		}
 	}
 	
-	Time::Time(const Time& other)
-		: Time(Plugin::InternalUse::Only, other.Handle)
+	MyGame::BaseBallScript::BaseBallScript(MyGame::BaseBallScript&& other)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseBallScript(nullptr)
 	{
+		Handle = other.Handle;
+		CppHandle = other.CppHandle;
+		other.Handle = 0;
+		other.CppHandle = 0;
 	}
 	
-	Time::Time(Time&& other)
-		: Time(Plugin::InternalUse::Only, other.Handle)
+	MyGame::BaseBallScript::BaseBallScript(Plugin::InternalUse, int32_t handle)
+		: UnityEngine::Object(nullptr)
+		, UnityEngine::Component(nullptr)
+		, UnityEngine::Behaviour(nullptr)
+		, UnityEngine::MonoBehaviour(nullptr)
+		, MyGame::AbstractBaseBallScript(nullptr)
 	{
-		other.Handle = 0;
+		Handle = handle;
+		CppHandle = Plugin::StoreBaseBallScript(this);
+		if (Handle)
+		{
+			Plugin::ReferenceManagedClass(Handle);
+		}
 	}
 	
-	Time::~Time()
+	MyGame::BaseBallScript::~BaseBallScript()
 	{
+		Plugin::RemoveBaseBallScript(CppHandle);
+		CppHandle = 0;
 		if (Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			int32_t handle = Handle;
 			Handle = 0;
+			if (Plugin::DereferenceManagedClassNoRelease(handle))
+			{
+				Plugin::ReleaseBaseBallScript(handle);
+				if (Plugin::unhandledCsharpException)
+				{
+					Plugin::ThrowUnhandledCsharpException();
+				}
+			}
 		}
 	}
 	
-	Time& Time::operator=(const Time& other)
+	MyGame::BaseBallScript& MyGame::BaseBallScript::operator=(const MyGame::BaseBallScript& other)
 	{
 		if (this->Handle)
 		{
@@ -5549,255 +8833,370 @@ namespace UnityEngine
 		return *this;
 	}
 	
-	Time& Time::operator=(decltype(nullptr))
+	MyGame::BaseBallScript& MyGame::BaseBallScript::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			int32_t handle = Handle;
 			Handle = 0;
+			if (Plugin::DereferenceManagedClassNoRelease(handle))
+			{
+				Plugin::ReleaseBaseBallScript(handle);
+				if (Plugin::unhandledCsharpException)
+				{
+					Plugin::ThrowUnhandledCsharpException();
+				}
+			}
 		}
+		Handle = 0;
 		return *this;
 	}
 	
-	Time& Time::operator=(Time&& other)
+	MyGame::BaseBallScript& MyGame::BaseBallScript::operator=(MyGame::BaseBallScript&& other)
 	{
+		Plugin::RemoveBaseBallScript(CppHandle);
+		CppHandle = 0;
 		if (Handle)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			int32_t handle = Handle;
+			Handle = 0;
+			if (Plugin::DereferenceManagedClassNoRelease(handle))
+			{
+				Plugin::ReleaseBaseBallScript(handle);
+				if (Plugin::unhandledCsharpException)
+				{
+					Plugin::ThrowUnhandledCsharpException();
+				}
+			}
 		}
 		Handle = other.Handle;
 		other.Handle = 0;
 		return *this;
 	}
 	
-	bool Time::operator==(const Time& other) const
+	bool MyGame::BaseBallScript::operator==(const MyGame::BaseBallScript& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool Time::operator!=(const Time& other) const
+	bool MyGame::BaseBallScript::operator!=(const MyGame::BaseBallScript& other) const
 	{
 		return Handle != other.Handle;
 	}
 	
-	System::Single UnityEngine::Time::GetDeltaTime()
+	DLLEXPORT int32_t NewBaseBallScript(int32_t handle, void** cppPointer)
 	{
-		auto returnValue = Plugin::UnityEngineTimePropertyGetDeltaTime();
-		if (Plugin::unhandledCsharpException)
+		MyGame::BallScript* memory = Plugin::StoreWholeBaseBallScript();
+		if (!memory)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			System::String msg = "Out of plugin memory for MyGame::BallScript";
+			System::Exception ex(msg);
+			Plugin::SetException(ex.Handle);
+			*cppPointer = nullptr;
+			return 0;
 		}
-		return returnValue;
+		MyGame::BallScript* thiz = new (memory) MyGame::BallScript(Plugin::InternalUse::Only, handle);
+		Plugin::AddBaseBallScriptHotFields(thiz);
+		*cppPointer = static_cast<MyGame::BaseBallScript*>(thiz);
+		return thiz->CppHandle;
 	}
-}
 
-namespace MyGame
-{
-	AbstractBaseBallScript::AbstractBaseBallScript(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
+	DLLEXPORT void DestroyBaseBallScript(int32_t cppHandle)
+	{
+		MyGame::BaseBallScript* instance = Plugin::GetBaseBallScript(cppHandle);
+		Plugin::RemoveBaseBallScriptHotFields(instance);
+		Plugin::RemoveBaseBallScriptGameObject(instance);
+		instance->~BaseBallScript();
+		Plugin::RemoveWholeBaseBallScript(instance);
+	}
+
+	void MyGame::BaseBallScript::Update()
 	{
 	}
 	
-	AbstractBaseBallScript::AbstractBaseBallScript(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
+	DLLEXPORT void MyGameAbstractBaseBallScriptUpdate(MyGame::BaseBallScript* thiz)
+	{
+		PLUGIN_TRY
+		{
+			thiz->Update();
+		}
+		PLUGIN_CATCH_ALL
+		{
+			Plugin::SetCaughtException("Unhandled exception invoking MyGame::AbstractBaseBallScript");
+		}
+	}
+	
+	float& MyGame::BaseBallScript::GetDir()
 	{
-		Handle = handle;
-		if (handle)
+		if (HotFieldsRow < 0)
 		{
-			Plugin::ReferenceManagedClass(handle);
+			return DirFallback;
 		}
+		return Plugin::BaseBallScriptHotFields->GetColumn<Plugin::BaseBallScriptHotFieldColumns::Dir>()[HotFieldsRow];
 	}
 	
-	AbstractBaseBallScript::AbstractBaseBallScript(const AbstractBaseBallScript& other)
-		: AbstractBaseBallScript(Plugin::InternalUse::Only, other.Handle)
+	MyGame::BaseBallScript* MyGame::BaseBallScript::FindByGameObject(int32_t gameObjectInstanceId)
 	{
+		MyGame::BaseBallScript** instance = Plugin::BaseBallScriptsByGameObject->Find(gameObjectInstanceId);
+		return instance && !Plugin::IsDestroyed((*instance)->Handle) ? *instance : nullptr;
 	}
 	
-	AbstractBaseBallScript::AbstractBaseBallScript(AbstractBaseBallScript&& other)
-		: AbstractBaseBallScript(Plugin::InternalUse::Only, other.Handle)
+	DLLEXPORT void RegisterBaseBallScript(MyGame::BaseBallScript* thiz, int32_t gameObjectInstanceId)
 	{
-		other.Handle = 0;
+		Plugin::AddBaseBallScriptGameObject(thiz, gameObjectInstanceId);
 	}
 	
-	AbstractBaseBallScript::~AbstractBaseBallScript()
+}
+
+namespace System
+{
+	System::Object::operator System::Boolean()
 	{
-		if (Handle)
+		System::Boolean returnVal(Plugin::UnboxBoolean(Handle));
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return returnVal;
 	}
-	
-	AbstractBaseBallScript& AbstractBaseBallScript::operator=(const AbstractBaseBallScript& other)
+}
+
+namespace System
+{
+	System::Object::operator System::SByte()
 	{
-		if (this->Handle)
+		System::SByte returnVal(Plugin::UnboxSByte(Handle));
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(this->Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		this->Handle = other.Handle;
-		if (this->Handle)
+		return returnVal;
+	}
+}
+
+namespace System
+{
+	System::Object::operator System::Byte()
+	{
+		System::Byte returnVal(Plugin::UnboxByte(Handle));
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(this->Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		return *this;
+		return returnVal;
 	}
-	
-	AbstractBaseBallScript& AbstractBaseBallScript::operator=(decltype(nullptr))
+}
+
+namespace System
+{
+	System::Object::operator System::Int16()
 	{
-		if (Handle)
+		System::Int16 returnVal(Plugin::UnboxInt16(Handle));
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
-			Handle = 0;
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		return *this;
+		return returnVal;
 	}
-	
-	AbstractBaseBallScript& AbstractBaseBallScript::operator=(AbstractBaseBallScript&& other)
+}
+
+namespace System
+{
+	System::Object::operator System::UInt16()
 	{
-		if (Handle)
+		System::UInt16 returnVal(Plugin::UnboxUInt16(Handle));
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::DereferenceManagedClass(Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		Handle = other.Handle;
-		other.Handle = 0;
-		return *this;
+		return returnVal;
 	}
-	
-	bool AbstractBaseBallScript::operator==(const AbstractBaseBallScript& other) const
+}
+
+namespace System
+{
+	System::Object::operator System::Int32()
 	{
-		return Handle == other.Handle;
+		System::Int32 returnVal(Plugin::UnboxInt32(Handle));
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return returnVal;
 	}
-	
-	bool AbstractBaseBallScript::operator!=(const AbstractBaseBallScript& other) const
+}
+
+namespace System
+{
+	System::Object::operator System::UInt32()
 	{
-		return Handle != other.Handle;
+		System::UInt32 returnVal(Plugin::UnboxUInt32(Handle));
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return returnVal;
 	}
 }
 
-namespace MyGame
+namespace System
 {
-	MyGame::BaseBallScript::BaseBallScript()
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseBallScript(nullptr)
+	System::Object::operator System::Int64()
 	{
-		CppHandle = Plugin::StoreBaseBallScript(this);
-		System::Int32* handle = (System::Int32*)&Handle;
-		int32_t cppHandle = CppHandle;
-		Plugin::BaseBallScriptConstructor(cppHandle, &handle->Value);
+		System::Int64 returnVal(Plugin::UnboxInt64(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		if (Handle)
+		return returnVal;
+	}
+}
+
+namespace System
+{
+	System::Object::operator System::UInt64()
+	{
+		System::UInt64 returnVal(Plugin::UnboxUInt64(Handle));
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
-		else
+		return returnVal;
+	}
+}
+
+namespace System
+{
+	System::Object::operator System::Char()
+	{
+		System::Char returnVal(Plugin::UnboxChar(Handle));
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::RemoveBaseBallScript(CppHandle);
-			CppHandle = 0;
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return returnVal;
+	}
+}
+
+namespace System
+{
+	System::Object::operator System::Single()
+	{
+		System::Single returnVal(Plugin::UnboxSingle(Handle));
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
 		}
+		return returnVal;
 	}
-	
-	BaseBallScript::BaseBallScript(decltype(nullptr))
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseBallScript(nullptr)
+}
+
+namespace System
+{
+	System::Object::operator System::Double()
 	{
-		CppHandle = Plugin::StoreBaseBallScript(this);
+		System::Double returnVal(Plugin::UnboxDouble(Handle));
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return returnVal;
+	}
+}
+
+namespace Plugin
+{
+	ArrayElementProxy1_1<UnityEngine::RaycastHit>::ArrayElementProxy1_1(Plugin::InternalUse, int32_t handle, int32_t index0)
+	{
+		Handle = handle;
+		Index0 = index0;
 	}
 	
-	MyGame::BaseBallScript::BaseBallScript(const MyGame::BaseBallScript& other)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseBallScript(nullptr)
+	void ArrayElementProxy1_1<UnityEngine::RaycastHit>::operator=(UnityEngine::RaycastHit item)
 	{
-		Handle = other.Handle;
-		CppHandle = Plugin::StoreBaseBallScript(this);
-		if (Handle)
+		Plugin::UnityEngineRaycastHitArray1SetItem1(Handle, Index0, item.Handle);
+		if (Plugin::unhandledCsharpException)
 		{
-			Plugin::ReferenceManagedClass(Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
 	}
 	
-	MyGame::BaseBallScript::BaseBallScript(MyGame::BaseBallScript&& other)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseBallScript(nullptr)
+	ArrayElementProxy1_1<UnityEngine::RaycastHit>::operator UnityEngine::RaycastHit()
 	{
-		Handle = other.Handle;
-		CppHandle = other.CppHandle;
-		other.Handle = 0;
-		other.CppHandle = 0;
+		auto returnValue = Plugin::UnityEngineRaycastHitArray1GetItem1(Handle, Index0);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		return UnityEngine::RaycastHit(Plugin::InternalUse::Only, returnValue);
 	}
-	
-	MyGame::BaseBallScript::BaseBallScript(Plugin::InternalUse, int32_t handle)
-		: UnityEngine::Object(nullptr)
-		, UnityEngine::Component(nullptr)
-		, UnityEngine::Behaviour(nullptr)
-		, UnityEngine::MonoBehaviour(nullptr)
-		, MyGame::AbstractBaseBallScript(nullptr)
+}
+
+namespace System
+{
+	Array1<UnityEngine::RaycastHit>::Array1(decltype(nullptr))
+		: System::ICloneable(nullptr)
+		, System::Collections::IEnumerable(nullptr)
+		, System::Collections::ICollection(nullptr)
+		, System::Collections::IList(nullptr)
+		, System::Collections::IStructuralComparable(nullptr)
+		, System::Collections::IStructuralEquatable(nullptr)
+		, System::Array(nullptr)
+		, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IList_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>(nullptr)
+	{
+		this->InternalLength = 0;
+	}
+	
+	Array1<UnityEngine::RaycastHit>::Array1(Plugin::InternalUse, int32_t handle)
+		: System::ICloneable(nullptr)
+		, System::Collections::IEnumerable(nullptr)
+		, System::Collections::ICollection(nullptr)
+		, System::Collections::IList(nullptr)
+		, System::Collections::IStructuralComparable(nullptr)
+		, System::Collections::IStructuralEquatable(nullptr)
+		, System::Array(nullptr)
+		, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IList_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>(nullptr)
 	{
 		Handle = handle;
-		CppHandle = Plugin::StoreBaseBallScript(this);
-		if (Handle)
+		if (handle)
 		{
-			Plugin::ReferenceManagedClass(Handle);
+			Plugin::ReferenceManagedClass(handle);
 		}
+		this->InternalLength = 0;
 	}
 	
-	MyGame::BaseBallScript::~BaseBallScript()
+	Array1<UnityEngine::RaycastHit>::Array1(const Array1<UnityEngine::RaycastHit>& other)
+		: Array1(Plugin::InternalUse::Only, other.Handle)
+	{
+		InternalLength = other.InternalLength;
+	}
+	
+	Array1<UnityEngine::RaycastHit>::Array1(Array1<UnityEngine::RaycastHit>&& other)
+		: Array1(Plugin::InternalUse::Only, other.Handle)
+	{
+		other.Handle = 0;
+		InternalLength = other.InternalLength;
+		other.InternalLength = 0;
+	}
+	
+	Array1<UnityEngine::RaycastHit>::~Array1<UnityEngine::RaycastHit>()
 	{
-		Plugin::RemoveWholeBaseBallScript(this);
-		Plugin::RemoveBaseBallScript(CppHandle);
-		CppHandle = 0;
 		if (Handle)
 		{
-			int32_t handle = Handle;
+			Plugin::DereferenceManagedClass(Handle);
 			Handle = 0;
-			if (Plugin::DereferenceManagedClassNoRelease(handle))
-			{
-				Plugin::ReleaseBaseBallScript(handle);
-				if (Plugin::unhandledCsharpException)
-				{
-					System::Exception* ex = Plugin::unhandledCsharpException;
-					Plugin::unhandledCsharpException = nullptr;
-					ex->ThrowReferenceToThis();
-					delete ex;
-				}
-			}
 		}
 	}
 	
-	MyGame::BaseBallScript& MyGame::BaseBallScript::operator=(const MyGame::BaseBallScript& other)
+	Array1<UnityEngine::RaycastHit>& Array1<UnityEngine::RaycastHit>::operator=(const Array1<UnityEngine::RaycastHit>& other)
 	{
 		if (this->Handle)
 		{
@@ -5808,320 +9207,313 @@ namespace MyGame
 		{
 			Plugin::ReferenceManagedClass(this->Handle);
 		}
+		InternalLength = other.InternalLength;
 		return *this;
 	}
 	
-	MyGame::BaseBallScript& MyGame::BaseBallScript::operator=(decltype(nullptr))
+	Array1<UnityEngine::RaycastHit>& Array1<UnityEngine::RaycastHit>::operator=(decltype(nullptr))
 	{
 		if (Handle)
 		{
-			int32_t handle = Handle;
+			Plugin::DereferenceManagedClass(Handle);
 			Handle = 0;
-			if (Plugin::DereferenceManagedClassNoRelease(handle))
-			{
-				Plugin::ReleaseBaseBallScript(handle);
-				if (Plugin::unhandledCsharpException)
-				{
-					System::Exception* ex = Plugin::unhandledCsharpException;
-					Plugin::unhandledCsharpException = nullptr;
-					ex->ThrowReferenceToThis();
-					delete ex;
-				}
-			}
 		}
-		Handle = 0;
 		return *this;
 	}
 	
-	MyGame::BaseBallScript& MyGame::BaseBallScript::operator=(MyGame::BaseBallScript&& other)
+	Array1<UnityEngine::RaycastHit>& Array1<UnityEngine::RaycastHit>::operator=(Array1<UnityEngine::RaycastHit>&& other)
 	{
-		Plugin::RemoveBaseBallScript(CppHandle);
-		CppHandle = 0;
 		if (Handle)
 		{
-			int32_t handle = Handle;
-			Handle = 0;
-			if (Plugin::DereferenceManagedClassNoRelease(handle))
-			{
-				Plugin::ReleaseBaseBallScript(handle);
-				if (Plugin::unhandledCsharpException)
-				{
-					System::Exception* ex = Plugin::unhandledCsharpException;
-					Plugin::unhandledCsharpException = nullptr;
-					ex->ThrowReferenceToThis();
-					delete ex;
-				}
-			}
+			Plugin::DereferenceManagedClass(Handle);
 		}
 		Handle = other.Handle;
+		InternalLength = other.InternalLength;
 		other.Handle = 0;
+		other.InternalLength = 0;
 		return *this;
 	}
 	
-	bool MyGame::BaseBallScript::operator==(const MyGame::BaseBallScript& other) const
+	bool Array1<UnityEngine::RaycastHit>::operator==(const Array1<UnityEngine::RaycastHit>& other) const
 	{
 		return Handle == other.Handle;
 	}
 	
-	bool MyGame::BaseBallScript::operator!=(const MyGame::BaseBallScript& other) const
+	bool Array1<UnityEngine::RaycastHit>::operator!=(const Array1<UnityEngine::RaycastHit>& other) const
 	{
 		return Handle != other.Handle;
 	}
 	
-	DLLEXPORT int32_t NewBaseBallScript(int32_t handle)
+	System::Array1<UnityEngine::RaycastHit>::Array1(System::Int32 length0)
+		: System::ICloneable(nullptr)
+		, System::Collections::IEnumerable(nullptr)
+		, System::Collections::ICollection(nullptr)
+		, System::Collections::IList(nullptr)
+		, System::Collections::IStructuralComparable(nullptr)
+		, System::Collections::IStructuralEquatable(nullptr)
+		, System::Array(nullptr)
+		, System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IList_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>(nullptr)
+		, System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>(nullptr)
+	{
+		auto returnValue = Plugin::UnityEngineUnityEngineRaycastHitArray1Constructor1(length0);
+		if (Plugin::unhandledCsharpException)
+		{
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		Handle = returnValue;
+		if (returnValue)
+		{
+			Plugin::ReferenceManagedClass(returnValue);
+			InternalLength = length0;
+		}
+	}
+	
+	System::Int32 System::Array1<UnityEngine::RaycastHit>::GetLength()
 	{
-		MyGame::BaseBallScript* memory = Plugin::StoreWholeBaseBallScript();
-		MyGame::BallScript* thiz = new (memory) MyGame::BallScript(Plugin::InternalUse::Only, handle);
-		return thiz->CppHandle;
+		int32_t returnVal = InternalLength;
+		if (returnVal == 0)
+		{
+			returnVal = Array::GetLength();
+			InternalLength = returnVal;
+		};
+		return returnVal;
 	}
-
-	DLLEXPORT void DestroyBaseBallScript(int32_t cppHandle)
+	
+	System::Int32 System::Array1<UnityEngine::RaycastHit>::GetRank()
 	{
-		MyGame::BaseBallScript* instance = Plugin::GetBaseBallScript(cppHandle);
-		instance->~BaseBallScript();
+		return 1;
 	}
-
-	void MyGame::BaseBallScript::Update()
+	
+	Plugin::ArrayElementProxy1_1<UnityEngine::RaycastHit> System::Array1<UnityEngine::RaycastHit>::operator[](int32_t index)
 	{
+		return Plugin::ArrayElementProxy1_1<UnityEngine::RaycastHit>(Plugin::InternalUse::Only, Handle, index);
 	}
 	
-	DLLEXPORT void MyGameAbstractBaseBallScriptUpdate(int32_t cppHandle)
+	void Array1<UnityEngine::RaycastHit>::GetValues(int32_t startIndex, int32_t count, UnityEngine::RaycastHitValue* values)
 	{
-		try
+		for (int32_t i = 0; i < count; ++i)
 		{
-			Plugin::GetBaseBallScript(cppHandle)->Update();
+			values[i] = UnityEngine::RaycastHitValue();
 		}
-		catch (System::Exception ex)
+		Plugin::UnityEngineRaycastHitArray1GetValues(Handle, startIndex, count, values);
+		for (int32_t i = 0; i < count; ++i)
 		{
-			Plugin::SetException(ex.Handle);
+			Plugin::ReferenceManagedClass(values[i].colliderHandle);
 		}
-		catch (...)
+		if (Plugin::unhandledCsharpException)
 		{
-			System::String msg = "Unhandled exception invoking MyGame::AbstractBaseBallScript";
-			System::Exception ex(msg);
-			Plugin::SetException(ex.Handle);
+			Plugin::ThrowUnhandledCsharpException();
 		}
 	}
 }
 
-namespace System
+namespace Plugin
 {
-	System::Object::operator System::Boolean()
+	UnityEngineRaycastHitArray1Iterator::UnityEngineRaycastHitArray1Iterator(System::Array1<UnityEngine::RaycastHit>& array, int32_t index)
+		: array(array)
+		, index(index)
+		, length(-1)
+		, bufferStart(index)
+		, bufferCount(0)
 	{
-		System::Boolean returnVal(Plugin::UnboxBoolean(Handle));
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return returnVal;
 	}
-}
-
-namespace System
-{
-	System::Object::operator System::SByte()
+	
+	UnityEngineRaycastHitArray1Iterator::UnityEngineRaycastHitArray1Iterator(UnityEngineRaycastHitArray1Iterator&& other)
+		: array(other.array)
+		, index(other.index)
+		, length(other.length)
+		, bufferStart(other.bufferStart)
+		, bufferCount(other.bufferCount)
 	{
-		System::SByte returnVal(Plugin::UnboxSByte(Handle));
-		if (Plugin::unhandledCsharpException)
+		for (int32_t i = 0; i < bufferCount; ++i)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			buffer[i] = other.buffer[i];
 		}
-		return returnVal;
+		other.bufferCount = 0;
 	}
-}
-
-namespace System
-{
-	System::Object::operator System::Byte()
+	
+	UnityEngineRaycastHitArray1Iterator::~UnityEngineRaycastHitArray1Iterator()
 	{
-		System::Byte returnVal(Plugin::UnboxByte(Handle));
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return returnVal;
+		ReleaseItems();
 	}
-}
-
-namespace System
-{
-	System::Object::operator System::Int16()
+	
+	UnityEngineRaycastHitArray1Iterator& UnityEngineRaycastHitArray1Iterator::operator++()
 	{
-		System::Int16 returnVal(Plugin::UnboxInt16(Handle));
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return returnVal;
+		index++;
+		return *this;
 	}
-}
-
-namespace System
-{
-	System::Object::operator System::UInt16()
+	
+	bool UnityEngineRaycastHitArray1Iterator::operator!=(const UnityEngineRaycastHitArray1Iterator& other)
 	{
-		System::UInt16 returnVal(Plugin::UnboxUInt16(Handle));
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return returnVal;
+		return index != other.index;
 	}
-}
-
-namespace System
-{
-	System::Object::operator System::Int32()
+	
+	UnityEngine::RaycastHit UnityEngineRaycastHitArray1Iterator::operator*()
 	{
-		System::Int32 returnVal(Plugin::UnboxInt32(Handle));
-		if (Plugin::unhandledCsharpException)
+		int32_t offset = index - bufferStart;
+		if (offset < 0 || offset >= bufferCount)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			FetchItems();
+			offset = 0;
 		}
-		return returnVal;
+		return UnityEngine::RaycastHit(Plugin::InternalUse::Only, buffer[offset]);
 	}
-}
-
-namespace System
-{
-	System::Object::operator System::UInt32()
+	
+	void UnityEngineRaycastHitArray1Iterator::FetchItems()
 	{
-		System::UInt32 returnVal(Plugin::UnboxUInt32(Handle));
+		ReleaseItems();
+		if (length < 0)
+		{
+			length = array.GetLength();
+		}
+		int32_t count = length - index;
+		if (count > ArrayIteratorChunkSize)
+		{
+			count = ArrayIteratorChunkSize;
+		}
+		Plugin::UnityEngineRaycastHitArray1GetItems(array.Handle, index, count, buffer);
 		if (Plugin::unhandledCsharpException)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			Plugin::ThrowUnhandledCsharpException();
+		}
+		bufferStart = index;
+		bufferCount = count;
+		for (int32_t i = 0; i < count; ++i)
+		{
+			if (buffer[i])
+			{
+				Plugin::ReferenceManagedUnityEngineRaycastHit(buffer[i]);
+			}
 		}
-		return returnVal;
 	}
-}
-
-namespace System
-{
-	System::Object::operator System::Int64()
+	
+	void UnityEngineRaycastHitArray1Iterator::ReleaseItems()
 	{
-		System::Int64 returnVal(Plugin::UnboxInt64(Handle));
-		if (Plugin::unhandledCsharpException)
+		for (int32_t i = 0; i < bufferCount; ++i)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			if (buffer[i])
+			{
+				Plugin::DereferenceManagedUnityEngineRaycastHit(buffer[i]);
+			}
 		}
-		return returnVal;
+		bufferCount = 0;
 	}
 }
 
 namespace System
 {
-	System::Object::operator System::UInt64()
+	Plugin::UnityEngineRaycastHitArray1Iterator begin(System::Array1<UnityEngine::RaycastHit>& array)
 	{
-		System::UInt64 returnVal(Plugin::UnboxUInt64(Handle));
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return returnVal;
+		return Plugin::UnityEngineRaycastHitArray1Iterator(array, 0);
+	}
+	
+	Plugin::UnityEngineRaycastHitArray1Iterator end(System::Array1<UnityEngine::RaycastHit>& array)
+	{
+		return Plugin::UnityEngineRaycastHitArray1Iterator(array, array.GetLength());
 	}
 }
 
-namespace System
+namespace Plugin
 {
-	System::Object::operator System::Char()
+	void ThrowSystemNullReferenceException(int32_t handle)
 	{
-		System::Char returnVal(Plugin::UnboxChar(Handle));
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return returnVal;
+#if !PLUGIN_EXCEPTIONS
+		(void)handle;
+#endif
+		PLUGIN_THROW(System::NullReferenceException(Plugin::InternalUse::Only, handle));
 	}
 }
 
-namespace System
+DLLEXPORT void SetCsharpExceptionSystemNullReferenceException()
 {
-	System::Object::operator System::Single()
-	{
-		System::Single returnVal(Plugin::UnboxSingle(Handle));
-		if (Plugin::unhandledCsharpException)
-		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
-		}
-		return returnVal;
-	}
+	Plugin::unhandledCsharpException = Plugin::ThrowSystemNullReferenceException;
 }
+/*END METHOD DEFINITIONS*/
 
-namespace System
+////////////////////////////////////////////////////////////////
+// Snapshots of plugin memory
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
 {
-	System::Object::operator System::Double()
+	// Snapshots only copy the pages of this size that have changed
+	const size_t SnapshotPageSize = 4096;
+	
+	// Snapshots are laid out one after another. Each is an image of the
+	// plugin memory with everything at the same offset.
+	uint8_t* GetSnapshot(uint8_t* snapshots, int32_t slot)
 	{
-		System::Double returnVal(Plugin::UnboxDouble(Handle));
-		if (Plugin::unhandledCsharpException)
+		return snapshots
+			+ RoundUpToCommitGranularity(MemoryEnd - MemoryBegin) * slot;
+	}
+	
+	// Copy the pages of a range that differ. Returns the number of bytes
+	// copied.
+	size_t CopyChangedPages(uint8_t* dest, const uint8_t* src, size_t size)
+	{
+		size_t numCopied = 0;
+		for (size_t offset = 0; offset < size; offset += SnapshotPageSize)
 		{
-			System::Exception* ex = Plugin::unhandledCsharpException;
-			Plugin::unhandledCsharpException = nullptr;
-			ex->ThrowReferenceToThis();
-			delete ex;
+			size_t pageSize = size - offset < SnapshotPageSize
+				? size - offset
+				: SnapshotPageSize;
+			if (memcmp(dest + offset, src + offset, pageSize))
+			{
+				memcpy(dest + offset, src + offset, pageSize);
+				numCopied += pageSize;
+			}
 		}
-		return returnVal;
+		return numCopied;
 	}
-}
-
-namespace System
-{
-	struct NullReferenceExceptionThrower : System::NullReferenceException
+	
+	// Copy the used parts of one image of plugin memory to another. The
+	// Init regions are copied first, which includes the allocators that
+	// say what else is used. Snapshot pages are committed when saving to
+	// them. Returns the number of bytes copied or -1 if the pages
+	// couldn't be committed.
+	int32_t CopySnapshotRanges(uint8_t* dest, uint8_t* src, bool commitDest)
 	{
-		NullReferenceExceptionThrower(int32_t handle)
-			: System::Runtime::InteropServices::_Exception(nullptr)
-			, System::Runtime::Serialization::ISerializable(nullptr)
-			, System::Exception(nullptr)
-			, System::SystemException(nullptr)
-			, System::NullReferenceException(Plugin::InternalUse::Only, handle)
+		size_t allocatorsOffset = (uint8_t*)Allocators - MemoryBegin;
+		size_t offsets[4] = { 0 };
+		size_t sizes[4] = { allocatorsOffset + sizeof(MemoryAllocators) };
+		MemoryAllocators* allocators = (MemoryAllocators*)(
+			src + allocatorsOffset);
+		LinearAllocator* ranges[3] = {
+			&allocators->Persistent,
+			&allocators->Frames[0],
+			&allocators->Frames[1] };
+		for (int32_t i = 0; i < 3; ++i)
 		{
+			offsets[i + 1] = ranges[i]->Begin - MemoryBegin;
+			sizes[i + 1] = ranges[i]->Cur - ranges[i]->Begin;
 		}
-	
-		virtual void ThrowReferenceToThis()
+		
+		size_t numCopied = 0;
+		for (int32_t i = 0; i < 4; ++i)
 		{
-			throw *this;
+			if (commitDest && sizes[i])
+			{
+				size_t commitBegin = RoundDownToCommitGranularity(offsets[i]);
+				size_t commitEnd = RoundUpToCommitGranularity(
+					offsets[i] + sizes[i]);
+				if (!CommitMemoryPages(
+					dest + commitBegin,
+					commitEnd - commitBegin))
+				{
+					return -1;
+				}
+			}
+			numCopied += CopyChangedPages(
+				dest + offsets[i],
+				src + offsets[i],
+				sizes[i]);
 		}
-	};
-}
-
-DLLEXPORT void SetCsharpExceptionSystemNullReferenceException(int32_t handle)
-{
-	delete Plugin::unhandledCsharpException;
-	Plugin::unhandledCsharpException = new System::NullReferenceExceptionThrower(handle);
+		return (int32_t)numCopied;
+	}
 }
-/*END METHOD DEFINITIONS*/
 
 ////////////////////////////////////////////////////////////////
 // App-specific functions for this file to call
@@ -6143,6 +9535,48 @@ enum class InitMode : uint8_t
 	Reload
 };
 
+// Reserve address space for the plugin memory and commit the start of it
+// for C# to pass parameters to Init in. All of it is committed if large pages
+// are used. Returns null on failure.
+DLLEXPORT uint8_t* ReservePluginMemory(
+	int32_t memorySize,
+	int32_t commitSize,
+	int32_t useLargePages)
+{
+	size_t size = Plugin::RoundUpToCommitGranularity(memorySize);
+	uint8_t* memory = Plugin::ReserveMemory(size, useLargePages != 0);
+	if (!memory)
+	{
+		return nullptr;
+	}
+	if (useLargePages && Plugin::UseLargePages(memory, size))
+	{
+		return memory;
+	}
+	if (commitSize > memorySize)
+	{
+		commitSize = memorySize;
+	}
+	if (!Plugin::CommitMemoryPages(
+		memory,
+		Plugin::RoundUpToCommitGranularity(commitSize)))
+	{
+		Plugin::ReleaseMemory(memory, size);
+		return nullptr;
+	}
+	return memory;
+}
+
+// Release the plugin memory reserved by ReservePluginMemory
+DLLEXPORT void ReleasePluginMemory(
+	uint8_t* memory,
+	int32_t memorySize)
+{
+	Plugin::ReleaseMemory(
+		memory,
+		Plugin::RoundUpToCommitGranularity(memorySize));
+}
+
 // Init the plugin
 DLLEXPORT void Init(
 	uint8_t* memory,
@@ -6150,6 +9584,9 @@ DLLEXPORT void Init(
 	InitMode initMode)
 {
 	uint8_t* curMemory = memory;
+	Plugin::MemoryBegin = memory;
+	Plugin::MemoryEnd = memory + memorySize;
+	Plugin::MemoryCommitEnd = memory;
 	
 	// Read fixed parameters
 	Plugin::ReleaseObject = *(void (**)(int32_t handle))curMemory;
@@ -6162,6 +9599,40 @@ DLLEXPORT void Init(
 	curMemory += sizeof(Plugin::ArrayGetLength);
 	Plugin::EnumerableGetEnumerator = *(int32_t (**)(int32_t))curMemory;
 	curMemory += sizeof(Plugin::EnumerableGetEnumerator);
+	Plugin::EnumeratorMoveNextBatch = *(int32_t (**)(int32_t, int32_t*, int32_t))curMemory;
+	curMemory += sizeof(Plugin::EnumeratorMoveNextBatch);
+	Plugin::StoreCsharpException = *(int32_t (**)())curMemory;
+	curMemory += sizeof(Plugin::StoreCsharpException);
+	Plugin::GameObjectPoolPrewarm = *(int32_t (**)(int32_t, int32_t, int32_t*, int32_t*))curMemory;
+	curMemory += sizeof(Plugin::GameObjectPoolPrewarm);
+	Plugin::ApplyGameObjectPoolCommands = *(void (**)())curMemory;
+	curMemory += sizeof(Plugin::ApplyGameObjectPoolCommands);
+	Plugin::SpawnGameObjectBatch = *(int32_t (**)(const Plugin::SpawnDescriptor*, int32_t, const int32_t*, const Plugin::SpawnComponent*, int32_t*))curMemory;
+	curMemory += sizeof(Plugin::SpawnGameObjectBatch);
+	
+	// C# records physics messages directly into this queue
+	int32_t maxPhysicsMessages = *(int32_t*)curMemory;
+	curMemory += sizeof(int32_t);
+	Plugin::PhysicsMessages = (Plugin::PhysicsMessageQueue*)curMemory;
+	curMemory += sizeof(Plugin::PhysicsMessageQueue)
+		+ maxPhysicsMessages * sizeof(Plugin::PhysicsMessage);
+	
+	// C# sets bits in this when objects are destroyed
+	int32_t numDestroyedObjectBits = *(int32_t*)curMemory;
+	curMemory += sizeof(int32_t);
+	Plugin::DestroyedObjects = (uint32_t*)curMemory;
+	curMemory += ((numDestroyedObjectBits + 31) / 32) * sizeof(uint32_t);
+	
+	// C# makes the changes to pooled GameObjects queued in this
+	int32_t maxGameObjectPoolCommands = *(int32_t*)curMemory;
+	curMemory += sizeof(int32_t);
+	Plugin::GameObjectPoolCommands = (Plugin::GameObjectPoolCommandQueue*)curMemory;
+	curMemory += sizeof(Plugin::GameObjectPoolCommandQueue)
+		+ maxGameObjectPoolCommands * sizeof(Plugin::GameObjectPoolCommand);
+	
+	// Size of each of the two frame memories
+	int32_t frameMemorySize = *(int32_t*)curMemory;
+	curMemory += sizeof(int32_t);
 	
 	// Read generated parameters
 	int32_t maxManagedObjects = *(int32_t*)curMemory;
@@ -6213,11 +9684,25 @@ DLLEXPORT void Init(
 	curMemory += sizeof(Plugin::BoxPrimitiveType);
 	Plugin::UnboxPrimitiveType = *(UnityEngine::PrimitiveType (**)(int32_t valHandle))curMemory;
 	curMemory += sizeof(Plugin::UnboxPrimitiveType);
+	Plugin::ReleaseUnityEngineRaycastHit = *(void (**)(int32_t handle))curMemory;
+	curMemory += sizeof(Plugin::ReleaseUnityEngineRaycastHit);
+	Plugin::UnityEngineRaycastHitGetValue = *(void (**)(int32_t thisHandle, void* value))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineRaycastHitGetValue);
+	Plugin::BoxRaycastHit = *(int32_t (**)(int32_t valHandle))curMemory;
+	curMemory += sizeof(Plugin::BoxRaycastHit);
+	Plugin::UnboxRaycastHit = *(int32_t (**)(int32_t valHandle))curMemory;
+	curMemory += sizeof(Plugin::UnboxRaycastHit);
+	Plugin::SystemIDisposableMethodDispose = *(void (**)(int32_t thisHandle))curMemory;
+	curMemory += sizeof(Plugin::SystemIDisposableMethodDispose);
+	Plugin::SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumerator = *(int32_t (**)(int32_t thisHandle))curMemory;
+	curMemory += sizeof(Plugin::SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumerator);
+	Plugin::SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrent = *(int32_t (**)(int32_t thisHandle))curMemory;
+	curMemory += sizeof(Plugin::SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrent);
 	Plugin::UnityEngineTimePropertyGetDeltaTime = *(float (**)())curMemory;
 	curMemory += sizeof(Plugin::UnityEngineTimePropertyGetDeltaTime);
 	Plugin::ReleaseBaseBallScript = *(void (**)(int32_t handle))curMemory;
 	curMemory += sizeof(Plugin::ReleaseBaseBallScript);
-	Plugin::BaseBallScriptConstructor = *(void (**)(int32_t cppHandle, int32_t* handle))curMemory;
+	Plugin::BaseBallScriptConstructor = *(void (**)(int32_t cppHandle, void* cppPointer, int32_t* handle))curMemory;
 	curMemory += sizeof(Plugin::BaseBallScriptConstructor);
 	Plugin::BoxBoolean = *(int32_t (**)(uint32_t val))curMemory;
 	curMemory += sizeof(Plugin::BoxBoolean);
@@ -6267,32 +9752,79 @@ DLLEXPORT void Init(
 	curMemory += sizeof(Plugin::BoxDouble);
 	Plugin::UnboxDouble = *(double (**)(int32_t valHandle))curMemory;
 	curMemory += sizeof(Plugin::UnboxDouble);
+	Plugin::UnityEngineUnityEngineRaycastHitArray1Constructor1 = *(int32_t (**)(int32_t length0))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineUnityEngineRaycastHitArray1Constructor1);
+	Plugin::UnityEngineRaycastHitArray1GetItem1 = *(int32_t (**)(int32_t thisHandle, int32_t index0))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineRaycastHitArray1GetItem1);
+	Plugin::UnityEngineRaycastHitArray1SetItem1 = *(int32_t (**)(int32_t thisHandle, int32_t index0, int32_t itemHandle))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineRaycastHitArray1SetItem1);
+	Plugin::UnityEngineRaycastHitArray1GetValues = *(void (**)(int32_t thisHandle, int32_t startIndex, int32_t count, void* values))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineRaycastHitArray1GetValues);
+	Plugin::UnityEngineRaycastHitArray1GetItems = *(void (**)(int32_t thisHandle, int32_t startIndex, int32_t count, void* items))curMemory;
+	curMemory += sizeof(Plugin::UnityEngineRaycastHitArray1GetItems);
 	/*END INIT BODY PARAMETER READS*/
 	
-	// Init managed object ref counting
+	// Init managed object ref counting. Every region from here on starts on
+	// a cache line. The ref counts and pointer free lists that are used on
+	// most calls come first and the whole object pools follow them.
 	Plugin::RefCountsLenClass = maxManagedObjects;
-	Plugin::RefCountsClass = (int32_t*)curMemory;
-	curMemory += maxManagedObjects * sizeof(int32_t);
+	Plugin::RefCountsClass = Plugin::PlaceRegion<int32_t>(
+		curMemory,
+		maxManagedObjects);
+	
+	// Generations of those handles and the maps keyed by them
+	Plugin::HandleGenerations = Plugin::PlaceRegion<uint32_t>(
+		curMemory,
+		maxManagedObjects);
+	Plugin::HandleMaps = Plugin::PlaceRegion<
+		Plugin::IntrusiveList<Plugin::HandleMapBase>>(curMemory, 1);
+	
+	// Lists of dispatchers with queued events
+	Plugin::QueuedEventDispatchers = Plugin::PlaceRegion<
+		Plugin::QueuedEventDispatcherLists>(curMemory, 1);
 	
 	/*BEGIN INIT BODY ARRAYS*/
-	Plugin::RefCountsSystemDecimal = (int32_t*)curMemory;
-	curMemory += 1000 * sizeof(int32_t);
+	Plugin::RefCountsSystemDecimal = Plugin::PlaceRegion<int32_t>(curMemory, 1000);
 	Plugin::RefCountsLenSystemDecimal = 1000;
 	
-	Plugin::BaseBallScriptFreeListSize = 1000;
-	Plugin::BaseBallScriptFreeList = (MyGame::BaseBallScript**)curMemory;
-	curMemory += 1000 * sizeof(MyGame::BaseBallScript*);
+	Plugin::RefCountsUnityEngineRaycastHit = Plugin::PlaceRegion<int32_t>(curMemory, 1000);
+	Plugin::RefCountsLenUnityEngineRaycastHit = 1000;
+	
+	Plugin::BaseBallScriptFreeList = Plugin::ChunkedFreeList<MyGame::BaseBallScript*>::Place(curMemory, 1000);
+	
+	Plugin::BaseBallScriptHotFields = Plugin::PlaceRegion<Plugin::SoaTable<MyGame::BaseBallScript*, float>>(curMemory, 1);
 	
-	Plugin::BaseBallScriptFreeWholeListSize = 1000;
-	Plugin::BaseBallScriptFreeWholeList = (Plugin::BaseBallScriptFreeWholeListEntry*)curMemory;
-	curMemory += 1000 * sizeof(Plugin::BaseBallScriptFreeWholeListEntry);
+	Plugin::BaseBallScriptsByGameObject = Plugin::PlaceRegion<Plugin::HashMap<int32_t, MyGame::BaseBallScript*>>(curMemory, 1);
+	
+	Plugin::BaseBallScriptFreeWholeList = Plugin::ChunkedFreeList<MyGame::BallScript>::Place(curMemory, 1000);
 	/*END INIT BODY ARRAYS*/
 	
+	// Allocators for the memory passed to PluginMain
+	Plugin::Allocators = Plugin::PlaceRegion<Plugin::MemoryAllocators>(
+		curMemory,
+		1);
+	uint8_t* persistentMemory = Plugin::AlignPointer(
+		curMemory,
+		Plugin::DefaultAlignment);
+	
+	// Frame memory goes at the end so persistent memory is committed from
+	// its start up
+	size_t frameSize = Plugin::RoundUpToCommitGranularity(frameMemorySize);
+	size_t frameOffset = Plugin::RoundDownToCommitGranularity(memorySize);
+	frameOffset = frameOffset > 2 * frameSize ? frameOffset - 2 * frameSize : 0;
+	uint8_t* frameMemory = memory + frameOffset;
+	
 	// Make sure there was enough memory
 	int32_t usedMemory = (int32_t)(curMemory - (uint8_t*)memory);
-	if (usedMemory > memorySize)
-	{
-		System::String msg = "Plugin memory size is too low";
+	if (persistentMemory > frameMemory || !Plugin::CommitMemory(curMemory))
+	{
+		char buf[128];
+		snprintf(
+			buf,
+			sizeof(buf),
+			"Plugin memory size is too low. At least %lld bytes are needed.",
+			(long long)(persistentMemory - memory) + 2 * (long long)frameSize);
+		System::String msg = buf;
 		System::Exception ex(msg);
 		Plugin::SetException(ex.Handle);
 		return;
@@ -6300,50 +9832,124 @@ DLLEXPORT void Init(
 	
 	if (initMode == InitMode::FirstBoot)
 	{
-		// Clear memory
-		memset(memory, 0, memorySize);
+		// Clear memory. The rest hasn't been committed yet, so it's already
+		// clear.
+		memset(memory, 0, usedMemory);
+		Plugin::PhysicsMessages->Capacity = maxPhysicsMessages;
+		Plugin::GameObjectPoolCommands->Capacity = maxGameObjectPoolCommands;
+		Plugin::Allocators->Persistent.Init(persistentMemory, frameMemory);
+		Plugin::Allocators->Frames[0].Init(
+			frameMemory,
+			frameMemory + frameSize);
+		Plugin::Allocators->Frames[1].Init(
+			frameMemory + frameSize,
+			frameMemory + 2 * frameSize);
+		Plugin::Allocators->Heap.Init(
+			&Plugin::Allocators->Persistent,
+			Plugin::HeapMemoryPoolSize);
 		
 		/*BEGIN INIT BODY FIRST BOOT*/
-		for (int32_t i = 0, end = Plugin::BaseBallScriptFreeListSize - 1; i < end; ++i)
-		{
-			Plugin::BaseBallScriptFreeList[i] = (MyGame::BaseBallScript*)(Plugin::BaseBallScriptFreeList + i + 1);
-		}
-		Plugin::BaseBallScriptFreeList[Plugin::BaseBallScriptFreeListSize - 1] = nullptr;
-		Plugin::NextFreeBaseBallScript = Plugin::BaseBallScriptFreeList + 1;
+		Plugin::BaseBallScriptFreeList->Init(1000);
+		
+		Plugin::BaseBallScriptFreeWholeList->Init(1000);
 		
-		for (int32_t i = 0, end = Plugin::BaseBallScriptFreeWholeListSize - 1; i < end; ++i)
-		{
-			Plugin::BaseBallScriptFreeWholeList[i].Next = Plugin::BaseBallScriptFreeWholeList + i + 1;
-		}
-		Plugin::BaseBallScriptFreeWholeList[Plugin::BaseBallScriptFreeWholeListSize - 1].Next = nullptr;
-		Plugin::NextFreeWholeBaseBallScript = Plugin::BaseBallScriptFreeWholeList + 1;
 		/*END INIT BODY FIRST BOOT*/
 	}
 	
-	try
+	Plugin::PersistentMemory = &Plugin::Allocators->Persistent;
+	Plugin::FrameMemory = Plugin::Allocators->Frames
+		+ Plugin::Allocators->FrameIndex;
+	Plugin::HeapMemory = &Plugin::Allocators->Heap;
+	
+	PLUGIN_TRY
 	{
 		PluginMain(
-			curMemory,
-			(int32_t)(memorySize - usedMemory),
+			persistentMemory,
+			(int32_t)(frameMemory - persistentMemory),
 			initMode == InitMode::FirstBoot);
 	}
-	catch (System::Exception ex)
+	PLUGIN_CATCH_ALL
 	{
-		Plugin::SetException(ex.Handle);
+		Plugin::SetCaughtException("Unhandled exception in PluginMain");
 	}
-	catch (...)
+}
+
+// Receive an unhandled exception from C#
+DLLEXPORT void SetCsharpException()
+{
+	Plugin::unhandledCsharpException = Plugin::ThrowSystemException;
+}
+
+
+// Perform updates once per frame
+DLLEXPORT void UpdatePlugin()
+{
+	Plugin::SwapFrameMemory();
+	PLUGIN_TRY
 	{
-		System::String msg = "Unhandled exception in PluginMain";
-		System::Exception ex(msg);
-		Plugin::SetException(ex.Handle);
+		Plugin::DrainPhysicsMessages();
+		Plugin::DispatchQueuedEvents();
+	}
+	PLUGIN_CATCH_ALL
+	{
+		Plugin::SetCaughtException("Unhandled exception delivering physics messages and events");
 	}
 }
 
-// Receive an unhandled exception from C#
-DLLEXPORT void SetCsharpException(int32_t handle)
+// Get the usage of each part of plugin memory. Returns how many parts there
+// are, which may be more than maxUsages.
+DLLEXPORT int32_t GetPluginMemoryUsage(
+	Plugin::MemoryUsage* usages,
+	int32_t maxUsages)
+{
+	return Plugin::GetMemoryUsage(usages, maxUsages);
+}
+
+// Reserve address space for snapshots of the plugin memory. Their pages are
+// committed as they're saved. Returns null on failure.
+DLLEXPORT uint8_t* ReservePluginSnapshots(
+	int32_t memorySize,
+	int32_t numSlots)
+{
+	return Plugin::ReserveMemory(
+		Plugin::RoundUpToCommitGranularity(memorySize) * numSlots,
+		false);
+}
+
+// Release the snapshots reserved by ReservePluginSnapshots
+DLLEXPORT void ReleasePluginSnapshots(
+	uint8_t* snapshots,
+	int32_t memorySize,
+	int32_t numSlots)
+{
+	Plugin::ReleaseMemory(
+		snapshots,
+		Plugin::RoundUpToCommitGranularity(memorySize) * numSlots);
+}
+
+// Save the used parts of plugin memory to a snapshot. Returns the number of
+// bytes that changed since the snapshot was last saved or -1 on failure.
+DLLEXPORT int32_t SavePluginSnapshot(
+	uint8_t* snapshots,
+	int32_t slot)
 {
-	Plugin::unhandledCsharpException = new System::Exception(
-		Plugin::InternalUse::Only,
-		handle);
+	return Plugin::CopySnapshotRanges(
+		Plugin::GetSnapshot(snapshots, slot),
+		Plugin::MemoryBegin,
+		true);
 }
 
+// Restore the plugin memory from a snapshot. Returns the number of bytes
+// that changed.
+DLLEXPORT int32_t RestorePluginSnapshot(
+	uint8_t* snapshots,
+	int32_t slot)
+{
+	int32_t numCopied = Plugin::CopySnapshotRanges(
+		Plugin::MemoryBegin,
+		Plugin::GetSnapshot(snapshots, slot),
+		false);
+	Plugin::FrameMemory = Plugin::Allocators->Frames
+		+ Plugin::Allocators->FrameIndex;
+	return numCopied;
+}
@@ -16,6 +16,25 @@
 // For size_t to support placement new and delete
 #include <stdlib.h>
 
+// For placement new in containers
+#include <new>
+
+// For memset(), etc.
+#include <string.h>
+
+// For checking that HandleMap values can be moved as bytes
+#include <type_traits>
+
+// C++ exceptions are used unless the compiler has them disabled, such as by
+// -fno-exceptions or by turning off NATIVE_SCRIPT_EXCEPTIONS in CMake.
+// Without them, a C# exception is passed back to C# as soon as C++ sees it
+// and the binding that caused it returns a default value.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+	#define PLUGIN_EXCEPTIONS 1
+#else
+	#define PLUGIN_EXCEPTIONS 0
+#endif
+
 ////////////////////////////////////////////////////////////////
 // Plugin internals. Do not name these in game code as they may
 // change without warning. For example:
@@ -42,6 +61,145 @@ namespace Plugin
 		ManagedType(InternalUse, int32_t handle);
 	};
 	
+	// Number of array elements fetched from C# in one call while iterating
+	// over an array with a range-based for loop
+	const int32_t ArrayIteratorChunkSize = 64;
+	
+	// Number of enumerator elements fetched from C# in one call while
+	// iterating over an IEnumerable with a range-based for loop
+	const int32_t EnumerableIteratorChunkSize = 64;
+	
+	// Elements of a Unity.Collections.NativeArray<T> viewed in place. The
+	// memory is owned by the NativeArray and is only valid while it is.
+	template <typename TElement> struct NativeArraySpan
+	{
+		TElement* Data;
+		int32_t Length;
+		
+		TElement& operator[](int32_t index)
+		{
+			return Data[index];
+		}
+		
+		TElement* begin()
+		{
+			return Data;
+		}
+		
+		TElement* end()
+		{
+			return Data + Length;
+		}
+	};
+	
+	template <typename... TColumns> struct SoaTable;
+	
+	// Kinds of physics messages that base types listing them in
+	// "BatchedMessages" record instead of calling into C++
+	enum struct PhysicsMessageType : int32_t
+	{
+		CollisionEnter,
+		CollisionStay,
+		CollisionExit,
+		TriggerEnter,
+		TriggerStay,
+		TriggerExit
+	};
+	
+	// A physics message as recorded by C#. Vectors are x, y, z. Trigger
+	// messages only fill in OtherHandle.
+	struct PhysicsMessage
+	{
+		PhysicsMessageType Type;
+		
+		// Which base type received the message
+		int32_t Receiver;
+		
+		// CppHandle of the script that received the message
+		int32_t CppHandle;
+		
+		// Handle to the other UnityEngine::Collider. Only valid while the
+		// message is being handled unless it's referenced, e.g. by
+		// constructing a UnityEngine::Collider with it.
+		int32_t OtherHandle;
+		
+		int32_t ContactCount;
+		float Point[3];
+		float Normal[3];
+		float Impulse[3];
+		float RelativeVelocity[3];
+	};
+	
+	// Ring buffer of physics messages shared with C#. The messages follow
+	// this header in memory.
+	struct PhysicsMessageQueue
+	{
+		int32_t Capacity;
+		int32_t ReadIndex;
+		int32_t Count;
+		int32_t NumDropped;
+	};
+	
+	// Kinds of changes C# makes to pooled GameObjects
+	enum struct GameObjectPoolCommandType : int32_t
+	{
+		Activate,
+		Deactivate,
+		Destroy
+	};
+	
+	// A change to a pooled GameObject for C# to make. Activate only sets
+	// the position, which is x, y, z, if HasPosition is non-zero. C#
+	// releases the handle after making the change if ReleaseHandle is
+	// non-zero.
+	struct GameObjectPoolCommand
+	{
+		GameObjectPoolCommandType Type;
+		int32_t Handle;
+		int32_t HasPosition;
+		int32_t ReleaseHandle;
+		float Position[3];
+	};
+	
+	// Commands shared with C#, which makes all of them at the end of each
+	// frame. The commands follow this header in memory.
+	struct GameObjectPoolCommandQueue
+	{
+		int32_t Capacity;
+		int32_t Count;
+		int32_t NumDropped;
+	};
+	
+	// C++ scripts that can be added to GameObjects spawned in a batch. There
+	// is one for each MonoBehaviour base type with a C++ derived type.
+	enum struct SpawnComponent : int32_t
+	{
+		/*BEGIN SPAWN COMPONENT ENUMERATORS*/
+		BaseBallScript,
+		/*END SPAWN COMPONENT ENUMERATORS*/
+	};
+	
+	// A GameObject to spawn in a batch
+	struct SpawnDescriptor
+	{
+		// Handle to a GameObject to instantiate or 0 to create a new one
+		int32_t PrefabHandle;
+		
+		// UnityEngine.PrimitiveType to create when there's no prefab or -1
+		// to create an empty GameObject
+		int32_t PrimitiveType;
+		
+		// Index of the name in the batch's names or -1 to not set it
+		int32_t NameIndex;
+		
+		// Range of the batch's components to add
+		int32_t FirstComponent;
+		int32_t NumComponents;
+		
+		// x, y, z
+		float Position[3];
+	};
+	
 	template <typename TElement> struct ArrayElementProxy1_1;
 	
 	template <typename TElement> struct ArrayElementProxy1_2;
@@ -297,6 +455,72 @@ namespace System
 {
 	template<typename TT0> struct IComparable_1;
 }
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<typename TT0> struct IEnumerable_1;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<typename TT0> struct IEnumerator_1;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<typename TT0> struct ICollection_1;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<typename TT0> struct IList_1;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<typename TT0> struct IReadOnlyCollection_1;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<typename TT0> struct IReadOnlyList_1;
+		}
+	}
+}
 /*END TEMPLATE DECLARATIONS*/
 
 /*BEGIN TYPE DECLARATIONS*/
@@ -421,6 +645,42 @@ namespace UnityEngine
 	struct PrimitiveType;
 }
 
+namespace UnityEngine
+{
+	struct Collider;
+}
+
+namespace UnityEngine
+{
+	struct RaycastHit;
+}
+
+namespace UnityEngine
+{
+	struct RaycastHitValue;
+}
+
+namespace System
+{
+	struct IDisposable;
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		struct IStructuralComparable;
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		struct IStructuralEquatable;
+	}
+}
+
 namespace UnityEngine
 {
 	struct Time;
@@ -572,6 +832,82 @@ namespace System
 {
 	template<> struct IComparable_1<System::Decimal>;
 }
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IEnumerable_1<UnityEngine::RaycastHit>;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IEnumerator_1<UnityEngine::RaycastHit>;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct ICollection_1<UnityEngine::RaycastHit>;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IList_1<UnityEngine::RaycastHit>;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IReadOnlyCollection_1<UnityEngine::RaycastHit>;
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IReadOnlyList_1<UnityEngine::RaycastHit>;
+		}
+	}
+}
+
+namespace Plugin
+{
+	template<> struct ArrayElementProxy1_1<UnityEngine::RaycastHit>;
+}
+
+namespace System
+{
+	template<> struct Array1<UnityEngine::RaycastHit>;
+}
 /*END TEMPLATE SPECIALIZATION DECLARATIONS*/
 
 ////////////////////////////////////////////////////////////////
@@ -594,6 +930,7 @@ namespace System
 		explicit operator System::Decimal();
 		explicit operator UnityEngine::Vector3();
 		explicit operator UnityEngine::PrimitiveType();
+		explicit operator UnityEngine::RaycastHit();
 		explicit operator System::Boolean();
 		explicit operator System::SByte();
 		explicit operator System::Byte();
@@ -1271,6 +1608,11 @@ namespace UnityEngine
 		Object& operator=(Object&& other);
 		bool operator==(const Object& other) const;
 		bool operator!=(const Object& other) const;
+		// Check if the object is alive without calling C#. Only
+		// objects C# marked are seen as destroyed: C++ scripts whose
+		// OnDestroy ran and objects whose handle was released. Other
+		// destroyed objects, such as a GameObject, still seem alive.
+		bool IsAlive() const;
 		System::String GetName();
 		void SetName(System::String& value);
 	};
@@ -1531,68 +1873,514 @@ namespace UnityEngine
 
 namespace UnityEngine
 {
-	struct Time : virtual System::Object
+	struct Collider : virtual UnityEngine::Component
 	{
-		Time(decltype(nullptr));
-		Time(Plugin::InternalUse, int32_t handle);
-		Time(const Time& other);
-		Time(Time&& other);
-		virtual ~Time();
-		Time& operator=(const Time& other);
-		Time& operator=(decltype(nullptr));
-		Time& operator=(Time&& other);
-		bool operator==(const Time& other) const;
-		bool operator!=(const Time& other) const;
-		static System::Single GetDeltaTime();
+		Collider(decltype(nullptr));
+		Collider(Plugin::InternalUse, int32_t handle);
+		Collider(const Collider& other);
+		Collider(Collider&& other);
+		virtual ~Collider();
+		Collider& operator=(const Collider& other);
+		Collider& operator=(decltype(nullptr));
+		Collider& operator=(Collider&& other);
+		bool operator==(const Collider& other) const;
+		bool operator!=(const Collider& other) const;
 	};
 }
 
-namespace MyGame
+namespace UnityEngine
 {
-	struct AbstractBaseBallScript : virtual UnityEngine::MonoBehaviour
+	struct RaycastHit : Plugin::ManagedType
+	{
+		RaycastHit(decltype(nullptr));
+		RaycastHit(Plugin::InternalUse, int32_t handle);
+		RaycastHit(const RaycastHit& other);
+		RaycastHit(RaycastHit&& other);
+		virtual ~RaycastHit();
+		RaycastHit& operator=(const RaycastHit& other);
+		RaycastHit& operator=(decltype(nullptr));
+		RaycastHit& operator=(RaycastHit&& other);
+		bool operator==(const RaycastHit& other) const;
+		bool operator!=(const RaycastHit& other) const;
+		UnityEngine::RaycastHitValue GetValue();
+		explicit operator System::ValueType();
+		explicit operator System::Object();
+	};
+}
+
+namespace UnityEngine
+{
+	struct RaycastHitValue
 	{
-		AbstractBaseBallScript(decltype(nullptr));
-		AbstractBaseBallScript(Plugin::InternalUse, int32_t handle);
-		AbstractBaseBallScript(const AbstractBaseBallScript& other);
-		AbstractBaseBallScript(AbstractBaseBallScript&& other);
-		virtual ~AbstractBaseBallScript();
-		AbstractBaseBallScript& operator=(const AbstractBaseBallScript& other);
-		AbstractBaseBallScript& operator=(decltype(nullptr));
-		AbstractBaseBallScript& operator=(AbstractBaseBallScript&& other);
-		bool operator==(const AbstractBaseBallScript& other) const;
-		bool operator!=(const AbstractBaseBallScript& other) const;
+		UnityEngine::Vector3 point;
+		UnityEngine::Vector3 normal;
+		System::Single distance;
+		int32_t colliderHandle;
+		RaycastHitValue();
+		RaycastHitValue(const RaycastHitValue& other);
+		RaycastHitValue(RaycastHitValue&& other);
+		~RaycastHitValue();
+		RaycastHitValue& operator=(const RaycastHitValue& other);
+		RaycastHitValue& operator=(RaycastHitValue&& other);
+		UnityEngine::Collider GetCollider() const;
 	};
 }
 
-namespace MyGame
+namespace System
 {
-	struct BaseBallScript : virtual MyGame::AbstractBaseBallScript
+	struct IDisposable : virtual System::Object
 	{
-		BaseBallScript(decltype(nullptr));
-		BaseBallScript(Plugin::InternalUse, int32_t handle);
-		BaseBallScript(const BaseBallScript& other);
-		BaseBallScript(BaseBallScript&& other);
-		virtual ~BaseBallScript();
-		BaseBallScript& operator=(const BaseBallScript& other);
-		BaseBallScript& operator=(decltype(nullptr));
-		BaseBallScript& operator=(BaseBallScript&& other);
-		bool operator==(const BaseBallScript& other) const;
-		bool operator!=(const BaseBallScript& other) const;
-		int32_t CppHandle;
-		BaseBallScript();
-		virtual void Update();
+		IDisposable(decltype(nullptr));
+		IDisposable(Plugin::InternalUse, int32_t handle);
+		IDisposable(const IDisposable& other);
+		IDisposable(IDisposable&& other);
+		virtual ~IDisposable();
+		IDisposable& operator=(const IDisposable& other);
+		IDisposable& operator=(decltype(nullptr));
+		IDisposable& operator=(IDisposable&& other);
+		bool operator==(const IDisposable& other) const;
+		bool operator!=(const IDisposable& other) const;
+		virtual void Dispose();
 	};
 }
-/*END TYPE DEFINITIONS*/
 
-/*BEGIN MACROS*/
-#define MY_GAME_BALL_SCRIPT_DEFAULT_CONSTRUCTOR_DECLARATION \
-	BallScript(Plugin::InternalUse iu, int32_t handle);
-	
-#define MY_GAME_BALL_SCRIPT_DEFAULT_CONSTRUCTOR_DEFINITION \
-	BallScript::BallScript(Plugin::InternalUse iu, int32_t handle) \
-		: UnityEngine::Object(nullptr) \
-		, UnityEngine::Component(nullptr) \
+namespace System
+{
+	namespace Collections
+	{
+		struct IStructuralComparable : virtual System::Object
+		{
+			IStructuralComparable(decltype(nullptr));
+			IStructuralComparable(Plugin::InternalUse, int32_t handle);
+			IStructuralComparable(const IStructuralComparable& other);
+			IStructuralComparable(IStructuralComparable&& other);
+			virtual ~IStructuralComparable();
+			IStructuralComparable& operator=(const IStructuralComparable& other);
+			IStructuralComparable& operator=(decltype(nullptr));
+			IStructuralComparable& operator=(IStructuralComparable&& other);
+			bool operator==(const IStructuralComparable& other) const;
+			bool operator!=(const IStructuralComparable& other) const;
+		};
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		struct IStructuralEquatable : virtual System::Object
+		{
+			IStructuralEquatable(decltype(nullptr));
+			IStructuralEquatable(Plugin::InternalUse, int32_t handle);
+			IStructuralEquatable(const IStructuralEquatable& other);
+			IStructuralEquatable(IStructuralEquatable&& other);
+			virtual ~IStructuralEquatable();
+			IStructuralEquatable& operator=(const IStructuralEquatable& other);
+			IStructuralEquatable& operator=(decltype(nullptr));
+			IStructuralEquatable& operator=(IStructuralEquatable&& other);
+			bool operator==(const IStructuralEquatable& other) const;
+			bool operator!=(const IStructuralEquatable& other) const;
+		};
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IEnumerable_1<UnityEngine::RaycastHit> : virtual System::Collections::IEnumerable
+			{
+				IEnumerable_1(decltype(nullptr));
+				IEnumerable_1(Plugin::InternalUse, int32_t handle);
+				IEnumerable_1(const IEnumerable_1<UnityEngine::RaycastHit>& other);
+				IEnumerable_1(IEnumerable_1<UnityEngine::RaycastHit>&& other);
+				virtual ~IEnumerable_1();
+				IEnumerable_1<UnityEngine::RaycastHit>& operator=(const IEnumerable_1<UnityEngine::RaycastHit>& other);
+				IEnumerable_1<UnityEngine::RaycastHit>& operator=(decltype(nullptr));
+				IEnumerable_1<UnityEngine::RaycastHit>& operator=(IEnumerable_1<UnityEngine::RaycastHit>&& other);
+				bool operator==(const IEnumerable_1<UnityEngine::RaycastHit>& other) const;
+				bool operator!=(const IEnumerable_1<UnityEngine::RaycastHit>& other) const;
+				virtual System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit> GetEnumerator();
+			};
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IEnumerator_1<UnityEngine::RaycastHit> : virtual System::IDisposable, virtual System::Collections::IEnumerator
+			{
+				IEnumerator_1(decltype(nullptr));
+				IEnumerator_1(Plugin::InternalUse, int32_t handle);
+				IEnumerator_1(const IEnumerator_1<UnityEngine::RaycastHit>& other);
+				IEnumerator_1(IEnumerator_1<UnityEngine::RaycastHit>&& other);
+				virtual ~IEnumerator_1();
+				IEnumerator_1<UnityEngine::RaycastHit>& operator=(const IEnumerator_1<UnityEngine::RaycastHit>& other);
+				IEnumerator_1<UnityEngine::RaycastHit>& operator=(decltype(nullptr));
+				IEnumerator_1<UnityEngine::RaycastHit>& operator=(IEnumerator_1<UnityEngine::RaycastHit>&& other);
+				bool operator==(const IEnumerator_1<UnityEngine::RaycastHit>& other) const;
+				bool operator!=(const IEnumerator_1<UnityEngine::RaycastHit>& other) const;
+				UnityEngine::RaycastHit GetCurrent();
+			};
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct ICollection_1<UnityEngine::RaycastHit> : virtual System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>
+			{
+				ICollection_1(decltype(nullptr));
+				ICollection_1(Plugin::InternalUse, int32_t handle);
+				ICollection_1(const ICollection_1<UnityEngine::RaycastHit>& other);
+				ICollection_1(ICollection_1<UnityEngine::RaycastHit>&& other);
+				virtual ~ICollection_1();
+				ICollection_1<UnityEngine::RaycastHit>& operator=(const ICollection_1<UnityEngine::RaycastHit>& other);
+				ICollection_1<UnityEngine::RaycastHit>& operator=(decltype(nullptr));
+				ICollection_1<UnityEngine::RaycastHit>& operator=(ICollection_1<UnityEngine::RaycastHit>&& other);
+				bool operator==(const ICollection_1<UnityEngine::RaycastHit>& other) const;
+				bool operator!=(const ICollection_1<UnityEngine::RaycastHit>& other) const;
+			};
+		}
+	}
+}
+
+namespace Plugin
+{
+	struct SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator
+	{
+		System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit> enumerator;
+		bool hasMore;
+		SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator(decltype(nullptr));
+		SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator(System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>& enumerable);
+		~SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator();
+		SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator& operator++();
+		bool operator!=(const SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator& other);
+		UnityEngine::RaycastHit operator*();
+	};
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator begin(System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>& enumerable);
+			Plugin::SystemCollectionsGenericICollectionUnityEngineRaycastHitIterator end(System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>& enumerable);
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IList_1<UnityEngine::RaycastHit> : virtual System::Collections::Generic::ICollection_1<UnityEngine::RaycastHit>
+			{
+				IList_1(decltype(nullptr));
+				IList_1(Plugin::InternalUse, int32_t handle);
+				IList_1(const IList_1<UnityEngine::RaycastHit>& other);
+				IList_1(IList_1<UnityEngine::RaycastHit>&& other);
+				virtual ~IList_1();
+				IList_1<UnityEngine::RaycastHit>& operator=(const IList_1<UnityEngine::RaycastHit>& other);
+				IList_1<UnityEngine::RaycastHit>& operator=(decltype(nullptr));
+				IList_1<UnityEngine::RaycastHit>& operator=(IList_1<UnityEngine::RaycastHit>&& other);
+				bool operator==(const IList_1<UnityEngine::RaycastHit>& other) const;
+				bool operator!=(const IList_1<UnityEngine::RaycastHit>& other) const;
+			};
+		}
+	}
+}
+
+namespace Plugin
+{
+	struct SystemCollectionsGenericIListUnityEngineRaycastHitIterator
+	{
+		System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit> enumerator;
+		bool hasMore;
+		SystemCollectionsGenericIListUnityEngineRaycastHitIterator(decltype(nullptr));
+		SystemCollectionsGenericIListUnityEngineRaycastHitIterator(System::Collections::Generic::IList_1<UnityEngine::RaycastHit>& enumerable);
+		~SystemCollectionsGenericIListUnityEngineRaycastHitIterator();
+		SystemCollectionsGenericIListUnityEngineRaycastHitIterator& operator++();
+		bool operator!=(const SystemCollectionsGenericIListUnityEngineRaycastHitIterator& other);
+		UnityEngine::RaycastHit operator*();
+	};
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericIListUnityEngineRaycastHitIterator begin(System::Collections::Generic::IList_1<UnityEngine::RaycastHit>& enumerable);
+			Plugin::SystemCollectionsGenericIListUnityEngineRaycastHitIterator end(System::Collections::Generic::IList_1<UnityEngine::RaycastHit>& enumerable);
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IReadOnlyCollection_1<UnityEngine::RaycastHit> : virtual System::Collections::Generic::IEnumerable_1<UnityEngine::RaycastHit>
+			{
+				IReadOnlyCollection_1(decltype(nullptr));
+				IReadOnlyCollection_1(Plugin::InternalUse, int32_t handle);
+				IReadOnlyCollection_1(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other);
+				IReadOnlyCollection_1(IReadOnlyCollection_1<UnityEngine::RaycastHit>&& other);
+				virtual ~IReadOnlyCollection_1();
+				IReadOnlyCollection_1<UnityEngine::RaycastHit>& operator=(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other);
+				IReadOnlyCollection_1<UnityEngine::RaycastHit>& operator=(decltype(nullptr));
+				IReadOnlyCollection_1<UnityEngine::RaycastHit>& operator=(IReadOnlyCollection_1<UnityEngine::RaycastHit>&& other);
+				bool operator==(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other) const;
+				bool operator!=(const IReadOnlyCollection_1<UnityEngine::RaycastHit>& other) const;
+			};
+		}
+	}
+}
+
+namespace Plugin
+{
+	struct SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator
+	{
+		System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit> enumerator;
+		bool hasMore;
+		SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator(decltype(nullptr));
+		SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator(System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>& enumerable);
+		~SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator();
+		SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator& operator++();
+		bool operator!=(const SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator& other);
+		UnityEngine::RaycastHit operator*();
+	};
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator begin(System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>& enumerable);
+			Plugin::SystemCollectionsGenericIReadOnlyCollectionUnityEngineRaycastHitIterator end(System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>& enumerable);
+		}
+	}
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			template<> struct IReadOnlyList_1<UnityEngine::RaycastHit> : virtual System::Collections::Generic::IReadOnlyCollection_1<UnityEngine::RaycastHit>
+			{
+				IReadOnlyList_1(decltype(nullptr));
+				IReadOnlyList_1(Plugin::InternalUse, int32_t handle);
+				IReadOnlyList_1(const IReadOnlyList_1<UnityEngine::RaycastHit>& other);
+				IReadOnlyList_1(IReadOnlyList_1<UnityEngine::RaycastHit>&& other);
+				virtual ~IReadOnlyList_1();
+				IReadOnlyList_1<UnityEngine::RaycastHit>& operator=(const IReadOnlyList_1<UnityEngine::RaycastHit>& other);
+				IReadOnlyList_1<UnityEngine::RaycastHit>& operator=(decltype(nullptr));
+				IReadOnlyList_1<UnityEngine::RaycastHit>& operator=(IReadOnlyList_1<UnityEngine::RaycastHit>&& other);
+				bool operator==(const IReadOnlyList_1<UnityEngine::RaycastHit>& other) const;
+				bool operator!=(const IReadOnlyList_1<UnityEngine::RaycastHit>& other) const;
+			};
+		}
+	}
+}
+
+namespace Plugin
+{
+	struct SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator
+	{
+		System::Collections::Generic::IEnumerator_1<UnityEngine::RaycastHit> enumerator;
+		bool hasMore;
+		SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator(decltype(nullptr));
+		SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator(System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>& enumerable);
+		~SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator();
+		SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator& operator++();
+		bool operator!=(const SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator& other);
+		UnityEngine::RaycastHit operator*();
+	};
+}
+
+namespace System
+{
+	namespace Collections
+	{
+		namespace Generic
+		{
+			Plugin::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator begin(System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>& enumerable);
+			Plugin::SystemCollectionsGenericIReadOnlyListUnityEngineRaycastHitIterator end(System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>& enumerable);
+		}
+	}
+}
+
+namespace UnityEngine
+{
+	struct Time : virtual System::Object
+	{
+		Time(decltype(nullptr));
+		Time(Plugin::InternalUse, int32_t handle);
+		Time(const Time& other);
+		Time(Time&& other);
+		virtual ~Time();
+		Time& operator=(const Time& other);
+		Time& operator=(decltype(nullptr));
+		Time& operator=(Time&& other);
+		bool operator==(const Time& other) const;
+		bool operator!=(const Time& other) const;
+		static System::Single GetDeltaTime();
+	};
+}
+
+namespace MyGame
+{
+	struct AbstractBaseBallScript : virtual UnityEngine::MonoBehaviour
+	{
+		AbstractBaseBallScript(decltype(nullptr));
+		AbstractBaseBallScript(Plugin::InternalUse, int32_t handle);
+		AbstractBaseBallScript(const AbstractBaseBallScript& other);
+		AbstractBaseBallScript(AbstractBaseBallScript&& other);
+		virtual ~AbstractBaseBallScript();
+		AbstractBaseBallScript& operator=(const AbstractBaseBallScript& other);
+		AbstractBaseBallScript& operator=(decltype(nullptr));
+		AbstractBaseBallScript& operator=(AbstractBaseBallScript&& other);
+		bool operator==(const AbstractBaseBallScript& other) const;
+		bool operator!=(const AbstractBaseBallScript& other) const;
+	};
+}
+
+namespace MyGame
+{
+	struct BaseBallScript : virtual MyGame::AbstractBaseBallScript
+	{
+		BaseBallScript(decltype(nullptr));
+		BaseBallScript(Plugin::InternalUse, int32_t handle);
+		BaseBallScript(const BaseBallScript& other);
+		BaseBallScript(BaseBallScript&& other);
+		virtual ~BaseBallScript();
+		BaseBallScript& operator=(const BaseBallScript& other);
+		BaseBallScript& operator=(decltype(nullptr));
+		BaseBallScript& operator=(BaseBallScript&& other);
+		bool operator==(const BaseBallScript& other) const;
+		bool operator!=(const BaseBallScript& other) const;
+		int32_t CppHandle;
+		BaseBallScript();
+		virtual void Update();
+		int32_t HotFieldsRow = -1;
+		float DirFallback = 1.0f;
+		float& GetDir();
+		int32_t GameObjectInstanceId = 0;
+		static MyGame::BaseBallScript* FindByGameObject(int32_t gameObjectInstanceId);
+	};
+}
+
+namespace Plugin
+{
+	// Columns of BaseBallScriptHotFields
+	struct BaseBallScriptHotFieldColumns
+	{
+		enum
+		{
+			Instance,
+			Dir
+		};
+	};
+	
+	// Hot fields of the MyGame::BaseBallScript objects C# created. There's
+	// one packed row per object, so loops over a column only touch live
+	// objects and do so in memory order.
+	extern SoaTable<MyGame::BaseBallScript*, float>* BaseBallScriptHotFields;
+}
+namespace Plugin
+{
+	template<> struct ArrayElementProxy1_1<UnityEngine::RaycastHit>
+	{
+		int32_t Handle;
+		int32_t Index0;
+		ArrayElementProxy1_1<UnityEngine::RaycastHit>(Plugin::InternalUse, int32_t handle, int32_t index0);
+		void operator=(UnityEngine::RaycastHit item);
+		operator UnityEngine::RaycastHit();
+	};
+}
+
+namespace System
+{
+	template<> struct Array1<UnityEngine::RaycastHit> : virtual System::Array, virtual System::ICloneable, virtual System::Collections::IList, virtual System::Collections::Generic::IList_1<UnityEngine::RaycastHit>, virtual System::Collections::Generic::IReadOnlyList_1<UnityEngine::RaycastHit>, virtual System::Collections::IStructuralComparable, virtual System::Collections::IStructuralEquatable
+	{
+		Array1(decltype(nullptr));
+		Array1(Plugin::InternalUse, int32_t handle);
+		Array1(const Array1<UnityEngine::RaycastHit>& other);
+		Array1(Array1<UnityEngine::RaycastHit>&& other);
+		virtual ~Array1();
+		Array1<UnityEngine::RaycastHit>& operator=(const Array1<UnityEngine::RaycastHit>& other);
+		Array1<UnityEngine::RaycastHit>& operator=(decltype(nullptr));
+		Array1<UnityEngine::RaycastHit>& operator=(Array1<UnityEngine::RaycastHit>&& other);
+		bool operator==(const Array1<UnityEngine::RaycastHit>& other) const;
+		bool operator!=(const Array1<UnityEngine::RaycastHit>& other) const;
+		int32_t InternalLength;
+		Array1(System::Int32 length0);
+		System::Int32 GetLength();
+		System::Int32 GetRank();
+		Plugin::ArrayElementProxy1_1<UnityEngine::RaycastHit> operator[](int32_t index);
+		void GetValues(int32_t startIndex, int32_t count, UnityEngine::RaycastHitValue* values);
+	};
+}
+
+namespace Plugin
+{
+	struct UnityEngineRaycastHitArray1Iterator
+	{
+		System::Array1<UnityEngine::RaycastHit>& array;
+		int index;
+		int32_t length;
+		int32_t bufferStart;
+		int32_t bufferCount;
+		int32_t buffer[ArrayIteratorChunkSize];
+		UnityEngineRaycastHitArray1Iterator(System::Array1<UnityEngine::RaycastHit>& array, int32_t index);
+		UnityEngineRaycastHitArray1Iterator(const UnityEngineRaycastHitArray1Iterator& other) = delete;
+		UnityEngineRaycastHitArray1Iterator(UnityEngineRaycastHitArray1Iterator&& other);
+		~UnityEngineRaycastHitArray1Iterator();
+		UnityEngineRaycastHitArray1Iterator& operator++();
+		bool operator!=(const UnityEngineRaycastHitArray1Iterator& other);
+		UnityEngine::RaycastHit operator*();
+		void FetchItems();
+		void ReleaseItems();
+	};
+}
+
+namespace System
+{
+	Plugin::UnityEngineRaycastHitArray1Iterator begin(System::Array1<UnityEngine::RaycastHit>& array);
+	Plugin::UnityEngineRaycastHitArray1Iterator end(System::Array1<UnityEngine::RaycastHit>& array);
+}
+/*END TYPE DEFINITIONS*/
+
+/*BEGIN MACROS*/
+#define MY_GAME_BALL_SCRIPT_DEFAULT_CONSTRUCTOR_DECLARATION \
+	BallScript(Plugin::InternalUse iu, int32_t handle);
+	
+#define MY_GAME_BALL_SCRIPT_DEFAULT_CONSTRUCTOR_DEFINITION \
+	BallScript::BallScript(Plugin::InternalUse iu, int32_t handle) \
+		: UnityEngine::Object(nullptr) \
+		, UnityEngine::Component(nullptr) \
 		, UnityEngine::Behaviour(nullptr) \
 		, UnityEngine::MonoBehaviour(nullptr) \
 		, MyGame::AbstractBaseBallScript(nullptr) \
@@ -1644,11 +2432,19 @@ namespace Plugin
 	{
 		System::Collections::IEnumerator enumerator;
 		bool hasMore;
+		int32_t index;
+		int32_t count;
+		int32_t handles[EnumerableIteratorChunkSize];
 		EnumerableIterator(decltype(nullptr));
 		EnumerableIterator(System::Collections::IEnumerable& enumerable);
+		EnumerableIterator(const EnumerableIterator& other) = delete;
+		EnumerableIterator(EnumerableIterator&& other);
+		~EnumerableIterator();
 		EnumerableIterator& operator++();
 		bool operator!=(const EnumerableIterator& other);
 		System::Object operator*();
+		void FetchItems();
+		void ReleaseItems();
 	};
 }
 
@@ -1661,6 +2457,1494 @@ namespace System
 	}
 }
 
+////////////////////////////////////////////////////////////////
+// Native multicast event dispatch
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// A dispatcher that can hold events to deliver once per frame
+	struct QueuedEventDispatcher
+	{
+		QueuedEventDispatcher* NextQueued;
+		bool IsQueued;
+		QueuedEventDispatcher();
+		QueuedEventDispatcher(const QueuedEventDispatcher& other) = delete;
+		virtual ~QueuedEventDispatcher();
+		virtual void DispatchQueued() = 0;
+	};
+	
+	// Deliver the dispatcher's queued events during the next update
+	void QueueEventDispatch(QueuedEventDispatcher* dispatcher);
+	
+	// Deliver the events of all the queued dispatchers. Called once per frame.
+	void DispatchQueuedEvents();
+	
+	// Calls every native handler subscribed to an event. Subscribe one C++
+	// delegate to the C# event and have it call Dispatch() so each event
+	// crosses from C# once no matter how many handlers there are. Handlers
+	// are stored contiguously and called in the order they were added.
+	// Events may instead be queued and delivered together once per frame by
+	// Bindings.Update(). Payloads must be default-constructible and copyable.
+	template <typename TPayload, int32_t MaxHandlers = 16, int32_t MaxQueued = 64>
+	struct MulticastDispatcher : QueuedEventDispatcher
+	{
+		typedef void (*Handler)(void* context, TPayload& payload);
+		
+		struct Subscriber
+		{
+			Handler Function;
+			void* Context;
+		};
+		
+		Subscriber Subscribers[MaxHandlers];
+		int32_t NumSubscribers;
+		int32_t DispatchDepth;
+		TPayload Queue[MaxQueued];
+		int32_t NumQueued;
+		bool IsDispatchingQueued;
+		
+		// Events dropped because the queue was full while it was being
+		// delivered
+		int32_t NumDropped;
+		
+		MulticastDispatcher()
+			: NumSubscribers(0)
+			, DispatchDepth(0)
+			, NumQueued(0)
+			, IsDispatchingQueued(false)
+			, NumDropped(0)
+		{
+		}
+		
+		// Returns false if there's no room for another handler
+		bool Add(Handler handler, void* context = nullptr)
+		{
+			if (NumSubscribers == MaxHandlers)
+			{
+				return false;
+			}
+			Subscribers[NumSubscribers].Function = handler;
+			Subscribers[NumSubscribers].Context = context;
+			NumSubscribers++;
+			return true;
+		}
+		
+		void Remove(Handler handler, void* context = nullptr)
+		{
+			for (int32_t i = 0; i < NumSubscribers; ++i)
+			{
+				Subscriber& subscriber = Subscribers[i];
+				if (subscriber.Function == handler
+					&& subscriber.Context == context)
+				{
+					// Handlers are being iterated during a dispatch, so just
+					// clear this one and compact when the dispatch ends
+					if (DispatchDepth > 0)
+					{
+						subscriber.Function = nullptr;
+					}
+					else
+					{
+						for (int32_t j = i + 1; j < NumSubscribers; ++j)
+						{
+							Subscribers[j - 1] = Subscribers[j];
+						}
+						NumSubscribers--;
+					}
+					return;
+				}
+			}
+		}
+		
+		// Call all handlers now
+		void Dispatch(TPayload& payload)
+		{
+			DispatchScope scope(*this);
+			for (int32_t i = 0; i < NumSubscribers; ++i)
+			{
+				Subscriber& subscriber = Subscribers[i];
+				if (subscriber.Function)
+				{
+					subscriber.Function(subscriber.Context, payload);
+				}
+			}
+		}
+		
+		// Call all handlers during the next update. If the queue is full,
+		// the events already in it are delivered now to make room. Handlers
+		// of queued events can't do that, so their event is dropped.
+		void Enqueue(const TPayload& payload)
+		{
+			if (NumQueued == MaxQueued)
+			{
+				if (IsDispatchingQueued)
+				{
+					NumDropped++;
+					return;
+				}
+				DispatchQueued();
+			}
+			Queue[NumQueued] = payload;
+			NumQueued++;
+			if (!IsQueued)
+			{
+				QueueEventDispatch(this);
+			}
+		}
+		
+		// Deliver queued events in the order they were queued. Events
+		// queued by handlers during this are delivered next time.
+		void DispatchQueued() override
+		{
+			if (IsDispatchingQueued)
+			{
+				return;
+			}
+			QueuedDispatchScope scope(*this);
+			int32_t numToDispatch = NumQueued;
+			while (scope.NumDelivered < numToDispatch)
+			{
+				// Count the event before calling its handlers so it's
+				// removed and not delivered again if one of them throws
+				TPayload& payload = Queue[scope.NumDelivered];
+				scope.NumDelivered++;
+				Dispatch(payload);
+			}
+		}
+		
+	private:
+		
+		// Remove the delivered events and clear the flag when delivery
+		// ends, even if a handler threw an exception
+		struct QueuedDispatchScope
+		{
+			MulticastDispatcher& Dispatcher;
+			int32_t NumDelivered;
+			
+			QueuedDispatchScope(MulticastDispatcher& dispatcher)
+				: Dispatcher(dispatcher)
+				, NumDelivered(0)
+			{
+				Dispatcher.IsDispatchingQueued = true;
+			}
+			
+			~QueuedDispatchScope()
+			{
+				// Release anything the delivered payloads refer to and move
+				// the rest to the front
+				TPayload* queue = Dispatcher.Queue;
+				int32_t numQueued = Dispatcher.NumQueued;
+				for (int32_t i = 0; i < NumDelivered; ++i)
+				{
+					queue[i] = TPayload();
+				}
+				for (int32_t i = NumDelivered; i < numQueued; ++i)
+				{
+					queue[i - NumDelivered] = queue[i];
+					queue[i] = TPayload();
+				}
+				Dispatcher.NumQueued = numQueued - NumDelivered;
+				Dispatcher.IsDispatchingQueued = false;
+				
+				// Events a handler threw before reaching are delivered
+				// next update
+				if (Dispatcher.NumQueued > 0 && !Dispatcher.IsQueued)
+				{
+					QueueEventDispatch(&Dispatcher);
+				}
+			}
+		};
+		
+		// Compact handlers removed during a dispatch when the outermost
+		// dispatch ends, even if a handler threw an exception
+		struct DispatchScope
+		{
+			MulticastDispatcher& Dispatcher;
+			
+			DispatchScope(MulticastDispatcher& dispatcher)
+				: Dispatcher(dispatcher)
+			{
+				Dispatcher.DispatchDepth++;
+			}
+			
+			~DispatchScope()
+			{
+				if (--Dispatcher.DispatchDepth == 0)
+				{
+					int32_t numKept = 0;
+					for (int32_t i = 0; i < Dispatcher.NumSubscribers; ++i)
+					{
+						if (Dispatcher.Subscribers[i].Function)
+						{
+							Dispatcher.Subscribers[numKept] =
+								Dispatcher.Subscribers[i];
+							numKept++;
+						}
+					}
+					Dispatcher.NumSubscribers = numKept;
+				}
+			}
+		};
+	};
+}
+
+////////////////////////////////////////////////////////////////
+// Batched physics messages
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// Messages recorded by C# since the last drain
+	extern PhysicsMessageQueue* PhysicsMessages;
+	
+	// Deliver all recorded physics messages to the scripts that received
+	// them. This happens automatically once per frame.
+	void DrainPhysicsMessages();
+}
+
+////////////////////////////////////////////////////////////////
+// Catching C# exceptions without throwing C++ exceptions
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// While any of these are in scope, C# exceptions caused by this thread
+	// calling into C# are recorded instead of being thrown as C++
+	// exceptions. The call returns a default value. This makes calls that
+	// are expected to fail cheap since nothing is allocated unless
+	// GetException is called. Nested catchers share the recorded exception
+	// and it's discarded when the outermost one goes out of scope.
+	struct CatchCsharpExceptions
+	{
+		CatchCsharpExceptions();
+		~CatchCsharpExceptions();
+		CatchCsharpExceptions(const CatchCsharpExceptions& other) = delete;
+		CatchCsharpExceptions& operator=(const CatchCsharpExceptions& other) = delete;
+		
+		// Check if a C# exception has been recorded
+		bool HasException() const;
+		
+		// Get the recorded C# exception, or null if there isn't one, and
+		// stop recording it
+		System::Exception GetException();
+		
+		// Stop recording the C# exception, if any
+		void Clear();
+	};
+}
+
+////////////////////////////////////////////////////////////////
+// Plugin memory
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// Address space for all of the plugin memory is reserved when the
+	// plugin first boots and stays at the same address when it's reloaded.
+	// Pages are only committed as they're needed, so call this before using
+	// memory passed to PluginMain without allocating it from
+	// PersistentMemory. It's cheap to call on memory that's already
+	// committed. Returns false if the address is beyond the end of
+	// the plugin memory or the OS couldn't commit the memory.
+	bool CommitMemory(void* end);
+	
+	// Alignment of allocations when none is given
+	const size_t DefaultAlignment = 16;
+	
+	// Allocates by bumping a pointer through a range of plugin memory and
+	// frees everything at once. Memory is committed as it's allocated. The
+	// allocators below are kept in plugin memory, so their allocations
+	// survive reloads.
+	struct LinearAllocator
+	{
+		uint8_t* Begin;
+		uint8_t* Cur;
+		uint8_t* End;
+		uint8_t* CommitEnd;
+		
+		// Highest Cur has been when it was moved back. This is only for
+		// reporting usage.
+		uint8_t* Peak;
+		
+		// Start allocating from a range of plugin memory
+		void Init(void* begin, void* end);
+		
+		// Commit memory up to the given address. Returns false if it's
+		// past the end of the range or couldn't be committed.
+		bool Commit(uint8_t* end);
+		
+		// Allocate uninitialized memory or return null if there's not
+		// enough left
+		void* Allocate(size_t size, size_t alignment = DefaultAlignment)
+		{
+			uint8_t* begin = (uint8_t*)(
+				((uintptr_t)Cur + alignment - 1) & ~(uintptr_t)(alignment - 1));
+			uint8_t* end = begin + size;
+			if (end > CommitEnd && !Commit(end))
+			{
+				return nullptr;
+			}
+			Cur = end;
+			return begin;
+		}
+		
+		template <typename T> T* Allocate(int32_t count = 1)
+		{
+			return (T*)Allocate(sizeof(T) * count, alignof(T));
+		}
+		
+		// Free everything that's been allocated
+		void Reset()
+		{
+			UpdatePeak();
+			Cur = Begin;
+		}
+		
+		void UpdatePeak()
+		{
+			if (Cur > Peak)
+			{
+				Peak = Cur;
+			}
+		}
+	};
+	
+	// Frees everything allocated from an allocator while this is in scope
+	// when it goes out of scope
+	struct LinearAllocatorScope
+	{
+		LinearAllocator& Allocator;
+		uint8_t* Marker;
+		
+		LinearAllocatorScope(LinearAllocator& allocator)
+			: Allocator(allocator)
+			, Marker(allocator.Cur)
+		{
+		}
+		
+		~LinearAllocatorScope()
+		{
+			Allocator.UpdatePeak();
+			Allocator.Cur = Marker;
+		}
+		
+		LinearAllocatorScope(const LinearAllocatorScope& other) = delete;
+		LinearAllocatorScope& operator=(const LinearAllocatorScope& other) = delete;
+	};
+	
+	// Allocations that last until the plugin is closed. This allocates
+	// from the memory passed to PluginMain, so the first allocation after
+	// the first boot is always at the start of that memory.
+	extern LinearAllocator* PersistentMemory;
+	
+	// Scratch memory for the current frame. There are two of these. Once
+	// per frame, before any C++ updates, they swap and the new one is
+	// reset. Allocations are therefore still valid during the next frame.
+	extern LinearAllocator* FrameMemory;
+	
+	// A general-purpose allocator using the two-level segregated fit (TLSF)
+	// algorithm. Allocating and freeing take constant time and adjacent
+	// free blocks are merged. Memory comes from a LinearAllocator in pools
+	// as it's needed and all the allocator's state is kept in plugin
+	// memory, so allocations survive reloads.
+	struct HeapAllocator
+	{
+		// Allocations are aligned to this
+		static const size_t Alignment = 16;
+		
+		// Second-level lists per power of two, as a power of two
+		static const int32_t SecondLevelCountLog2 = 4;
+		static const int32_t SecondLevelCount = 1 << SecondLevelCountLog2;
+		
+		// Sizes below this all go in the first first-level list
+		static const int32_t FirstLevelShift = SecondLevelCountLog2 + 4;
+		static const size_t SmallBlockSize = (size_t)1 << FirstLevelShift;
+		
+		// Allocations up to 2^FirstLevelMax bytes are supported
+		static const int32_t FirstLevelMax = 31;
+		static const int32_t FirstLevelCount = FirstLevelMax - FirstLevelShift + 1;
+		
+		// Header of a used or free block of memory
+		struct Block;
+		
+		// Where pools of memory come from and the minimum size of a pool
+		LinearAllocator* Source;
+		size_t PoolSize;
+		
+		// Which lists have free blocks in them
+		uint32_t FirstLevelBitmap;
+		uint32_t SecondLevelBitmaps[FirstLevelCount];
+		
+		// Lists of free blocks by size
+		Block* FreeLists[FirstLevelCount][SecondLevelCount];
+		
+		// Bytes in the pools, in used blocks, and in used blocks at most.
+		// These are only for reporting usage.
+		size_t PoolsSize;
+		size_t UsedSize;
+		size_t PeakUsedSize;
+		
+		// Start allocating pools of at least the given size from a source
+		void Init(LinearAllocator* source, size_t poolSize);
+		
+		// Allocate uninitialized memory aligned to Alignment or return null
+		// if there's not enough memory
+		void* Allocate(size_t size);
+		
+		template <typename T> T* Allocate(int32_t count = 1)
+		{
+			static_assert(
+				alignof(T) <= Alignment,
+				"Type is aligned more than HeapAllocator supports");
+			return (T*)Allocate(sizeof(T) * count);
+		}
+		
+		// Free memory returned by Allocate. Null is ignored.
+		void Free(void* ptr);
+		
+		// Get the number of bytes usable in an allocation, which may be
+		// more than was requested
+		size_t GetSize(void* ptr);
+		
+		// Add memory for the allocator to allocate from
+		void AddPool(void* memory, size_t size);
+	};
+	
+	// General-purpose allocations that last until they're freed or the
+	// plugin is closed. Pools are allocated from PersistentMemory.
+	extern HeapAllocator* HeapMemory;
+	
+	// How much of a part of plugin memory is used. Used, Peak, and Capacity
+	// count handles for ref count arrays, entries for free lists, and bytes
+	// for the allocators.
+	struct MemoryUsage
+	{
+		const char* Name;
+		
+		// Where the part is relative to the start of plugin memory or -1 if
+		// it's spread through other parts, like the heap is
+		int32_t Offset;
+		
+		// Number of bytes the part takes up
+		int32_t Size;
+		
+		int32_t Used;
+		
+		// Highest Used has been since the first boot. For ref count arrays,
+		// this is only checked when usage is reported.
+		int32_t Peak;
+		
+		int32_t Capacity;
+	};
+	
+	// Get the usage of each part of plugin memory, writing up to maxUsages
+	// of them. Returns how many parts there are.
+	int32_t GetMemoryUsage(MemoryUsage* usages, int32_t maxUsages);
+}
+
+////////////////////////////////////////////////////////////////
+// Containers in plugin memory
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// A pointer stored as the distance from itself to what it points to.
+	// It stays valid when it's moved along with what it points to, such as
+	// when a snapshot of plugin memory is restored elsewhere. Copying it
+	// keeps it pointing at the same object.
+	template <typename T> struct OffsetPtr
+	{
+		// Zero for null
+		intptr_t Offset;
+		
+		OffsetPtr()
+			: Offset(0)
+		{
+		}
+		
+		OffsetPtr(T* ptr)
+		{
+			Set(ptr);
+		}
+		
+		OffsetPtr(const OffsetPtr& other)
+		{
+			Set(other.Get());
+		}
+		
+		OffsetPtr& operator=(const OffsetPtr& other)
+		{
+			Set(other.Get());
+			return *this;
+		}
+		
+		OffsetPtr& operator=(T* ptr)
+		{
+			Set(ptr);
+			return *this;
+		}
+		
+		void Set(T* ptr)
+		{
+			Offset = ptr ? (intptr_t)ptr - (intptr_t)this : 0;
+		}
+		
+		T* Get() const
+		{
+			return Offset ? (T*)((intptr_t)this + Offset) : nullptr;
+		}
+		
+		operator T*() const
+		{
+			return Get();
+		}
+		
+		T* operator->() const
+		{
+			return Get();
+		}
+	};
+	
+	// A growable array allocated from HeapMemory. It's empty when its
+	// memory is cleared, so it can be put directly in plugin memory. Call
+	// Free to destroy the elements and free the array.
+	template <typename T> struct Vector
+	{
+		OffsetPtr<T> Data;
+		int32_t Length;
+		int32_t Capacity;
+		
+		T& operator[](int32_t index)
+		{
+			return Data.Get()[index];
+		}
+		
+		T* begin()
+		{
+			return Data.Get();
+		}
+		
+		T* end()
+		{
+			return Data.Get() + Length;
+		}
+		
+		// Make room for at least the given number of elements. Returns
+		// false if there isn't enough memory.
+		bool Reserve(int32_t capacity)
+		{
+			if (capacity <= Capacity)
+			{
+				return true;
+			}
+			T* data = HeapMemory->Allocate<T>(capacity);
+			if (!data)
+			{
+				return false;
+			}
+			T* oldData = Data.Get();
+			for (int32_t i = 0; i < Length; ++i)
+			{
+				new (data + i) T(oldData[i]);
+				oldData[i].~T();
+			}
+			HeapMemory->Free(oldData);
+			Data = data;
+			Capacity = capacity;
+			return true;
+		}
+		
+		// Add an element to the end. Returns null if there isn't enough
+		// memory.
+		T* PushBack(const T& value)
+		{
+			if (Length == Capacity
+				&& !Reserve(Capacity ? Capacity * 2 : 8))
+			{
+				return nullptr;
+			}
+			T* element = new (Data.Get() + Length) T(value);
+			Length++;
+			return element;
+		}
+		
+		void PopBack()
+		{
+			Length--;
+			Data.Get()[Length].~T();
+		}
+		
+		// Remove an element by moving the last element into its place
+		void RemoveAtSwapBack(int32_t index)
+		{
+			T* data = Data.Get();
+			Length--;
+			if (index != Length)
+			{
+				data[index] = data[Length];
+			}
+			data[Length].~T();
+		}
+		
+		void Clear()
+		{
+			T* data = Data.Get();
+			for (int32_t i = 0; i < Length; ++i)
+			{
+				data[i].~T();
+			}
+			Length = 0;
+		}
+		
+		void Free()
+		{
+			Clear();
+			HeapMemory->Free(Data.Get());
+			Data = nullptr;
+			Capacity = 0;
+		}
+	};
+	
+	// Hash functions for HashMap keys. Integers are mixed and other keys
+	// have their bytes hashed, so they shouldn't contain padding.
+	template <typename T> struct Hash
+	{
+		uint32_t operator()(const T& key) const
+		{
+			// FNV-1a
+			const uint8_t* bytes = (const uint8_t*)&key;
+			uint32_t hash = 2166136261u;
+			for (size_t i = 0; i < sizeof(T); ++i)
+			{
+				hash = (hash ^ bytes[i]) * 16777619u;
+			}
+			return hash;
+		}
+	};
+	
+	inline uint32_t MixHash(uint64_t key)
+	{
+		key ^= key >> 33;
+		key *= 0xff51afd7ed558ccdull;
+		key ^= key >> 33;
+		key *= 0xc4ceb9fe1a85ec53ull;
+		key ^= key >> 33;
+		return (uint32_t)key;
+	}
+	
+	#define PLUGIN_INTEGER_HASH(Type) \
+		template <> struct Hash<Type> \
+		{ \
+			uint32_t operator()(Type key) const \
+			{ \
+				return MixHash((uint64_t)key); \
+			} \
+		};
+	PLUGIN_INTEGER_HASH(int32_t)
+	PLUGIN_INTEGER_HASH(uint32_t)
+	PLUGIN_INTEGER_HASH(int64_t)
+	PLUGIN_INTEGER_HASH(uint64_t)
+	#undef PLUGIN_INTEGER_HASH
+	
+	// A hash table using open addressing with linear probing, allocated
+	// from HeapMemory. Removal shifts later entries back instead of leaving
+	// tombstones. It's empty when its memory is cleared, so it can be put
+	// directly in plugin memory. Call Free to destroy the entries and free
+	// the table.
+	template <typename TKey, typename TValue, typename THash = Hash<TKey>>
+	struct HashMap
+	{
+		struct Entry
+		{
+			TKey Key;
+			TValue Value;
+		};
+		
+		// Entries and whether each is used. Capacity is a power of two.
+		OffsetPtr<Entry> Entries;
+		OffsetPtr<uint8_t> Used;
+		int32_t Count;
+		int32_t Capacity;
+		
+		// Get the value for a key or null if it's not in the map
+		TValue* Find(const TKey& key)
+		{
+			if (!Count)
+			{
+				return nullptr;
+			}
+			Entry* entries = Entries.Get();
+			uint8_t* used = Used.Get();
+			uint32_t mask = (uint32_t)Capacity - 1;
+			for (uint32_t i = THash()(key) & mask; used[i]; i = (i + 1) & mask)
+			{
+				if (entries[i].Key == key)
+				{
+					return &entries[i].Value;
+				}
+			}
+			return nullptr;
+		}
+		
+		// Get the value for a key, adding a value-initialized one if it's
+		// not in the map. Returns null if there isn't enough memory.
+		TValue* GetOrAdd(const TKey& key)
+		{
+			// Keep the load factor at most 3/4
+			if ((Count + 1) * 4 > Capacity * 3
+				&& !Rehash(Capacity ? Capacity * 2 : 16))
+			{
+				return nullptr;
+			}
+			Entry* entries = Entries.Get();
+			uint8_t* used = Used.Get();
+			uint32_t mask = (uint32_t)Capacity - 1;
+			uint32_t i = THash()(key) & mask;
+			for (; used[i]; i = (i + 1) & mask)
+			{
+				if (entries[i].Key == key)
+				{
+					return &entries[i].Value;
+				}
+			}
+			Entry* entry = new (entries + i) Entry{ key, TValue() };
+			used[i] = 1;
+			Count++;
+			return &entry->Value;
+		}
+		
+		// Remove a key and its value. Returns false if it wasn't in the map.
+		bool Remove(const TKey& key)
+		{
+			if (!Count)
+			{
+				return false;
+			}
+			Entry* entries = Entries.Get();
+			uint8_t* used = Used.Get();
+			uint32_t mask = (uint32_t)Capacity - 1;
+			uint32_t i = THash()(key) & mask;
+			for (; used[i]; i = (i + 1) & mask)
+			{
+				if (entries[i].Key == key)
+				{
+					break;
+				}
+			}
+			if (!used[i])
+			{
+				return false;
+			}
+			
+			// Move later entries in the probe sequence back into the hole
+			for (uint32_t j = (i + 1) & mask; used[j]; j = (j + 1) & mask)
+			{
+				uint32_t home = THash()(entries[j].Key) & mask;
+				if (((j - home) & mask) >= ((j - i) & mask))
+				{
+					entries[i] = entries[j];
+					i = j;
+				}
+			}
+			entries[i].~Entry();
+			used[i] = 0;
+			Count--;
+			return true;
+		}
+		
+		// Call a function with the key and value of every entry
+		template <typename TFunction> void ForEach(TFunction function)
+		{
+			Entry* entries = Entries.Get();
+			uint8_t* used = Used.Get();
+			for (int32_t i = 0; i < Capacity; ++i)
+			{
+				if (used[i])
+				{
+					function(entries[i].Key, entries[i].Value);
+				}
+			}
+		}
+		
+		// Resize to a power of two capacity that fits the entries. Returns
+		// false if there isn't enough memory.
+		bool Rehash(int32_t capacity)
+		{
+			Entry* entries = HeapMemory->Allocate<Entry>(capacity);
+			uint8_t* used = HeapMemory->Allocate<uint8_t>(capacity);
+			if (!entries || !used)
+			{
+				HeapMemory->Free(entries);
+				HeapMemory->Free(used);
+				return false;
+			}
+			memset(used, 0, capacity);
+			Entry* oldEntries = Entries.Get();
+			uint8_t* oldUsed = Used.Get();
+			uint32_t mask = (uint32_t)capacity - 1;
+			for (int32_t i = 0; i < Capacity; ++i)
+			{
+				if (oldUsed[i])
+				{
+					uint32_t j = THash()(oldEntries[i].Key) & mask;
+					while (used[j])
+					{
+						j = (j + 1) & mask;
+					}
+					new (entries + j) Entry(oldEntries[i]);
+					used[j] = 1;
+					oldEntries[i].~Entry();
+				}
+			}
+			HeapMemory->Free(oldEntries);
+			HeapMemory->Free(oldUsed);
+			Entries = entries;
+			Used = used;
+			Capacity = capacity;
+			return true;
+		}
+		
+		void Clear()
+		{
+			Entry* entries = Entries.Get();
+			uint8_t* used = Used.Get();
+			for (int32_t i = 0; i < Capacity; ++i)
+			{
+				if (used[i])
+				{
+					entries[i].~Entry();
+					used[i] = 0;
+				}
+			}
+			Count = 0;
+		}
+		
+		void Free()
+		{
+			Clear();
+			HeapMemory->Free(Entries.Get());
+			HeapMemory->Free(Used.Get());
+			Entries = nullptr;
+			Used = nullptr;
+			Capacity = 0;
+		}
+	};
+	
+	// Columns of a SoaTable start on cache line boundaries
+	const size_t SoaColumnAlignment = 64;
+	
+	inline size_t AlignSoaColumnSize(size_t size)
+	{
+		return (size + SoaColumnAlignment - 1) & ~(SoaColumnAlignment - 1);
+	}
+	
+	// Column types and offsets of a SoaTable
+	template <int32_t Index, typename... TColumns> struct SoaColumn;
+	
+	template <typename TFirst, typename... TRest>
+	struct SoaColumn<0, TFirst, TRest...>
+	{
+		typedef TFirst Type;
+		
+		static size_t GetOffset(int32_t)
+		{
+			return 0;
+		}
+	};
+	
+	template <int32_t Index, typename TFirst, typename... TRest>
+	struct SoaColumn<Index, TFirst, TRest...>
+	{
+		typedef typename SoaColumn<Index - 1, TRest...>::Type Type;
+		
+		static size_t GetOffset(int32_t capacity)
+		{
+			return AlignSoaColumnSize(sizeof(TFirst) * capacity)
+				+ SoaColumn<Index - 1, TRest...>::GetOffset(capacity);
+		}
+	};
+	
+	// Operations on every column of a SoaTable's rows
+	template <typename... TColumns> struct SoaColumns;
+	
+	template <> struct SoaColumns<>
+	{
+		static size_t GetSize(int32_t)
+		{
+			return 0;
+		}
+		
+		static void Move(uint8_t*, int32_t, uint8_t*, int32_t, int32_t)
+		{
+		}
+		
+		static void SetRow(uint8_t*, int32_t, int32_t)
+		{
+		}
+		
+		static void MoveRow(uint8_t*, int32_t, int32_t, int32_t)
+		{
+		}
+		
+		static void DestroyRows(uint8_t*, int32_t, int32_t, int32_t)
+		{
+		}
+	};
+	
+	template <typename TFirst, typename... TRest>
+	struct SoaColumns<TFirst, TRest...>
+	{
+		static size_t GetSize(int32_t capacity)
+		{
+			return AlignSoaColumnSize(sizeof(TFirst) * capacity)
+				+ SoaColumns<TRest...>::GetSize(capacity);
+		}
+		
+		static void Move(
+			uint8_t* dest,
+			int32_t destCapacity,
+			uint8_t* src,
+			int32_t srcCapacity,
+			int32_t length)
+		{
+			TFirst* destColumn = (TFirst*)dest;
+			TFirst* srcColumn = (TFirst*)src;
+			for (int32_t i = 0; i < length; ++i)
+			{
+				new (destColumn + i) TFirst(srcColumn[i]);
+				srcColumn[i].~TFirst();
+			}
+			SoaColumns<TRest...>::Move(
+				dest + AlignSoaColumnSize(sizeof(TFirst) * destCapacity),
+				destCapacity,
+				src + AlignSoaColumnSize(sizeof(TFirst) * srcCapacity),
+				srcCapacity,
+				length);
+		}
+		
+		static void SetRow(
+			uint8_t* columns,
+			int32_t capacity,
+			int32_t index,
+			const TFirst& first,
+			const TRest&... rest)
+		{
+			new ((TFirst*)columns + index) TFirst(first);
+			SoaColumns<TRest...>::SetRow(
+				columns + AlignSoaColumnSize(sizeof(TFirst) * capacity),
+				capacity,
+				index,
+				rest...);
+		}
+		
+		static void MoveRow(
+			uint8_t* columns,
+			int32_t capacity,
+			int32_t destIndex,
+			int32_t srcIndex)
+		{
+			TFirst* column = (TFirst*)columns;
+			column[destIndex] = column[srcIndex];
+			SoaColumns<TRest...>::MoveRow(
+				columns + AlignSoaColumnSize(sizeof(TFirst) * capacity),
+				capacity,
+				destIndex,
+				srcIndex);
+		}
+		
+		static void DestroyRows(
+			uint8_t* columns,
+			int32_t capacity,
+			int32_t begin,
+			int32_t end)
+		{
+			TFirst* column = (TFirst*)columns;
+			for (int32_t i = begin; i < end; ++i)
+			{
+				column[i].~TFirst();
+			}
+			SoaColumns<TRest...>::DestroyRows(
+				columns + AlignSoaColumnSize(sizeof(TFirst) * capacity),
+				capacity,
+				begin,
+				end);
+		}
+	};
+	
+	// A growable table stored as one array per column, allocated from
+	// HeapMemory. Columns are cache line aligned so loops over them can be
+	// vectorized. It's empty when its memory is cleared, so it can be put
+	// directly in plugin memory. Call Free to destroy the rows and free the
+	// table.
+	template <typename... TColumns> struct SoaTable
+	{
+		// The allocation holding the columns. It's padded so the columns
+		// can be aligned.
+		OffsetPtr<uint8_t> Memory;
+		int32_t Length;
+		int32_t Capacity;
+		
+		uint8_t* GetColumns()
+		{
+			uintptr_t memory = (uintptr_t)Memory.Get();
+			return (uint8_t*)((memory + SoaColumnAlignment - 1)
+				& ~(uintptr_t)(SoaColumnAlignment - 1));
+		}
+		
+		// Get the array of a column's values
+		template <int32_t Index>
+		typename SoaColumn<Index, TColumns...>::Type* GetColumn()
+		{
+			return (typename SoaColumn<Index, TColumns...>::Type*)(
+				GetColumns()
+				+ SoaColumn<Index, TColumns...>::GetOffset(Capacity));
+		}
+		
+		// Make room for at least the given number of rows. Returns false if
+		// there isn't enough memory.
+		bool Reserve(int32_t capacity)
+		{
+			if (capacity <= Capacity)
+			{
+				return true;
+			}
+			uint8_t* memory = (uint8_t*)HeapMemory->Allocate(
+				SoaColumns<TColumns...>::GetSize(capacity)
+				+ SoaColumnAlignment);
+			if (!memory)
+			{
+				return false;
+			}
+			uint8_t* oldColumns = GetColumns();
+			uint8_t* oldMemory = Memory.Get();
+			Memory = memory;
+			SoaColumns<TColumns...>::Move(
+				GetColumns(),
+				capacity,
+				oldColumns,
+				Capacity,
+				Length);
+			HeapMemory->Free(oldMemory);
+			Capacity = capacity;
+			return true;
+		}
+		
+		// Add a row to the end. Returns false if there isn't enough memory.
+		bool PushBack(const TColumns&... values)
+		{
+			if (Length == Capacity
+				&& !Reserve(Capacity ? Capacity * 2 : 16))
+			{
+				return false;
+			}
+			SoaColumns<TColumns...>::SetRow(
+				GetColumns(),
+				Capacity,
+				Length,
+				values...);
+			Length++;
+			return true;
+		}
+		
+		// Remove a row by moving the last row into its place
+		void RemoveAtSwapBack(int32_t index)
+		{
+			uint8_t* columns = GetColumns();
+			Length--;
+			if (index != Length)
+			{
+				SoaColumns<TColumns...>::MoveRow(
+					columns,
+					Capacity,
+					index,
+					Length);
+			}
+			SoaColumns<TColumns...>::DestroyRows(
+				columns,
+				Capacity,
+				Length,
+				Length + 1);
+		}
+		
+		void Clear()
+		{
+			SoaColumns<TColumns...>::DestroyRows(
+				GetColumns(),
+				Capacity,
+				0,
+				Length);
+			Length = 0;
+		}
+		
+		void Free()
+		{
+			Clear();
+			HeapMemory->Free(Memory.Get());
+			Memory = nullptr;
+			Capacity = 0;
+		}
+	};
+	
+	// Links for an element of an IntrusiveList. Derive from this once per
+	// list the element can be in, using a different tag type for each.
+	template <typename T, typename TTag = void> struct IntrusiveListNode
+	{
+		OffsetPtr<T> Next;
+		OffsetPtr<T> Prev;
+	};
+	
+	// A doubly-linked list whose links are in the elements, so adding and
+	// removing never allocates. It's empty when its memory is cleared, so
+	// it can be put directly in plugin memory.
+	template <typename T, typename TTag = void> struct IntrusiveList
+	{
+		typedef IntrusiveListNode<T, TTag> Node;
+		
+		OffsetPtr<T> Head;
+		OffsetPtr<T> Tail;
+		int32_t Count;
+		
+		static Node& GetNode(T* element)
+		{
+			return static_cast<Node&>(*element);
+		}
+		
+		T* GetNext(T* element)
+		{
+			return GetNode(element).Next.Get();
+		}
+		
+		T* GetPrev(T* element)
+		{
+			return GetNode(element).Prev.Get();
+		}
+		
+		void PushBack(T* element)
+		{
+			Node& node = GetNode(element);
+			T* tail = Tail.Get();
+			node.Next = nullptr;
+			node.Prev = tail;
+			if (tail)
+			{
+				GetNode(tail).Next = element;
+			}
+			else
+			{
+				Head = element;
+			}
+			Tail = element;
+			Count++;
+		}
+		
+		void PushFront(T* element)
+		{
+			Node& node = GetNode(element);
+			T* head = Head.Get();
+			node.Prev = nullptr;
+			node.Next = head;
+			if (head)
+			{
+				GetNode(head).Prev = element;
+			}
+			else
+			{
+				Tail = element;
+			}
+			Head = element;
+			Count++;
+		}
+		
+		void Remove(T* element)
+		{
+			Node& node = GetNode(element);
+			T* next = node.Next.Get();
+			T* prev = node.Prev.Get();
+			if (prev)
+			{
+				GetNode(prev).Next = next;
+			}
+			else
+			{
+				Head = next;
+			}
+			if (next)
+			{
+				GetNode(next).Prev = prev;
+			}
+			else
+			{
+				Tail = prev;
+			}
+			node.Next = nullptr;
+			node.Prev = nullptr;
+			Count--;
+		}
+		
+		struct Iterator
+		{
+			T* Element;
+			
+			T& operator*()
+			{
+				return *Element;
+			}
+			
+			Iterator& operator++()
+			{
+				Element = GetNode(Element).Next.Get();
+				return *this;
+			}
+			
+			bool operator!=(const Iterator& other)
+			{
+				return Element != other.Element;
+			}
+		};
+		
+		Iterator begin()
+		{
+			return Iterator{ Head.Get() };
+		}
+		
+		Iterator end()
+		{
+			return Iterator{ nullptr };
+		}
+	};
+	
+	// Generation of each managed object handle. It's incremented when the
+	// handle is released so a handle that's reused for another object can
+	// be told apart from the old one.
+	extern uint32_t* HandleGenerations;
+	
+	// The part of a HandleMap that doesn't depend on its value type, so
+	// entries can be removed when their handles are released
+	struct HandleMapBase : IntrusiveListNode<HandleMapBase>
+	{
+		// Entries, each starting with a handle (0 if unused) and its
+		// generation. Capacity is a power of two.
+		OffsetPtr<uint8_t> Entries;
+		int32_t EntrySize;
+		int32_t Count;
+		int32_t Capacity;
+		
+		HandleMapBase(int32_t entrySize);
+		HandleMapBase(const HandleMapBase& other) = delete;
+		HandleMapBase& operator=(const HandleMapBase& other) = delete;
+		~HandleMapBase();
+		
+		// Get the entry for a handle or null if it's not in the map
+		void* FindEntry(int32_t handle);
+		
+		// Get the entry for a handle, adding a cleared one if it's not in
+		// the map. Returns null if there isn't enough memory or the handle
+		// is null.
+		void* AddEntry(int32_t handle, bool& added);
+		
+		// Remove the entry for a handle. Returns false if it wasn't in the
+		// map.
+		bool RemoveEntry(int32_t handle);
+		
+		// Resize to a power of two capacity that fits the entries. Returns
+		// false if there isn't enough memory.
+		bool Rehash(int32_t capacity);
+		
+		void FreeEntries();
+	};
+	
+	// Every HandleMap, so released handles can be removed from them
+	extern IntrusiveList<HandleMapBase>* HandleMaps;
+	
+	// Remove a released handle from every HandleMap and start its next
+	// generation
+	void ReleaseHandle(int32_t handle);
+	
+	// Native data for managed objects, like AI state for a GameObject, in a
+	// hash table using open addressing keyed by the objects' handles and
+	// allocated from HeapMemory. An object's entry is removed when its
+	// handle is released, and a handle that's been reused for another
+	// object never finds the old object's entry. Construct maps in plugin
+	// memory, such as PersistentMemory, so they survive hot reloads along
+	// with the list of maps. Values are moved as bytes.
+	template <typename TValue> struct HandleMap : HandleMapBase
+	{
+		static_assert(
+			std::is_trivially_copyable<TValue>::value,
+			"HandleMap values must be trivially copyable");
+		
+		struct Entry
+		{
+			int32_t Handle;
+			uint32_t Generation;
+			TValue Value;
+		};
+		
+		HandleMap()
+			: HandleMapBase(sizeof(Entry))
+		{
+		}
+		
+		// Get the value for an object or null if it's not in the map
+		TValue* Find(const ManagedType& object)
+		{
+			Entry* entry = (Entry*)FindEntry(object.Handle);
+			return entry ? &entry->Value : nullptr;
+		}
+		
+		// Get the value for an object, adding a value-initialized one if
+		// it's not in the map. Returns null if there isn't enough memory or
+		// the object is null.
+		TValue* GetOrAdd(const ManagedType& object)
+		{
+			bool added;
+			Entry* entry = (Entry*)AddEntry(object.Handle, added);
+			if (!entry)
+			{
+				return nullptr;
+			}
+			if (added)
+			{
+				new (&entry->Value) TValue();
+			}
+			return &entry->Value;
+		}
+		
+		// Remove an object's value. Returns false if it wasn't in the map.
+		bool Remove(const ManagedType& object)
+		{
+			return RemoveEntry(object.Handle);
+		}
+		
+		// Call a function with the handle and value of every entry
+		template <typename TFunction> void ForEach(TFunction function)
+		{
+			Entry* entries = (Entry*)Entries.Get();
+			for (int32_t i = 0; i < Capacity; ++i)
+			{
+				int32_t handle = entries[i].Handle;
+				if (handle
+					&& entries[i].Generation == HandleGenerations[handle])
+				{
+					function(handle, entries[i].Value);
+				}
+			}
+		}
+		
+		void Free()
+		{
+			FreeEntries();
+		}
+	};
+}
+
+////////////////////////////////////////////////////////////////
+// Pooled GameObjects
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// Commands queued since C# last made them
+	extern GameObjectPoolCommandQueue* GameObjectPoolCommands;
+	
+	// Add a command for C# to make at the end of the frame. If the queue
+	// is full, C# is called to make the queued commands first and any
+	// exception it throws is left for the caller to throw. Returns false
+	// and counts the command as dropped if the queue is still full because
+	// C# was already making the commands.
+	bool QueueGameObjectPoolCommand(const GameObjectPoolCommand& command);
+	
+	// Inactive copies of a GameObject that are spawned and despawned
+	// instead of being created and destroyed. Activating, deactivating,
+	// and moving them is queued and done by C# in one batch at the end of
+	// the frame. Scripts on the copies keep the same C++ instances the
+	// whole time. It's empty when its memory is cleared, so it can be put
+	// directly in plugin memory. Call Free to destroy the copies.
+	struct GameObjectPool
+	{
+		struct Entry
+		{
+			// Handle to the copy, which the pool holds a reference to
+			int32_t Handle;
+			
+			// Instance ID of the copy, e.g. for FindByGameObject
+			int32_t InstanceId;
+			
+			bool IsSpawned;
+		};
+		
+		Vector<Entry> Entries;
+		Vector<int32_t> FreeIndices;
+		
+		// Add count inactive copies of a GameObject with one call to C#.
+		// Returns false if they couldn't all be added.
+		bool Prewarm(const ManagedType& original, int32_t count);
+		
+		// Activate a copy and move it to a position at the end of the frame.
+		// Returns its index or -1 if all copies are spawned or the command
+		// was dropped.
+		int32_t Spawn(float x, float y, float z);
+		
+		// Activate a copy where it was at the end of the frame. Returns its
+		// index or -1 if all copies are spawned or the command was dropped.
+		int32_t Spawn();
+		
+		// Deactivate a spawned copy at the end of the frame. Returns false if
+		// the command was dropped, in which case the copy is still spawned.
+		bool Despawn(int32_t index);
+		
+		int32_t GetHandle(int32_t index)
+		{
+			return Entries[index].Handle;
+		}
+		
+		int32_t GetInstanceId(int32_t index)
+		{
+			return Entries[index].InstanceId;
+		}
+		
+		int32_t GetNumFree()
+		{
+			return FreeIndices.Length;
+		}
+		
+		// Destroy all the copies, spawned or not, immediately or, if C# is
+		// making the queued commands, when it gets to them. Returns false if
+		// some commands were dropped. Those copies stay in the pool with the
+		// same indices so Free can be called again.
+		bool Free();
+		
+	private:
+		
+		int32_t SpawnEntry(bool hasPosition, float x, float y, float z);
+	};
+}
+
+////////////////////////////////////////////////////////////////
+// Spawning GameObjects in batches
+////////////////////////////////////////////////////////////////
+
+namespace Plugin
+{
+	// Create a GameObject for each descriptor with one call to C#. Names
+	// are handles to System.String objects, e.g. from String::Handle. If
+	// handles isn't null, a referenced handle to each GameObject is
+	// written to it. Release them with ReleaseSpawnedGameObjects after
+	// keeping any that are needed, e.g. by constructing a
+	// UnityEngine::GameObject with them. Returns the number created, which
+	// is less than count only if C# threw an exception.
+	int32_t SpawnGameObjects(
+		const SpawnDescriptor* descriptors,
+		int32_t count,
+		const int32_t* names,
+		const SpawnComponent* components,
+		int32_t* handles);
+	
+	// Release and clear the handles written by SpawnGameObjects
+	void ReleaseSpawnedGameObjects(int32_t* handles, int32_t count);
+}
+
 ////////////////////////////////////////////////////////////////
 // User-defined literals for creating decimals (System.Decimal)
 ////////////////////////////////////////////////////////////////
@@ -40,6 +40,12 @@ namespace NativeScript
 			// The maximum number of objects to store. Must be positive.
 			static int maxObjects;
 			
+			// Copies of objects, handles, and nextHandleIndex for each
+			// snapshot slot. They're allocated when first saved.
+			static object[][] snapshotObjects;
+			static int[][] snapshotHandles;
+			static int[] snapshotNextHandleIndexes;
+			
 			public static void Init(int maxObjects)
 			{
 				ObjectStore.maxObjects = maxObjects;
@@ -61,6 +67,15 @@ namespace NativeScript
 				nextHandleIndex = maxObjects - 1;
 			}
 			
+			// Number of bits C++ needs to check every handle
+			public static int NumDestroyedObjectBits
+			{
+				get
+				{
+					return maxObjects + 1;
+				}
+			}
+			
 			public static int Store(object obj)
 			{
 				// Null is always zero
@@ -78,6 +93,7 @@ namespace NativeScript
 					// Store the object
 					objects[handle] = obj;
 					objectHandleCache.Add(obj, handle);
+					SetDestroyed(handle, false);
 					
 					return handle;
 				}
@@ -131,10 +147,122 @@ namespace NativeScript
 
 					// Remove the object from the cache
 					objectHandleCache.Remove(obj);
+					SetDestroyed(handle, true);
 					
 					return obj;
 				}
 			}
+			
+			// Save the store's state along with a snapshot of plugin memory
+			public static void SaveSnapshot(int slot)
+			{
+				lock (objects)
+				{
+					if (snapshotObjects == null)
+					{
+						snapshotObjects = new object[NumSnapshotSlots][];
+						snapshotHandles = new int[NumSnapshotSlots][];
+						snapshotNextHandleIndexes = new int[NumSnapshotSlots];
+					}
+					if (snapshotObjects[slot] == null)
+					{
+						snapshotObjects[slot] = new object[objects.Length];
+						snapshotHandles[slot] = new int[handles.Length];
+					}
+					Array.Copy(objects, snapshotObjects[slot], objects.Length);
+					Array.Copy(handles, snapshotHandles[slot], handles.Length);
+					snapshotNextHandleIndexes[slot] = nextHandleIndex;
+				}
+			}
+			
+			// Objects stored when a snapshot was saved, indexed by handle
+			public static object[] GetSnapshotObjects(int slot)
+			{
+				return snapshotObjects[slot];
+			}
+			
+			// Restore the store's state after plugin memory is restored.
+			// Objects keep their handles, but Unity objects destroyed since
+			// the snapshot stay destroyed. Objects stored since the snapshot
+			// that aren't in the restored store are added to removedObjects.
+			public static void RestoreSnapshot(
+				int slot,
+				List<object> removedObjects)
+			{
+				lock (objects)
+				{
+					int firstRemoved = removedObjects.Count;
+					object[] restoredObjects = snapshotObjects[slot];
+					for (int handle = 1; handle < objects.Length; ++handle)
+					{
+						object obj = objects[handle];
+						if (obj != null && restoredObjects[handle] != obj)
+						{
+							removedObjects.Add(obj);
+						}
+					}
+					Array.Copy(restoredObjects, objects, objects.Length);
+					Array.Copy(snapshotHandles[slot], handles, handles.Length);
+					nextHandleIndex = snapshotNextHandleIndexes[slot];
+					objectHandleCache.Clear();
+					for (int handle = 1; handle < objects.Length; ++handle)
+					{
+						object obj = objects[handle];
+						if (obj != null)
+						{
+							objectHandleCache.Add(obj, handle);
+						}
+						UnityEngine.Object unityObj = obj as UnityEngine.Object;
+						SetDestroyed(
+							handle,
+							obj == null
+								|| (!object.ReferenceEquals(unityObj, null)
+									&& unityObj == null));
+					}
+					
+					// Keep objects stored again at another handle since the
+					// snapshot
+					for (int i = removedObjects.Count - 1; i >= firstRemoved; --i)
+					{
+						if (objectHandleCache.ContainsKey(removedObjects[i]))
+						{
+							int last = removedObjects.Count - 1;
+							removedObjects[i] = removedObjects[last];
+							removedObjects.RemoveAt(last);
+						}
+					}
+				}
+			}
+			
+			// Tell C++ the object was destroyed without releasing its handle
+			public static void MarkDestroyed(object obj)
+			{
+				lock (objects)
+				{
+					int handle;
+					if (objectHandleCache.TryGetValue(obj, out handle))
+					{
+						SetDestroyed(handle, true);
+					}
+				}
+			}
+			
+			static unsafe void SetDestroyed(int handle, bool destroyed)
+			{
+				uint* bits = (uint*)destroyedObjects;
+				if (bits != null)
+				{
+					uint mask = 1u << (handle & 31);
+					if (destroyed)
+					{
+						bits[handle >> 5] |= mask;
+					}
+					else
+					{
+						bits[handle >> 5] &= ~mask;
+					}
+				}
+			}
 		}
 		
 		// Holds structs and provides handles to them in the form of ints
@@ -150,6 +278,12 @@ namespace NativeScript
 			// Index of the next available handle
 			static int nextHandleIndex;
 			
+			// Copies of structs, handles, and nextHandleIndex for each
+			// snapshot slot. They're allocated when first saved.
+			static T[][] snapshotStructs;
+			static int[][] snapshotHandles;
+			static int[] snapshotNextHandleIndexes;
+			
 			public static void Init(int maxStructs)
 			{
 				// Initialize the objects as all default plus room for the
@@ -208,6 +342,39 @@ namespace NativeScript
 					}
 				}
 			}
+			
+			// Save the store's state along with a snapshot of plugin memory
+			public static void SaveSnapshot(int slot)
+			{
+				lock (structs)
+				{
+					if (snapshotStructs == null)
+					{
+						snapshotStructs = new T[NumSnapshotSlots][];
+						snapshotHandles = new int[NumSnapshotSlots][];
+						snapshotNextHandleIndexes = new int[NumSnapshotSlots];
+					}
+					if (snapshotStructs[slot] == null)
+					{
+						snapshotStructs[slot] = new T[structs.Length];
+						snapshotHandles[slot] = new int[handles.Length];
+					}
+					Array.Copy(structs, snapshotStructs[slot], structs.Length);
+					Array.Copy(handles, snapshotHandles[slot], handles.Length);
+					snapshotNextHandleIndexes[slot] = nextHandleIndex;
+				}
+			}
+			
+			// Restore the store's state after plugin memory is restored
+			public static void RestoreSnapshot(int slot)
+			{
+				lock (structs)
+				{
+					Array.Copy(snapshotStructs[slot], structs, structs.Length);
+					Array.Copy(snapshotHandles[slot], handles, handles.Length);
+					nextHandleIndex = snapshotNextHandleIndexes[slot];
+				}
+			}
 		}
 		
 		/// <summary>
@@ -259,6 +426,166 @@ namespace NativeScript
 			}
 		}
 		
+		// Kinds of physics messages batched for C++. Matches the C++
+		// Plugin::PhysicsMessageType.
+		public enum PhysicsMessageType
+		{
+			CollisionEnter,
+			CollisionStay,
+			CollisionExit,
+			TriggerEnter,
+			TriggerStay,
+			TriggerExit
+		}
+		
+		// A physics message recorded for C++. Matches the C++
+		// Plugin::PhysicsMessage.
+		[StructLayout(LayoutKind.Sequential)]
+		struct PhysicsMessage
+		{
+			public PhysicsMessageType Type;
+			public int Receiver;
+			public int CppHandle;
+			public int OtherHandle;
+			public int ContactCount;
+			public Vector3 Point;
+			public Vector3 Normal;
+			public Vector3 Impulse;
+			public Vector3 RelativeVelocity;
+		}
+		
+		/// <summary>
+		/// How much of a part of the C++ plugin's memory is used. Matches
+		/// the C++ Plugin::MemoryUsage. Used, Peak, and Capacity count
+		/// handles for ref count arrays, entries for free lists, and bytes
+		/// for the allocators.
+		/// </summary>
+		[StructLayout(LayoutKind.Sequential)]
+		public struct MemoryUsage
+		{
+			// Only valid until the plugin is reloaded
+			public IntPtr NamePtr;
+			
+			// Where the part is relative to the start of plugin memory or -1
+			// if it's spread through other parts, like the heap is
+			public int Offset;
+			
+			// Number of bytes the part takes up
+			public int Size;
+			
+			public int Used;
+			
+			// Highest Used has been since the first boot. It isn't reset when
+			// the plugin is reloaded.
+			public int Peak;
+			
+			public int Capacity;
+			
+			public string Name
+			{
+				get
+				{
+					return Marshal.PtrToStringAnsi(NamePtr);
+				}
+			}
+		}
+		
+		// Peak usage of plugin memory pools. Read by the code generator to
+		// size them.
+		[Serializable]
+		public class MemoryProfile
+		{
+			public MemoryProfilePool[] Pools;
+		}
+		
+		[Serializable]
+		public class MemoryProfilePool
+		{
+			public string Name;
+			public int Peak;
+		}
+		
+		// Header of the ring buffer of physics messages. Matches the C++
+		// Plugin::PhysicsMessageQueue. The messages follow it in memory.
+		[StructLayout(LayoutKind.Sequential)]
+		struct PhysicsMessageQueue
+		{
+			public int Capacity;
+			public int ReadIndex;
+			public int Count;
+			public int NumDropped;
+		}
+		
+		// Maximum number of physics messages recorded between updates.
+		// Messages beyond this are dropped.
+		const int MaxPhysicsMessages = 1024;
+		
+		// Kinds of changes to pooled GameObjects. Matches the C++
+		// Plugin::GameObjectPoolCommandType.
+		enum GameObjectPoolCommandType
+		{
+			Activate,
+			Deactivate,
+			Destroy
+		}
+		
+		// A change to a pooled GameObject queued by C++. Matches the C++
+		// Plugin::GameObjectPoolCommand.
+		[StructLayout(LayoutKind.Sequential)]
+		struct GameObjectPoolCommand
+		{
+			public GameObjectPoolCommandType Type;
+			public int Handle;
+			public int HasPosition;
+			public int ReleaseHandle;
+			public Vector3 Position;
+		}
+		
+		// Plugin::GameObjectPoolCommandQueue. The commands follow it in
+		// memory.
+		[StructLayout(LayoutKind.Sequential)]
+		struct GameObjectPoolCommandQueue
+		{
+			public int Capacity;
+			public int Count;
+			public int NumDropped;
+		}
+		
+		// Maximum number of pooled GameObject commands queued between
+		// updates. C++ has them made early when the queue is full.
+		const int MaxGameObjectPoolCommands = 1024;
+		
+		// Number of snapshots kept by SaveSnapshot. Saving more overwrites
+		// the oldest.
+		public const int NumSnapshotSlots = 8;
+		
+		// C++ scripts that batched spawning can add. Matches the C++
+		// Plugin::SpawnComponent.
+		enum SpawnComponent
+		{
+			/*BEGIN SPAWN COMPONENT ENUMERATORS*/
+			BaseBallScript,
+			/*END SPAWN COMPONENT ENUMERATORS*/
+		}
+		
+		// A GameObject for batched spawning to create. Matches the C++
+		// Plugin::SpawnDescriptor.
+		[StructLayout(LayoutKind.Sequential)]
+		struct SpawnDescriptor
+		{
+			public int PrefabHandle;
+			public int PrimitiveType;
+			public int NameIndex;
+			public int FirstComponent;
+			public int NumComponents;
+			public Vector3 Position;
+		}
+		
+		// Number of bytes of plugin memory committed before Init. This
+		// needs to hold the parameters passed to Init. Init commits the
+		// rest as it's needed.
+		const int InitialCommittedMemorySize = 1024 * 1024;
+		
 		// Name of the plugin when using [DllImport]
 #if !UNITY_EDITOR && UNITY_IOS
 		const string PLUGIN_NAME = "__Internal";
@@ -293,11 +620,51 @@ namespace NativeScript
 			InitMode initMode);
 		
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-		public delegate void SetCsharpExceptionDelegate(int handle);
+		delegate IntPtr ReservePluginMemoryDelegate(
+			int memorySize,
+			int commitSize,
+			int useLargePages);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate void ReleasePluginMemoryDelegate(
+			IntPtr memory,
+			int memorySize);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		public delegate void SetCsharpExceptionDelegate();
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		public delegate void UpdatePluginDelegate();
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		public delegate int GetPluginMemoryUsageDelegate(
+			[Out] MemoryUsage[] usages,
+			int maxUsages);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate IntPtr ReservePluginSnapshotsDelegate(
+			int memorySize,
+			int numSlots);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate void ReleasePluginSnapshotsDelegate(
+			IntPtr snapshots,
+			int memorySize,
+			int numSlots);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int SavePluginSnapshotDelegate(
+			IntPtr snapshots,
+			int slot);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int RestorePluginSnapshotDelegate(
+			IntPtr snapshots,
+			int slot);
 		
 		/*BEGIN CPP DELEGATES*/
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-		public delegate int NewBaseBallScriptDelegateType(int param0);
+		public delegate int NewBaseBallScriptDelegateType(int param0, out System.IntPtr param1);
 		public static NewBaseBallScriptDelegateType NewBaseBallScript;
 		
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
@@ -305,11 +672,15 @@ namespace NativeScript
 		public static DestroyBaseBallScriptDelegateType DestroyBaseBallScript;
 		
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-		public delegate void MyGameAbstractBaseBallScriptUpdateDelegateType(int thisHandle);
+		public delegate void MyGameAbstractBaseBallScriptUpdateDelegateType(System.IntPtr param0);
 		public static MyGameAbstractBaseBallScriptUpdateDelegateType MyGameAbstractBaseBallScriptUpdate;
 		
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-		public delegate void SetCsharpExceptionSystemNullReferenceExceptionDelegateType(int param0);
+		public delegate void RegisterBaseBallScriptDelegateType(System.IntPtr param0, int param1);
+		public static RegisterBaseBallScriptDelegateType RegisterBaseBallScript;
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		public delegate void SetCsharpExceptionSystemNullReferenceExceptionDelegateType();
 		public static SetCsharpExceptionSystemNullReferenceExceptionDelegateType SetCsharpExceptionSystemNullReferenceException;
 		/*END CPP DELEGATES*/
 #endif
@@ -409,20 +780,63 @@ namespace NativeScript
 			InitMode initMode);
 		
 		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
-		static extern void SetCsharpException(int handle);
+		static extern IntPtr ReservePluginMemory(
+			int memorySize,
+			int commitSize,
+			int useLargePages);
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern void ReleasePluginMemory(
+			IntPtr memory,
+			int memorySize);
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern void SetCsharpException();
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern void UpdatePlugin();
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern int GetPluginMemoryUsage(
+			[Out] MemoryUsage[] usages,
+			int maxUsages);
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern IntPtr ReservePluginSnapshots(
+			int memorySize,
+			int numSlots);
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern void ReleasePluginSnapshots(
+			IntPtr snapshots,
+			int memorySize,
+			int numSlots);
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern int SavePluginSnapshot(
+			IntPtr snapshots,
+			int slot);
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		static extern int RestorePluginSnapshot(
+			IntPtr snapshots,
+			int slot);
 		
 		/*BEGIN IMPORTS*/
 		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
-		public static extern int NewBaseBallScript(int thisHandle);
+		public static extern int NewBaseBallScript(int thisHandle, out System.IntPtr cppPointer);
 		
 		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
 		public static extern void DestroyBaseBallScript(int thisHandle);
 		
 		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
-		public static extern void MyGameAbstractBaseBallScriptUpdate(int thisHandle);
+		public static extern void MyGameAbstractBaseBallScriptUpdate(System.IntPtr param0);
 		
 		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
-		public static extern void SetCsharpExceptionSystemNullReferenceException(int thisHandle);
+		public static extern void RegisterBaseBallScript(System.IntPtr thisPointer, int gameObjectInstanceId);
+		
+		[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]
+		public static extern void SetCsharpExceptionSystemNullReferenceException();
 		/*END IMPORTS*/
 #endif
 		
@@ -441,6 +855,21 @@ namespace NativeScript
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 		delegate int EnumerableGetEnumeratorDelegateType(int handle);
 		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int EnumeratorMoveNextBatchDelegateType(int handle, IntPtr handles, int maxCount);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int StoreCsharpExceptionDelegateType();
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int GameObjectPoolPrewarmDelegateType(int originalHandle, int count, IntPtr handles, IntPtr instanceIds);
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate void ApplyGameObjectPoolCommandsDelegateType();
+		
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int SpawnGameObjectBatchDelegateType(IntPtr descriptors, int count, IntPtr names, IntPtr components, IntPtr handles);
+		
 		/*BEGIN DELEGATE TYPES*/
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 		delegate void ReleaseSystemDecimalDelegateType(int handle);
@@ -489,9 +918,23 @@ namespace NativeScript
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 		delegate UnityEngine.PrimitiveType UnboxPrimitiveTypeDelegateType(int valHandle);
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate void ReleaseUnityEngineRaycastHitDelegateType(int handle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		unsafe delegate void UnityEngineRaycastHitGetValueDelegateType(int thisHandle, void* value);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int BoxRaycastHitDelegateType(int valHandle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int UnboxRaycastHitDelegateType(int valHandle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate void SystemIDisposableMethodDisposeDelegateType(int thisHandle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumeratorDelegateType(int thisHandle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrentDelegateType(int thisHandle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 		delegate float UnityEngineTimePropertyGetDeltaTimeDelegateType();
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-		delegate void BaseBallScriptConstructorDelegateType(int cppHandle, ref int handle);
+		delegate void BaseBallScriptConstructorDelegateType(int cppHandle, System.IntPtr cppPointer, ref int handle);
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 		delegate void ReleaseBaseBallScriptDelegateType(int handle);
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
@@ -542,29 +985,79 @@ namespace NativeScript
 		delegate int BoxDoubleDelegateType(double val);
 		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
 		delegate double UnboxDoubleDelegateType(int valHandle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int UnityEngineUnityEngineRaycastHitArray1Constructor1DelegateType(int length0);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate int UnityEngineRaycastHitArray1GetItem1DelegateType(int thisHandle, int index0);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate void UnityEngineRaycastHitArray1SetItem1DelegateType(int thisHandle, int index0, int itemHandle);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		unsafe delegate void UnityEngineRaycastHitArray1GetValuesDelegateType(int thisHandle, int startIndex, int count, void* values);
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		delegate void UnityEngineRaycastHitArray1GetItemsDelegateType(int thisHandle, int startIndex, int count, System.IntPtr items);
 		/*END DELEGATE TYPES*/
 
 #if UNITY_EDITOR_WIN
 		private static readonly string pluginTempPath = Application.dataPath + PLUGIN_TEMP_PATH;
 #endif
 		public static Exception UnhandledCppException;
+		
+		// An exception caught while C++ was calling into C#. It's only put
+		// in the ObjectStore if C++ throws it.
+		[ThreadStatic]
+		public static Exception UnhandledCsharpException;
 #if UNITY_EDITOR
 		private static readonly string pluginPath = Application.dataPath + PLUGIN_PATH;
+		static ReleasePluginMemoryDelegate ReleasePluginMemory;
 		public static SetCsharpExceptionDelegate SetCsharpException;
+		public static UpdatePluginDelegate UpdatePlugin;
+		public static GetPluginMemoryUsageDelegate GetPluginMemoryUsage;
+		static ReservePluginSnapshotsDelegate ReservePluginSnapshots;
+		static ReleasePluginSnapshotsDelegate ReleasePluginSnapshots;
+		static SavePluginSnapshotDelegate SavePluginSnapshot;
+		static RestorePluginSnapshotDelegate RestorePluginSnapshot;
 #endif
 		static IntPtr memory;
 		static int memorySize;
+		static int frameMemorySize;
+		static bool useLargePages;
+		static IntPtr physicsMessages;
+		static IntPtr destroyedObjects;
+		static IntPtr gameObjectPoolCommands;
+		static bool applyingGameObjectPoolCommands;
+		static IntPtr snapshots;
+		static int numSnapshots;
+		static List<object> snapshotRemovedObjects = new List<object>();
+		
+		// CppHandle and CppPointer of the base type objects stored when each
+		// snapshot was saved, indexed by slot and handle. They're allocated
+		// when first saved.
+		static int[][] snapshotCppHandles;
+		static IntPtr[][] snapshotCppPointers;
 		static DestroyEntry[] destroyQueue;
 		static int destroyQueueCount;
 		static int destroyQueueCapacity;
 		static object destroyQueueLockObj;
 		
+		// Memory usage sampled by RecordMemoryProfile and the peak of each
+		// part by name. Names are only looked up when the plugin's name
+		// pointers change so sampling doesn't allocate.
+		static MemoryUsage[] profileUsages;
+		static IntPtr[] profileNamePtrs;
+		static string[] profileNames;
+		static Dictionary<string, int> profilePeaks;
+		
 		// Fixed delegates
 		static readonly ReleaseObjectDelegateType ReleaseObjectDelegate = new ReleaseObjectDelegateType(ReleaseObject);
 		static readonly StringNewDelegateType StringNewDelegate = new StringNewDelegateType(StringNew);
 		static readonly SetExceptionDelegateType SetExceptionDelegate = new SetExceptionDelegateType(SetException);
 		static readonly ArrayGetLengthDelegateType ArrayGetLengthDelegate = new ArrayGetLengthDelegateType(ArrayGetLength);
 		static readonly EnumerableGetEnumeratorDelegateType EnumerableGetEnumeratorDelegate = new EnumerableGetEnumeratorDelegateType(EnumerableGetEnumerator);
+		static readonly EnumeratorMoveNextBatchDelegateType EnumeratorMoveNextBatchDelegate = new EnumeratorMoveNextBatchDelegateType(EnumeratorMoveNextBatch);
+		static readonly StoreCsharpExceptionDelegateType StoreCsharpExceptionDelegate = new StoreCsharpExceptionDelegateType(StoreCsharpException);
+		static readonly GameObjectPoolPrewarmDelegateType GameObjectPoolPrewarmDelegate = new GameObjectPoolPrewarmDelegateType(GameObjectPoolPrewarm);
+		static readonly ApplyGameObjectPoolCommandsDelegateType ApplyGameObjectPoolCommandsDelegate = new ApplyGameObjectPoolCommandsDelegateType(ApplyGameObjectPoolCommands);
+		static readonly SpawnGameObjectBatchDelegateType SpawnGameObjectBatchDelegate = new SpawnGameObjectBatchDelegateType(SpawnGameObjectBatch);
 		
 		// Generated delegates
 		/*BEGIN CSHARP DELEGATES*/
@@ -591,6 +1084,13 @@ namespace NativeScript
 		static readonly SystemExceptionConstructorSystemStringDelegateType SystemExceptionConstructorSystemStringDelegate = new SystemExceptionConstructorSystemStringDelegateType(SystemExceptionConstructorSystemString);
 		static readonly BoxPrimitiveTypeDelegateType BoxPrimitiveTypeDelegate = new BoxPrimitiveTypeDelegateType(BoxPrimitiveType);
 		static readonly UnboxPrimitiveTypeDelegateType UnboxPrimitiveTypeDelegate = new UnboxPrimitiveTypeDelegateType(UnboxPrimitiveType);
+		static readonly ReleaseUnityEngineRaycastHitDelegateType ReleaseUnityEngineRaycastHitDelegate = new ReleaseUnityEngineRaycastHitDelegateType(ReleaseUnityEngineRaycastHit);
+		static unsafe readonly UnityEngineRaycastHitGetValueDelegateType UnityEngineRaycastHitGetValueDelegate = new UnityEngineRaycastHitGetValueDelegateType(UnityEngineRaycastHitGetValue);
+		static readonly BoxRaycastHitDelegateType BoxRaycastHitDelegate = new BoxRaycastHitDelegateType(BoxRaycastHit);
+		static readonly UnboxRaycastHitDelegateType UnboxRaycastHitDelegate = new UnboxRaycastHitDelegateType(UnboxRaycastHit);
+		static readonly SystemIDisposableMethodDisposeDelegateType SystemIDisposableMethodDisposeDelegate = new SystemIDisposableMethodDisposeDelegateType(SystemIDisposableMethodDispose);
+		static readonly SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumeratorDelegateType SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumeratorDelegate = new SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumeratorDelegateType(SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumerator);
+		static readonly SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrentDelegateType SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrentDelegate = new SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrentDelegateType(SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrent);
 		static readonly UnityEngineTimePropertyGetDeltaTimeDelegateType UnityEngineTimePropertyGetDeltaTimeDelegate = new UnityEngineTimePropertyGetDeltaTimeDelegateType(UnityEngineTimePropertyGetDeltaTime);
 		static readonly ReleaseBaseBallScriptDelegateType ReleaseBaseBallScriptDelegate = new ReleaseBaseBallScriptDelegateType(ReleaseBaseBallScript);
 		static readonly BaseBallScriptConstructorDelegateType BaseBallScriptConstructorDelegate = new BaseBallScriptConstructorDelegateType(BaseBallScriptConstructor);
@@ -618,6 +1118,11 @@ namespace NativeScript
 		static readonly UnboxSingleDelegateType UnboxSingleDelegate = new UnboxSingleDelegateType(UnboxSingle);
 		static readonly BoxDoubleDelegateType BoxDoubleDelegate = new BoxDoubleDelegateType(BoxDouble);
 		static readonly UnboxDoubleDelegateType UnboxDoubleDelegate = new UnboxDoubleDelegateType(UnboxDouble);
+		static readonly UnityEngineUnityEngineRaycastHitArray1Constructor1DelegateType UnityEngineUnityEngineRaycastHitArray1Constructor1Delegate = new UnityEngineUnityEngineRaycastHitArray1Constructor1DelegateType(UnityEngineUnityEngineRaycastHitArray1Constructor1);
+		static readonly UnityEngineRaycastHitArray1GetItem1DelegateType UnityEngineRaycastHitArray1GetItem1Delegate = new UnityEngineRaycastHitArray1GetItem1DelegateType(UnityEngineRaycastHitArray1GetItem1);
+		static readonly UnityEngineRaycastHitArray1SetItem1DelegateType UnityEngineRaycastHitArray1SetItem1Delegate = new UnityEngineRaycastHitArray1SetItem1DelegateType(UnityEngineRaycastHitArray1SetItem1);
+		static unsafe readonly UnityEngineRaycastHitArray1GetValuesDelegateType UnityEngineRaycastHitArray1GetValuesDelegate = new UnityEngineRaycastHitArray1GetValuesDelegateType(UnityEngineRaycastHitArray1GetValues);
+		static readonly UnityEngineRaycastHitArray1GetItemsDelegateType UnityEngineRaycastHitArray1GetItemsDelegate = new UnityEngineRaycastHitArray1GetItemsDelegateType(UnityEngineRaycastHitArray1GetItems);
 		/*END CSHARP DELEGATES*/
 		
 		/// <summary>
@@ -625,18 +1130,46 @@ namespace NativeScript
 		/// </summary>
 		/// 
 		/// <param name="memorySize">
-		/// Number of bytes of memory to make available to the C++ plugin
+		/// Number of bytes of memory to make available to the C++ plugin.
+		/// Address space for all of it is reserved, but it's only committed
+		/// as the plugin uses it.
+		/// </param>
+		/// 
+		/// <param name="frameMemorySize">
+		/// Number of bytes of memory for each of the two per-frame scratch
+		/// memories. These are part of memorySize.
 		/// </param>
-		public static void Open(int memorySize)
+		/// 
+		/// <param name="useLargePages">
+		/// If large pages should back the memory, where supported. This
+		/// reduces TLB misses when the plugin uses a lot of memory.
+		/// </param>
+		public static void Open(
+			int memorySize,
+			int frameMemorySize,
+			bool useLargePages)
 		{
+			// Both frame memories come out of the plugin memory
+			if (frameMemorySize < 0
+				|| 2L * frameMemorySize > memorySize)
+			{
+				throw new ArgumentException(
+					"Plugin memory size (" + memorySize + ") must be at " +
+					"least twice the frame memory size (" + frameMemorySize +
+					")",
+					"frameMemorySize");
+			}
+			
 			/*BEGIN STORE INIT CALLS*/
 			NativeScript.Bindings.ObjectStore.Init(1000);
 			NativeScript.Bindings.StructStore<System.Decimal>.Init(1000);
+			NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Init(1000);
 			/*END STORE INIT CALLS*/
 
-			// Allocate unmanaged memory
+			// Unmanaged memory is reserved when the plugin is opened
 			Bindings.memorySize = memorySize;
-			memory = Marshal.AllocHGlobal(memorySize);
+			Bindings.frameMemorySize = frameMemorySize;
+			Bindings.useLargePages = useLargePages;
 
 			// Allocate destroy queue
 			destroyQueueCapacity = 128;
@@ -657,6 +1190,10 @@ namespace NativeScript
 		{
 			DestroyAll();
 			ClosePlugin();
+			
+			// Snapshots have the old plugin's memory layout
+			numSnapshots = 0;
+			
 			OpenPlugin(InitMode.Reload);
 		}
 		
@@ -713,16 +1250,56 @@ namespace NativeScript
 			InitDelegate Init = GetDelegate<InitDelegate>(
 				libraryHandle,
 				"Init");
+			ReservePluginMemoryDelegate ReservePluginMemory = GetDelegate<ReservePluginMemoryDelegate>(
+				libraryHandle,
+				"ReservePluginMemory");
 			SetCsharpException = GetDelegate<SetCsharpExceptionDelegate>(
 				libraryHandle,
 				"SetCsharpException");
+			UpdatePlugin = GetDelegate<UpdatePluginDelegate>(
+				libraryHandle,
+				"UpdatePlugin");
+			GetPluginMemoryUsage = GetDelegate<GetPluginMemoryUsageDelegate>(
+				libraryHandle,
+				"GetPluginMemoryUsage");
+			ReleasePluginMemory = GetDelegate<ReleasePluginMemoryDelegate>(
+				libraryHandle,
+				"ReleasePluginMemory");
+			ReservePluginSnapshots = GetDelegate<ReservePluginSnapshotsDelegate>(
+				libraryHandle,
+				"ReservePluginSnapshots");
+			ReleasePluginSnapshots = GetDelegate<ReleasePluginSnapshotsDelegate>(
+				libraryHandle,
+				"ReleasePluginSnapshots");
+			SavePluginSnapshot = GetDelegate<SavePluginSnapshotDelegate>(
+				libraryHandle,
+				"SavePluginSnapshot");
+			RestorePluginSnapshot = GetDelegate<RestorePluginSnapshotDelegate>(
+				libraryHandle,
+				"RestorePluginSnapshot");
 			/*BEGIN GETDELEGATE CALLS*/
 			NewBaseBallScript = GetDelegate<NewBaseBallScriptDelegateType>(libraryHandle, "NewBaseBallScript");
 			DestroyBaseBallScript = GetDelegate<DestroyBaseBallScriptDelegateType>(libraryHandle, "DestroyBaseBallScript");
 			MyGameAbstractBaseBallScriptUpdate = GetDelegate<MyGameAbstractBaseBallScriptUpdateDelegateType>(libraryHandle, "MyGameAbstractBaseBallScriptUpdate");
+			RegisterBaseBallScript = GetDelegate<RegisterBaseBallScriptDelegateType>(libraryHandle, "RegisterBaseBallScript");
 			SetCsharpExceptionSystemNullReferenceException = GetDelegate<SetCsharpExceptionSystemNullReferenceExceptionDelegateType>(libraryHandle, "SetCsharpExceptionSystemNullReferenceException");
 			/*END GETDELEGATE CALLS*/
 #endif
+			// Reserve unmanaged memory. It keeps the same address when the
+			// plugin is reloaded.
+			if (initMode == InitMode.FirstBoot)
+			{
+				memory = ReservePluginMemory(
+					memorySize,
+					InitialCommittedMemorySize,
+					useLargePages ? 1 : 0);
+				if (memory == IntPtr.Zero)
+				{
+					throw new Exception(
+						"Couldn't reserve plugin memory");
+				}
+			}
+			
 			// Pass parameters through 'memory'
 			int curMemory = 0;
 			Marshal.WriteIntPtr(
@@ -750,6 +1327,56 @@ namespace NativeScript
 				curMemory,
 				Marshal.GetFunctionPointerForDelegate(EnumerableGetEnumeratorDelegate));
 			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(
+				memory,
+				curMemory,
+				Marshal.GetFunctionPointerForDelegate(EnumeratorMoveNextBatchDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(
+				memory,
+				curMemory,
+				Marshal.GetFunctionPointerForDelegate(StoreCsharpExceptionDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(
+				memory,
+				curMemory,
+				Marshal.GetFunctionPointerForDelegate(GameObjectPoolPrewarmDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(
+				memory,
+				curMemory,
+				Marshal.GetFunctionPointerForDelegate(ApplyGameObjectPoolCommandsDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(
+				memory,
+				curMemory,
+				Marshal.GetFunctionPointerForDelegate(SpawnGameObjectBatchDelegate));
+			curMemory += IntPtr.Size;
+			
+			// Reserve the physics message queue. C++ initializes it.
+			Marshal.WriteInt32(memory, curMemory, MaxPhysicsMessages);
+			curMemory += sizeof(int);
+			physicsMessages = new IntPtr(memory.ToInt64() + curMemory);
+			curMemory += Marshal.SizeOf(typeof(PhysicsMessageQueue))
+				+ MaxPhysicsMessages * Marshal.SizeOf(typeof(PhysicsMessage));
+			
+			// Reserve the bits for destroyed objects. C++ only reads them.
+			int numDestroyedObjectBits = ObjectStore.NumDestroyedObjectBits;
+			Marshal.WriteInt32(memory, curMemory, numDestroyedObjectBits);
+			curMemory += sizeof(int);
+			destroyedObjects = new IntPtr(memory.ToInt64() + curMemory);
+			curMemory += ((numDestroyedObjectBits + 31) / 32) * sizeof(uint);
+			
+			// Reserve the pooled GameObject command queue. C++ initializes
+			// it.
+			Marshal.WriteInt32(memory, curMemory, MaxGameObjectPoolCommands);
+			curMemory += sizeof(int);
+			gameObjectPoolCommands = new IntPtr(memory.ToInt64() + curMemory);
+			curMemory += Marshal.SizeOf(typeof(GameObjectPoolCommandQueue))
+				+ MaxGameObjectPoolCommands * Marshal.SizeOf(typeof(GameObjectPoolCommand));
+			
+			Marshal.WriteInt32(memory, curMemory, frameMemorySize);
+			curMemory += sizeof(int);
 			
 			/*BEGIN INIT CALL*/
 			Marshal.WriteInt32(memory, curMemory, 1000); // max managed objects
@@ -800,6 +1427,20 @@ namespace NativeScript
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnboxPrimitiveTypeDelegate));
 			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(ReleaseUnityEngineRaycastHitDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineRaycastHitGetValueDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(BoxRaycastHitDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnboxRaycastHitDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(SystemIDisposableMethodDisposeDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumeratorDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrentDelegate));
+			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineTimePropertyGetDeltaTimeDelegate));
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(ReleaseBaseBallScriptDelegate));
@@ -854,6 +1495,16 @@ namespace NativeScript
 			curMemory += IntPtr.Size;
 			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnboxDoubleDelegate));
 			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineUnityEngineRaycastHitArray1Constructor1Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineRaycastHitArray1GetItem1Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineRaycastHitArray1SetItem1Delegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineRaycastHitArray1GetValuesDelegate));
+			curMemory += IntPtr.Size;
+			Marshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(UnityEngineRaycastHitArray1GetItemsDelegate));
+			curMemory += IntPtr.Size;
 			/*END INIT CALL*/
 			
 			// Init C++ library
@@ -871,9 +1522,16 @@ namespace NativeScript
 		/// </summary>
 		public static void Close()
 		{
-			ClosePlugin();
-			Marshal.FreeHGlobal(memory);
+			destroyedObjects = IntPtr.Zero;
+			if (snapshots != IntPtr.Zero)
+			{
+				ReleasePluginSnapshots(snapshots, memorySize, NumSnapshotSlots);
+				snapshots = IntPtr.Zero;
+				numSnapshots = 0;
+			}
+			ReleasePluginMemory(memory, memorySize);
 			memory = IntPtr.Zero;
+			ClosePlugin();
 		}
 
 		/// <summary>
@@ -881,7 +1539,296 @@ namespace NativeScript
 		/// </summary>
 		public static void Update()
 		{
+			// Deliver physics messages before destroying their receivers
+			UpdatePlugin();
+			ApplyGameObjectPoolCommandQueue();
+			DestroyAll();
+			if (UnhandledCppException != null)
+			{
+				Exception ex = UnhandledCppException;
+				UnhandledCppException = null;
+				throw new Exception("Unhandled C++ exception in Update", ex);
+			}
+		}
+		
+		/// <summary>
+		/// Get how much of each part of the C++ plugin's memory is used.
+		/// This is cheap enough to call every frame.
+		/// </summary>
+		/// 
+		/// <param name="usages">
+		/// Filled in with as many parts as fit
+		/// </param>
+		/// 
+		/// <returns>
+		/// The number of parts, which may be more than fit in usages
+		/// </returns>
+		public static int GetMemoryUsage(MemoryUsage[] usages)
+		{
+			return GetPluginMemoryUsage(usages, usages.Length);
+		}
+		
+		/// <summary>
+		/// Save a snapshot of the C++ plugin's memory and the object stores,
+		/// overwriting the oldest if there are already NumSnapshotSlots.
+		/// Only the pages that changed since the overwritten snapshot are
+		/// copied. Don't call this while C++ is running.
+		/// </summary>
+		/// 
+		/// <returns>
+		/// ID of the snapshot to pass to RestoreSnapshot
+		/// </returns>
+		public static int SaveSnapshot()
+		{
+			if (snapshots == IntPtr.Zero)
+			{
+				snapshots = ReservePluginSnapshots(
+					memorySize,
+					NumSnapshotSlots);
+				if (snapshots == IntPtr.Zero)
+				{
+					throw new Exception(
+						"Couldn't reserve plugin snapshot memory");
+				}
+			}
+			
+			// Destroy the C++ objects of released C# objects first. Nothing
+			// would release them after the snapshot is restored.
 			DestroyAll();
+			
+			int slot = numSnapshots % NumSnapshotSlots;
+			if (SavePluginSnapshot(snapshots, slot) < 0)
+			{
+				throw new Exception("Couldn't save plugin snapshot");
+			}
+			/*BEGIN STORE SNAPSHOT SAVES*/
+			NativeScript.Bindings.ObjectStore.SaveSnapshot(slot);
+			NativeScript.Bindings.StructStore<System.Decimal>.SaveSnapshot(slot);
+			NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.SaveSnapshot(slot);
+			/*END STORE SNAPSHOT SAVES*/
+			SaveSnapshotCppObjects(slot);
+			return numSnapshots++;
+		}
+		
+		/// <summary>
+		/// Restore the C++ plugin's memory and the object stores from a
+		/// snapshot. Only the pages that changed since it was saved are
+		/// copied. Snapshots saved after it can still be restored. State
+		/// outside of plugin memory, such as C# objects and C++ globals,
+		/// isn't restored. Don't call this while C++ is running.
+		/// 
+		/// C# objects of base types created since the snapshot are detached
+		/// from their C++ objects, which don't exist in the restored memory.
+		/// Their CppHandle is zero so they no longer call into C++. Ones
+		/// released since the snapshot are bound to their C++ objects again.
+		/// Unity objects stored since the snapshot and not in the restored
+		/// object store are destroyed, including ones C++ only found, e.g.
+		/// with GameObject.Find. Snapshots are discarded when the plugin is
+		/// reloaded.
+		/// </summary>
+		/// 
+		/// <param name="snapshot">
+		/// ID returned by SaveSnapshot
+		/// </param>
+		/// 
+		/// <returns>
+		/// If the snapshot was restored. It can't be if it was overwritten.
+		/// </returns>
+		public static bool RestoreSnapshot(int snapshot)
+		{
+			if (snapshot < 0
+				|| snapshot >= numSnapshots
+				|| numSnapshots - snapshot > NumSnapshotSlots)
+			{
+				return false;
+			}
+			int slot = snapshot % NumSnapshotSlots;
+			RestorePluginSnapshot(snapshots, slot);
+			
+			// Queued destroys are for C++ objects in the replaced memory
+			lock (destroyQueueLockObj)
+			{
+				destroyQueueCount = 0;
+			}
+			
+			List<object> removedObjects = snapshotRemovedObjects;
+			/*BEGIN STORE SNAPSHOT RESTORES*/
+			NativeScript.Bindings.ObjectStore.RestoreSnapshot(slot, removedObjects);
+			NativeScript.Bindings.StructStore<System.Decimal>.RestoreSnapshot(slot);
+			NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.RestoreSnapshot(slot);
+			/*END STORE SNAPSHOT RESTORES*/
+			RebindSnapshotCppObjects(slot);
+			
+			// Detach C# objects from the C++ objects they had since the
+			// snapshot. Their memory is free in the restored plugin memory.
+			// Then destroy them if they're Unity objects.
+			for (int i = 0; i < removedObjects.Count; ++i)
+			{
+				object obj = removedObjects[i];
+				/*BEGIN BASE TYPE SNAPSHOT DETACHES*/
+				MyGame.BaseBallScript detachedBaseBallScript = obj as MyGame.BaseBallScript;
+				if (detachedBaseBallScript != null)
+				{
+					detachedBaseBallScript.CppHandle = 0;
+					detachedBaseBallScript.CppPointer = IntPtr.Zero;
+				}
+				/*END BASE TYPE SNAPSHOT DETACHES*/
+				UnityEngine.Object unityObj = obj as UnityEngine.Object;
+				if (unityObj != null)
+				{
+					UnityEngine.Object.Destroy(unityObj);
+				}
+			}
+			removedObjects.Clear();
+			return true;
+		}
+		
+		// Remember the C++ objects of the base type objects in a snapshot
+		static void SaveSnapshotCppObjects(int slot)
+		{
+			object[] savedObjects = ObjectStore.GetSnapshotObjects(slot);
+			if (snapshotCppHandles == null)
+			{
+				snapshotCppHandles = new int[NumSnapshotSlots][];
+				snapshotCppPointers = new IntPtr[NumSnapshotSlots][];
+			}
+			if (snapshotCppHandles[slot] == null)
+			{
+				snapshotCppHandles[slot] = new int[savedObjects.Length];
+				snapshotCppPointers[slot] = new IntPtr[savedObjects.Length];
+			}
+			int[] cppHandles = snapshotCppHandles[slot];
+			IntPtr[] cppPointers = snapshotCppPointers[slot];
+			for (int handle = 1; handle < savedObjects.Length; ++handle)
+			{
+				object obj = savedObjects[handle];
+				int cppHandle = 0;
+				IntPtr cppPointer = IntPtr.Zero;
+				/*BEGIN BASE TYPE SNAPSHOT SAVES*/
+				MyGame.BaseBallScript savedBaseBallScript = obj as MyGame.BaseBallScript;
+				if (savedBaseBallScript != null)
+				{
+					cppHandle = savedBaseBallScript.CppHandle;
+					cppPointer = savedBaseBallScript.CppPointer;
+				}
+				/*END BASE TYPE SNAPSHOT SAVES*/
+				cppHandles[handle] = cppHandle;
+				cppPointers[handle] = cppPointer;
+			}
+		}
+		
+		// Bind the base type objects in a restored snapshot to the C++
+		// objects they had when it was saved. Ones released since then were
+		// detached, but their C++ objects exist again in the restored memory.
+		static void RebindSnapshotCppObjects(int slot)
+		{
+			object[] restoredObjects = ObjectStore.GetSnapshotObjects(slot);
+			int[] cppHandles = snapshotCppHandles[slot];
+			IntPtr[] cppPointers = snapshotCppPointers[slot];
+			for (int handle = 1; handle < restoredObjects.Length; ++handle)
+			{
+				int cppHandle = cppHandles[handle];
+				if (cppHandle == 0)
+				{
+					continue;
+				}
+				object obj = restoredObjects[handle];
+				/*BEGIN BASE TYPE SNAPSHOT REBINDS*/
+				MyGame.BaseBallScript reboundBaseBallScript = obj as MyGame.BaseBallScript;
+				if (reboundBaseBallScript != null)
+				{
+					reboundBaseBallScript.CppHandle = cppHandle;
+					reboundBaseBallScript.CppPointer = cppPointers[handle];
+				}
+				/*END BASE TYPE SNAPSHOT REBINDS*/
+			}
+		}
+		
+		/// <summary>
+		/// Record the peak usage of each part of the C++ plugin's memory.
+		/// Call this every frame since the peak number of handles is only
+		/// known when memory usage is sampled.
+		/// </summary>
+		public static void RecordMemoryProfile()
+		{
+			if (profileUsages == null)
+			{
+				profileUsages = new MemoryUsage[64];
+				profileNamePtrs = new IntPtr[profileUsages.Length];
+				profileNames = new string[profileUsages.Length];
+				profilePeaks = new Dictionary<string, int>();
+			}
+			int numUsages = GetMemoryUsage(profileUsages);
+			if (numUsages > profileUsages.Length)
+			{
+				profileUsages = new MemoryUsage[numUsages];
+				Array.Resize(ref profileNamePtrs, numUsages);
+				Array.Resize(ref profileNames, numUsages);
+				GetMemoryUsage(profileUsages);
+			}
+			for (int i = 0; i < numUsages; ++i)
+			{
+				IntPtr namePtr = profileUsages[i].NamePtr;
+				if (namePtr != profileNamePtrs[i])
+				{
+					profileNamePtrs[i] = namePtr;
+					profileNames[i] = profileUsages[i].Name;
+				}
+				string name = profileNames[i];
+				int peak;
+				if (!profilePeaks.TryGetValue(name, out peak)
+					|| profileUsages[i].Peak > peak)
+				{
+					profilePeaks[name] = profileUsages[i].Peak;
+				}
+			}
+		}
+		
+		/// <summary>
+		/// Save the peaks recorded by RecordMemoryProfile to a file, keeping
+		/// any higher peaks already in it from earlier sessions
+		/// </summary>
+		/// 
+		/// <param name="path">
+		/// Path to the file, usually NativeScriptConstants.MEMORY_PROFILE_PATH
+		/// in the Assets directory
+		/// </param>
+		public static void SaveMemoryProfile(string path)
+		{
+			if (profilePeaks == null)
+			{
+				return;
+			}
+			Dictionary<string, int> peaks = new Dictionary<string, int>(
+				profilePeaks);
+			if (File.Exists(path))
+			{
+				MemoryProfile oldProfile = JsonUtility.FromJson<MemoryProfile>(
+					File.ReadAllText(path));
+				if (oldProfile.Pools != null)
+				{
+					foreach (MemoryProfilePool pool in oldProfile.Pools)
+					{
+						int peak;
+						if (!peaks.TryGetValue(pool.Name, out peak)
+							|| pool.Peak > peak)
+						{
+							peaks[pool.Name] = pool.Peak;
+						}
+					}
+				}
+			}
+			MemoryProfile profile = new MemoryProfile();
+			profile.Pools = new MemoryProfilePool[peaks.Count];
+			int index = 0;
+			foreach (KeyValuePair<string, int> pair in peaks)
+			{
+				MemoryProfilePool pool = new MemoryProfilePool();
+				pool.Name = pair.Key;
+				pool.Peak = pair.Value;
+				profile.Pools[index++] = pool;
+			}
+			File.WriteAllText(path, JsonUtility.ToJson(profile, true));
 		}
 		
 		private static void ClosePlugin()
@@ -930,17 +1877,166 @@ namespace NativeScript
 				DestroyEntry[] queue = destroyQueue;
 				for (int i = 0; i < count; ++i)
 				{
-					DestroyEntry entry = queue[i];
-					switch (entry.Function)
-					{
-						/*BEGIN DESTROY QUEUE CASES*/
-						case DestroyFunction.BaseBallScript:
-							DestroyBaseBallScript(entry.CppHandle);
-							break;
-						/*END DESTROY QUEUE CASES*/
-					}
+					DestroyEntry entry = queue[i];
+					switch (entry.Function)
+					{
+						/*BEGIN DESTROY QUEUE CASES*/
+						case DestroyFunction.BaseBallScript:
+							DestroyBaseBallScript(entry.CppHandle);
+							break;
+						/*END DESTROY QUEUE CASES*/
+					}
+				}
+				destroyQueueCount = 0;
+			}
+		}
+		
+		/// <summary>
+		/// Record a collision message for C++ to handle during the next
+		/// update
+		/// </summary>
+		public static unsafe void RecordCollisionMessage(
+			PhysicsMessageType type,
+			int receiver,
+			int cppHandle,
+			Collision collision)
+		{
+			PhysicsMessage* message = BeginPhysicsMessage(
+				type,
+				receiver,
+				cppHandle,
+				collision.collider);
+			if (message != null)
+			{
+				int contactCount = collision.contactCount;
+				message->ContactCount = contactCount;
+				if (contactCount > 0)
+				{
+					ContactPoint contact = collision.GetContact(0);
+					message->Point = contact.point;
+					message->Normal = contact.normal;
+				}
+				message->Impulse = collision.impulse;
+				message->RelativeVelocity = collision.relativeVelocity;
+			}
+		}
+		
+		/// <summary>
+		/// Record a trigger message for C++ to handle during the next update
+		/// </summary>
+		public static unsafe void RecordTriggerMessage(
+			PhysicsMessageType type,
+			int receiver,
+			int cppHandle,
+			Collider other)
+		{
+			BeginPhysicsMessage(
+				type,
+				receiver,
+				cppHandle,
+				other);
+		}
+		
+		// Add a message to the end of the queue with only the common fields
+		// set or return null if the queue is full
+		static unsafe PhysicsMessage* BeginPhysicsMessage(
+			PhysicsMessageType type,
+			int receiver,
+			int cppHandle,
+			Collider other)
+		{
+			PhysicsMessageQueue* queue = (PhysicsMessageQueue*)physicsMessages;
+			int capacity = queue->Capacity;
+			int count = queue->Count;
+			if (count == capacity)
+			{
+				queue->NumDropped++;
+				return null;
+			}
+			PhysicsMessage* message = (PhysicsMessage*)(queue + 1)
+				+ (queue->ReadIndex + count) % capacity;
+			*message = default(PhysicsMessage);
+			message->Type = type;
+			message->Receiver = receiver;
+			message->CppHandle = cppHandle;
+			message->OtherHandle = ObjectStore.GetHandle(other);
+			queue->Count = count + 1;
+			return message;
+		}
+		
+		// Make the changes C++ queued to pooled GameObjects, including any
+		// queued by scripts while they're being made
+		static unsafe void ApplyGameObjectPoolCommandQueue()
+		{
+			if (applyingGameObjectPoolCommands)
+			{
+				return;
+			}
+			GameObjectPoolCommandQueue* queue
+				= (GameObjectPoolCommandQueue*)gameObjectPoolCommands;
+			GameObjectPoolCommand* commands = (GameObjectPoolCommand*)(queue + 1);
+			applyingGameObjectPoolCommands = true;
+			
+			// Make the rest of the commands even if one throws, then throw the
+			// first exception
+			Exception firstException = null;
+			try
+			{
+				for (int i = 0; i < queue->Count; ++i)
+				{
+					GameObjectPoolCommand command = commands[i];
+					try
+					{
+						ApplyGameObjectPoolCommand(ref command);
+					}
+					catch (Exception ex)
+					{
+						if (firstException == null)
+						{
+							firstException = ex;
+						}
+					}
+				}
+			}
+			finally
+			{
+				queue->Count = 0;
+				applyingGameObjectPoolCommands = false;
+			}
+			if (firstException != null)
+			{
+				throw firstException;
+			}
+		}
+		
+		static void ApplyGameObjectPoolCommand(ref GameObjectPoolCommand command)
+		{
+			// Skip copies destroyed by something other than their pool
+			GameObject go = ObjectStore.Get(command.Handle) as GameObject;
+			if (go != null)
+			{
+				switch (command.Type)
+				{
+					case GameObjectPoolCommandType.Activate:
+						if (command.HasPosition != 0)
+						{
+							go.transform.position = command.Position;
+						}
+						go.SetActive(true);
+						break;
+					case GameObjectPoolCommandType.Deactivate:
+						go.SetActive(false);
+						break;
+					case GameObjectPoolCommandType.Destroy:
+						UnityEngine.Object.Destroy(go);
+						break;
 				}
-				destroyQueueCount = 0;
+			}
+			
+			// C++ released its last reference when it queued the command
+			if (command.ReleaseHandle != 0)
+			{
+				ObjectStore.Remove(command.Handle);
 			}
 		}
 		
@@ -983,6 +2079,177 @@ namespace NativeScript
 		{
 			return ObjectStore.Store(((IEnumerable)ObjectStore.Get(handle)).GetEnumerator());
 		}
+		
+		// Move an enumerator forward up to maxCount times, writing a handle
+		// to each element. Returns the number written, which is less than
+		// maxCount only when the enumerator has reached the end or threw an
+		// exception. C++ releases the ones written before an exception.
+		[MonoPInvokeCallback(typeof(EnumeratorMoveNextBatchDelegateType))]
+		static int EnumeratorMoveNextBatch(
+			int handle,
+			IntPtr handles,
+			int maxCount)
+		{
+			int count = 0;
+			try
+			{
+				IEnumerator enumerator = (IEnumerator)ObjectStore.Get(handle);
+				while (count < maxCount && enumerator.MoveNext())
+				{
+					Marshal.WriteInt32(
+						handles,
+						count * sizeof(int),
+						ObjectStore.GetHandle(enumerator.Current));
+					count++;
+				}
+			}
+			catch (Exception ex)
+			{
+				UnhandledCsharpException = ex;
+				SetCsharpException();
+			}
+			return count;
+		}
+		
+		// Store the exception most recently caught while C++ was calling
+		// into C#. C++ only calls this when it needs the exception object.
+		[MonoPInvokeCallback(typeof(StoreCsharpExceptionDelegateType))]
+		static int StoreCsharpException()
+		{
+			Exception ex = UnhandledCsharpException;
+			UnhandledCsharpException = null;
+			return ObjectStore.Store(ex);
+		}
+		
+		// Instantiate count inactive copies of a GameObject, writing a
+		// handle and instance ID for each. Returns the number written. The
+		// copies are active while they're instantiated so their scripts are
+		// awake before C++ spawns them.
+		[MonoPInvokeCallback(typeof(GameObjectPoolPrewarmDelegateType))]
+		static int GameObjectPoolPrewarm(
+			int originalHandle,
+			int count,
+			IntPtr handles,
+			IntPtr instanceIds)
+		{
+			int numCreated = 0;
+			try
+			{
+				GameObject original = (GameObject)ObjectStore.Get(originalHandle);
+				while (numCreated < count)
+				{
+					GameObject copy = (GameObject)UnityEngine.Object.Instantiate(original);
+					copy.SetActive(false);
+					Marshal.WriteInt32(
+						handles,
+						numCreated * sizeof(int),
+						ObjectStore.Store(copy));
+					Marshal.WriteInt32(
+						instanceIds,
+						numCreated * sizeof(int),
+						copy.GetInstanceID());
+					numCreated++;
+				}
+			}
+			catch (Exception ex)
+			{
+				UnhandledCsharpException = ex;
+				SetCsharpException();
+			}
+			return numCreated;
+		}
+		
+		[MonoPInvokeCallback(typeof(ApplyGameObjectPoolCommandsDelegateType))]
+		static void ApplyGameObjectPoolCommands()
+		{
+			try
+			{
+				ApplyGameObjectPoolCommandQueue();
+			}
+			catch (Exception ex)
+			{
+				UnhandledCsharpException = ex;
+				SetCsharpException();
+			}
+		}
+		
+		// Create a GameObject for each descriptor, writing a handle to each
+		// if handles isn't null. Returns the number created.
+		[MonoPInvokeCallback(typeof(SpawnGameObjectBatchDelegateType))]
+		static unsafe int SpawnGameObjectBatch(
+			IntPtr descriptors,
+			int count,
+			IntPtr names,
+			IntPtr components,
+			IntPtr handles)
+		{
+			SpawnDescriptor* descriptorPtrs = (SpawnDescriptor*)descriptors;
+			int* namePtrs = (int*)names;
+			SpawnComponent* componentPtrs = (SpawnComponent*)components;
+			int* handlePtrs = (int*)handles;
+			int numCreated = 0;
+			try
+			{
+				while (numCreated < count)
+				{
+					SpawnDescriptor* descriptor = descriptorPtrs + numCreated;
+					GameObject go;
+					if (descriptor->PrefabHandle != 0)
+					{
+						GameObject prefab = (GameObject)ObjectStore.Get(
+							descriptor->PrefabHandle);
+						go = (GameObject)UnityEngine.Object.Instantiate(
+							prefab,
+							descriptor->Position,
+							prefab.transform.rotation);
+					}
+					else
+					{
+						go = descriptor->PrimitiveType >= 0
+							? GameObject.CreatePrimitive(
+								(PrimitiveType)descriptor->PrimitiveType)
+							: new GameObject();
+						go.transform.position = descriptor->Position;
+					}
+					if (descriptor->NameIndex >= 0)
+					{
+						go.name = (string)ObjectStore.Get(
+							namePtrs[descriptor->NameIndex]);
+					}
+					for (int i = 0; i < descriptor->NumComponents; ++i)
+					{
+						AddSpawnComponent(
+							go,
+							componentPtrs[descriptor->FirstComponent + i]);
+					}
+					if (handlePtrs != null)
+					{
+						handlePtrs[numCreated] = ObjectStore.Store(go);
+					}
+					numCreated++;
+				}
+			}
+			catch (Exception ex)
+			{
+				UnhandledCsharpException = ex;
+				SetCsharpException();
+			}
+			return numCreated;
+		}
+		
+		static void AddSpawnComponent(
+			GameObject go,
+			SpawnComponent component)
+		{
+			switch (component)
+			{
+				/*BEGIN SPAWN COMPONENT CASES*/
+				case SpawnComponent.BaseBallScript:
+					go.AddComponent<MyGame.BaseBallScript>();
+					break;
+				/*END SPAWN COMPONENT CASES*/
+			}
+		}
 
 		/*BEGIN FUNCTIONS*/
 		[MonoPInvokeCallback(typeof(ReleaseSystemDecimalDelegateType))]
@@ -997,13 +2264,13 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 			}
 		}
 		
@@ -1017,14 +2284,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1039,14 +2306,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1062,14 +2329,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1085,14 +2352,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1107,14 +2374,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(UnityEngine.Vector3);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(UnityEngine.Vector3);
 			}
 		}
@@ -1129,14 +2396,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(UnityEngine.Vector3);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(UnityEngine.Vector3);
 			}
 		}
@@ -1151,14 +2418,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1174,14 +2441,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(UnityEngine.Vector3);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(UnityEngine.Vector3);
 			}
 		}
@@ -1197,14 +2464,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1220,13 +2487,13 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 			}
 		}
 		
@@ -1241,14 +2508,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1264,14 +2531,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(UnityEngine.Vector3);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(UnityEngine.Vector3);
 			}
 		}
@@ -1286,13 +2553,13 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 			}
 		}
 		
@@ -1307,14 +2574,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1330,14 +2597,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(bool);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(bool);
 			}
 		}
@@ -1353,14 +2620,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1375,14 +2642,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1397,13 +2664,13 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 			}
 		}
 		
@@ -1418,14 +2685,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1441,14 +2708,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1463,14 +2730,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1486,18 +2753,185 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(UnityEngine.PrimitiveType);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(UnityEngine.PrimitiveType);
 			}
 		}
 		
+		[MonoPInvokeCallback(typeof(ReleaseUnityEngineRaycastHitDelegateType))]
+		static void ReleaseUnityEngineRaycastHit(int handle)
+		{
+			try
+			{
+				if (handle != 0)
+			{
+				NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Remove(handle);
+			}
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineRaycastHitGetValueDelegateType))]
+		static unsafe void UnityEngineRaycastHitGetValue(int thisHandle, void* value)
+		{
+			try
+			{
+				var thiz = (UnityEngine.RaycastHit)NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Get(thisHandle);
+				var pValue = (UnityEngineRaycastHitValue*)value;
+				pValue->point = thiz.point;
+				pValue->normal = thiz.normal;
+				pValue->distance = thiz.distance;
+				pValue->colliderHandle = NativeScript.Bindings.ObjectStore.GetHandle(thiz.collider);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(BoxRaycastHitDelegateType))]
+		static int BoxRaycastHit(int valHandle)
+		{
+			try
+			{
+				var val = (UnityEngine.RaycastHit)NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Get(valHandle);
+				var returnValue = NativeScript.Bindings.ObjectStore.Store((object)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+				return default(int);
+			}
+		}
+		
+		[StructLayout(LayoutKind.Sequential)]
+		struct UnityEngineRaycastHitValue
+		{
+			public UnityEngine.Vector3 point;
+			public UnityEngine.Vector3 normal;
+			public float distance;
+			public int colliderHandle;
+		}
+		
+		[MonoPInvokeCallback(typeof(UnboxRaycastHitDelegateType))]
+		static int UnboxRaycastHit(int valHandle)
+		{
+			try
+			{
+				var val = NativeScript.Bindings.ObjectStore.Get(valHandle);
+				var returnValue = NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Store((UnityEngine.RaycastHit)val);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(SystemIDisposableMethodDisposeDelegateType))]
+		static void SystemIDisposableMethodDispose(int thisHandle)
+		{
+			try
+			{
+				var thiz = (System.IDisposable)NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				thiz.Dispose();
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumeratorDelegateType))]
+		static int SystemCollectionsGenericIEnumerableUnityEngineRaycastHitMethodGetEnumerator(int thisHandle)
+		{
+			try
+			{
+				var thiz = (System.Collections.Generic.IEnumerable<UnityEngine.RaycastHit>)NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				var returnValue = thiz.GetEnumerator();
+				return NativeScript.Bindings.ObjectStore.GetHandle(returnValue);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrentDelegateType))]
+		static int SystemCollectionsGenericIEnumeratorUnityEngineRaycastHitPropertyGetCurrent(int thisHandle)
+		{
+			try
+			{
+				var thiz = (System.Collections.Generic.IEnumerator<UnityEngine.RaycastHit>)NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				var returnValue = thiz.Current;
+				return NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Store(returnValue);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+				return default(int);
+			}
+		}
+		
 		[MonoPInvokeCallback(typeof(UnityEngineTimePropertyGetDeltaTimeDelegateType))]
 		static float UnityEngineTimePropertyGetDeltaTime()
 		{
@@ -1508,36 +2942,36 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(float);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(float);
 			}
 		}
 		
 		[MonoPInvokeCallback(typeof(BaseBallScriptConstructorDelegateType))]
-		static void BaseBallScriptConstructor(int cppHandle, ref int handle)
+		static void BaseBallScriptConstructor(int cppHandle, System.IntPtr cppPointer, ref int handle)
 		{
 			try
 			{
-				var thiz = new MyGame.BaseBallScript(cppHandle);
+				var thiz = new MyGame.BaseBallScript(cppHandle, cppPointer);
 				handle = NativeScript.Bindings.ObjectStore.Store(thiz);
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				handle = default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				handle = default(int);
 			}
 		}
@@ -1551,18 +2985,19 @@ namespace NativeScript
 				thiz = (MyGame.BaseBallScript)ObjectStore.Get(handle);
 				int cppHandle = thiz.CppHandle;
 				thiz.CppHandle = 0;
+				thiz.CppPointer = IntPtr.Zero;
 				QueueDestroy(DestroyFunction.BaseBallScript, cppHandle);
 				ObjectStore.Remove(handle);
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 			}
 		}
 		
@@ -1576,14 +3011,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1599,14 +3034,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(bool);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(bool);
 			}
 		}
@@ -1621,14 +3056,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1644,14 +3079,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(sbyte);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(sbyte);
 			}
 		}
@@ -1666,14 +3101,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1689,14 +3124,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(byte);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(byte);
 			}
 		}
@@ -1711,14 +3146,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1734,14 +3169,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(short);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(short);
 			}
 		}
@@ -1756,14 +3191,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1779,14 +3214,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(ushort);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(ushort);
 			}
 		}
@@ -1801,14 +3236,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1824,14 +3259,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1846,14 +3281,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1869,14 +3304,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(uint);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(uint);
 			}
 		}
@@ -1891,14 +3326,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1914,14 +3349,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(long);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(long);
 			}
 		}
@@ -1936,14 +3371,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -1959,14 +3394,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(ulong);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(ulong);
 			}
 		}
@@ -1981,14 +3416,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -2004,14 +3439,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(char);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(char);
 			}
 		}
@@ -2026,14 +3461,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -2049,14 +3484,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(float);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(float);
 			}
 		}
@@ -2071,14 +3506,14 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(int);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(int);
 			}
 		}
@@ -2094,17 +3529,134 @@ namespace NativeScript
 			}
 			catch (System.NullReferenceException ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
 				return default(double);
 			}
 			catch (System.Exception ex)
 			{
-				UnityEngine.Debug.LogException(ex);
-				NativeScript.Bindings.SetCsharpException(NativeScript.Bindings.ObjectStore.Store(ex));
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
 				return default(double);
 			}
 		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineUnityEngineRaycastHitArray1Constructor1DelegateType))]
+		static int UnityEngineUnityEngineRaycastHitArray1Constructor1(int length0)
+		{
+			try
+			{
+				var returnValue = NativeScript.Bindings.ObjectStore.Store(new UnityEngine.RaycastHit[length0]);
+				return returnValue;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineRaycastHitArray1GetItem1DelegateType))]
+		static int UnityEngineRaycastHitArray1GetItem1(int thisHandle, int index0)
+		{
+			try
+			{
+				var thiz = (UnityEngine.RaycastHit[])NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				var returnValue = thiz[index0];
+				return NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Store(returnValue);
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+				return default(int);
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+				return default(int);
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineRaycastHitArray1SetItem1DelegateType))]
+		static void UnityEngineRaycastHitArray1SetItem1(int thisHandle, int index0, int itemHandle)
+		{
+			try
+			{
+				var thiz = (UnityEngine.RaycastHit[])NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				var item = (UnityEngine.RaycastHit)NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Get(itemHandle);
+				thiz[index0] = item;
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineRaycastHitArray1GetValuesDelegateType))]
+		static unsafe void UnityEngineRaycastHitArray1GetValues(int thisHandle, int startIndex, int count, void* values)
+		{
+			try
+			{
+				var thiz = (UnityEngine.RaycastHit[])NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				var pValues = (UnityEngineRaycastHitValue*)values;
+				for (int i = 0; i < count; ++i)
+				{
+					var item = thiz[startIndex + i];
+					pValues[i].point = item.point;
+					pValues[i].normal = item.normal;
+					pValues[i].distance = item.distance;
+					pValues[i].colliderHandle = NativeScript.Bindings.ObjectStore.GetHandle(item.collider);
+				}
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+			}
+		}
+		
+		[MonoPInvokeCallback(typeof(UnityEngineRaycastHitArray1GetItemsDelegateType))]
+		static void UnityEngineRaycastHitArray1GetItems(int thisHandle, int startIndex, int count, System.IntPtr items)
+		{
+			try
+			{
+				var thiz = (UnityEngine.RaycastHit[])NativeScript.Bindings.ObjectStore.Get(thisHandle);
+				for (int i = 0; i < count; ++i)
+				{
+					Marshal.WriteInt32(items, i * 4, NativeScript.Bindings.StructStore<UnityEngine.RaycastHit>.Store(thiz[startIndex + i]));
+				}
+			}
+			catch (System.NullReferenceException ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpExceptionSystemNullReferenceException();
+			}
+			catch (System.Exception ex)
+			{
+				NativeScript.Bindings.UnhandledCsharpException = ex;
+				NativeScript.Bindings.SetCsharpException();
+			}
+		}
 		/*END FUNCTIONS*/
 	}
 }
@@ -2115,11 +3667,19 @@ namespace MyGame
 	class BaseBallScript : MyGame.AbstractBaseBallScript
 	{
 		public int CppHandle;
+		public IntPtr CppPointer;
 		
 		public BaseBallScript()
 		{
 			int handle = NativeScript.Bindings.ObjectStore.Store(this);
-			CppHandle = NativeScript.Bindings.NewBaseBallScript(handle);
+			CppHandle = NativeScript.Bindings.NewBaseBallScript(handle, out CppPointer);
+			if (NativeScript.Bindings.UnhandledCppException != null)
+			{
+				NativeScript.Bindings.ObjectStore.Remove(handle);
+				Exception ex = NativeScript.Bindings.UnhandledCppException;
+				NativeScript.Bindings.UnhandledCppException = null;
+				throw ex;
+			}
 		}
 		
 		~BaseBallScript()
@@ -2128,21 +3688,23 @@ namespace MyGame
 			{
 				NativeScript.Bindings.QueueDestroy(NativeScript.Bindings.DestroyFunction.BaseBallScript, CppHandle);
 				CppHandle = 0;
+				CppPointer = IntPtr.Zero;
 			}
 		}
 		
-		public BaseBallScript(int cppHandle)
+		public BaseBallScript(int cppHandle, IntPtr cppPointer)
 			: base()
 		{
 			CppHandle = cppHandle;
+			CppPointer = cppPointer;
 		}
 		
 		public override void Update()
 		{
 			if (CppHandle != 0)
 			{
-				int thisHandle = CppHandle;
-				NativeScript.Bindings.MyGameAbstractBaseBallScriptUpdate(thisHandle);
+				IntPtr thisPointer = CppPointer;
+				NativeScript.Bindings.MyGameAbstractBaseBallScriptUpdate(thisPointer);
 				if (NativeScript.Bindings.UnhandledCppException != null)
 				{
 					Exception ex = NativeScript.Bindings.UnhandledCppException;
@@ -2152,6 +3714,19 @@ namespace MyGame
 			}
 		}
 	
+		void Awake()
+		{
+			if (CppHandle != 0)
+			{
+				NativeScript.Bindings.RegisterBaseBallScript(CppPointer, gameObject.GetInstanceID());
+			}
+		}
+		
+		void OnDestroy()
+		{
+			NativeScript.Bindings.ObjectStore.MarkDestroyed(this);
+		}
+		
 	}
 }
 /*END BASE TYPES*/
\ No newline at end of file
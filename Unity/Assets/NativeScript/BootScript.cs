@@ -1,11 +1,14 @@
 using System;
+using System.IO;
 using UnityEditor;
 using UnityEngine;
 
 namespace NativeScript
 {
 	/// <summary>
-	/// Script to run at app startup that initializes and runs the native plugin
+	/// Script to run at app startup that initializes and runs the native plugin.
+	/// It updates before other scripts so the frame memories are swapped
+	/// before any C++ script updates during the frame.
 	/// </summary>
 	/// 
 	/// <author>
@@ -15,9 +18,19 @@ namespace NativeScript
 	/// <license>
 	/// MIT
 	/// </license>
+	[DefaultExecutionOrder(-1000)]
 	public class BootScript : MonoBehaviour
 	{
-		public int MemorySize = 1024 * 1024 * 16;
+		// Maximum plugin memory size. Only the memory the plugin uses is
+		// committed.
+		public int MemorySize = 1024 * 1024 * 256;
+		
+		// Size of each of the two per-frame scratch memories, which are part
+		// of MemorySize
+		public int FrameMemorySize = 1024 * 1024 * 4;
+		
+		// If large pages should back the plugin memory, where supported
+		public bool UseLargePages;
 		
 		// Reloading requires dynamic loading of the C++ plugin, which is only
 		// available in the editor
@@ -25,6 +38,12 @@ namespace NativeScript
 		public bool AutoReload;
 		
 		public float AutoReloadPollTime = 1.0f;
+		
+		// If the peak usage of plugin memory pools should be saved to
+		// NativeScriptConstants.MEMORY_PROFILE_PATH when play mode ends so
+		// the code generator can size them with UseMemoryProfile
+		public bool RecordMemoryProfile;
+		
 		private float lastAutoReloadPollTime;
 		private Coroutine autoReloadCoroutine;
 		private Action<PlayModeStateChange> onPlayModeStateChange;
@@ -36,18 +55,23 @@ namespace NativeScript
 			lastAutoReloadPollTime = AutoReloadPollTime;
 #endif
 			DontDestroyOnLoad(gameObject);
-			Bindings.Open(MemorySize);
+			Bindings.Open(MemorySize, FrameMemorySize, UseLargePages);
 #if UNITY_EDITOR
 			onPlayModeStateChange = OnEditorStateChanged;
 			EditorApplication.playModeStateChanged += onPlayModeStateChange;
 #endif
 		}
 		
-#if UNITY_EDITOR
 		void Update()
 		{
 			Bindings.Update();
 
+#if UNITY_EDITOR
+			if (RecordMemoryProfile)
+			{
+				Bindings.RecordMemoryProfile();
+			}
+			
 			if (AutoReload)
 			{
 				if (AutoReloadPollTime > 0)
@@ -80,13 +104,23 @@ namespace NativeScript
 					autoReloadCoroutine = null;
 				}
 			}
+#endif
 		}
 
+#if UNITY_EDITOR
 		private void OnEditorStateChanged(PlayModeStateChange state)
 		{
 			if (state == PlayModeStateChange.EnteredEditMode)
 			{
 				EditorApplication.playModeStateChanged -= onPlayModeStateChange;
+				if (RecordMemoryProfile)
+				{
+					Bindings.RecordMemoryProfile();
+					Bindings.SaveMemoryProfile(
+						Path.Combine(
+							Application.dataPath,
+							NativeScriptConstants.MEMORY_PROFILE_PATH));
+				}
 				Bindings.Close();
 			}
 		}
@@ -92,6 +92,7 @@ namespace NativeScript.Editor
 			public JsonGenericParams[] GenericParams;
 			public int MaxSimultaneous;
 			public JsonBaseType[] BaseTypes;
+			public string[] ValueMembers;
 		}
 		
 		[Serializable]
@@ -105,6 +106,17 @@ namespace NativeScript.Editor
 			public JsonMethod[] OverrideMethods;
 			public JsonProperty[] OverrideProperties;
 			public JsonEvent[] OverrideEvents;
+			public string[] BatchedMessages;
+			public JsonHotField[] HotFields;
+			public bool GameObjectRegistry;
+		}
+		
+		[Serializable]
+		class JsonHotField
+		{
+			public string Name;
+			public string Type;
+			public string Default;
 		}
 		
 		[Serializable]
@@ -127,6 +139,8 @@ namespace NativeScript.Editor
 		{
 			public int MaxSimultaneousObjects;
 			public int DefaultMaxSimultaneous;
+			public bool UseMemoryProfile;
+			public int MemoryProfileMargin;
 			public string[] Assemblies;
 			public JsonType[] Types;
 			public JsonArray[] Arrays;
@@ -141,6 +155,16 @@ namespace NativeScript.Editor
 				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CsharpStoreInitCalls =
 				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CsharpStoreSnapshotSaves =
+				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CsharpStoreSnapshotRestores =
+				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CsharpBaseTypeSnapshotDetaches =
+				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CsharpBaseTypeSnapshotSaves =
+				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CsharpBaseTypeSnapshotRebinds =
+				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CsharpInitCall =
 				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CsharpBaseTypes =
@@ -159,6 +183,10 @@ namespace NativeScript.Editor
 				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CsharpDestroyQueueCases =
 				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CsharpSpawnComponentEnumerators =
+				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CsharpSpawnComponentCases =
+				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CppFunctionPointers =
 				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CppTypeDeclarations =
@@ -175,6 +203,9 @@ namespace NativeScript.Editor
 				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CppInitBodyArrays =
 				new StringBuilder(InitialStringBuilderCapacity);
+			// Rarely-used regions placed after all of CppInitBodyArrays
+			public readonly StringBuilder CppInitBodyColdArrays =
+				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CppInitBodyFirstBoot =
 				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CppGlobalStateAndFunctions =
@@ -185,8 +216,24 @@ namespace NativeScript.Editor
 				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder CppMacros =
 				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CppPhysicsMessageCases =
+				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CppMemoryUsage =
+				new StringBuilder(InitialStringBuilderCapacity);
+			public readonly StringBuilder CppSpawnComponentEnumerators =
+				new StringBuilder(InitialStringBuilderCapacity);
 			public readonly StringBuilder TempStrBuilder =
 				new StringBuilder(InitialStringBuilderCapacity);
+			
+			// Number of base types that batch physics messages. Each is
+			// identified in the messages by its one-based index.
+			public int NumPhysicsMessageReceivers;
+			
+			// C# statements the Unity messages of the base type being
+			// generated need to run before anything else, keyed by message
+			// name. A message C++ overrides runs them before calling C++.
+			public readonly Dictionary<string, string> CsharpMessagePrologues =
+				new Dictionary<string, string>();
 		}
 		
 		class ParameterInfo
@@ -263,6 +310,17 @@ namespace NativeScript.Editor
 
 		const int BaseMaxSimultaneous = 1000;
 		
+		// Percent more than the profiled peak to size pools to
+		const int BaseMemoryProfileMargin = 25;
+		
+		// Smallest size of a pool sized from a memory profile
+		const int MinProfiledMaxSimultaneous = 16;
+		
+		// Peak usage of pools by the names they're reported with. Null if
+		// pools aren't sized from a memory profile.
+		static Dictionary<string, int> memoryProfilePeaks;
+		static int memoryProfileMargin;
+		
 		static readonly Type[] PrimitiveTypes = {
 			typeof(bool),
 			typeof(sbyte),
@@ -509,9 +567,16 @@ namespace NativeScript.Editor
 				? doc.DefaultMaxSimultaneous
 				: BaseMaxSimultaneous;
 			
+			// Size pools from their peak usage if configured to
+			LoadMemoryProfile(doc);
+			int maxManagedObjects = GetProfiledMaxSimultaneous(
+				"RefCountsClass",
+				defaultMaxSimultaneous,
+				true);
+			
 			// Init param for max managed Objects
 			builders.CsharpInitCall.Append("\t\t\tMarshal.WriteInt32(memory, curMemory, ");
-			builders.CsharpInitCall.Append(defaultMaxSimultaneous);
+			builders.CsharpInitCall.Append(maxManagedObjects);
 			builders.CsharpInitCall.AppendLine("); // max managed objects");
 			builders.CsharpInitCall.AppendLine("\t\t\tcurMemory += sizeof(int);");
 			builders.CsharpInitCall.Append(' ');
@@ -519,9 +584,15 @@ namespace NativeScript.Editor
 			// C# ObjectStore Init call
 			builders.CsharpStoreInitCalls.Append(
 				"\t\t\tNativeScript.Bindings.ObjectStore.Init(");
-			builders.CsharpStoreInitCalls.Append(defaultMaxSimultaneous);
+			builders.CsharpStoreInitCalls.Append(maxManagedObjects);
 			builders.CsharpStoreInitCalls.AppendLine(");");
 			
+			// C# ObjectStore snapshot calls
+			builders.CsharpStoreSnapshotSaves.AppendLine(
+				"\t\t\tNativeScript.Bindings.ObjectStore.SaveSnapshot(slot);");
+			builders.CsharpStoreSnapshotRestores.AppendLine(
+				"\t\t\tNativeScript.Bindings.ObjectStore.RestoreSnapshot(slot, removedObjects);");
+			
 			// Generate types
 			if (doc.Types != null)
 			{
@@ -585,6 +656,7 @@ namespace NativeScript.Editor
 				{
 					AppendArray(
 						array,
+						doc.Types,
 						assemblies,
 						builders);
 				}
@@ -609,6 +681,10 @@ namespace NativeScript.Editor
 				assemblies,
 				builders);
 			
+			// Place rarely-used Init regions after the frequently-used ones so
+			// they don't share cache lines or pages
+			builders.CppInitBodyArrays.Append(builders.CppInitBodyColdArrays);
+			
 			// Output source files
 			RemoveTrailingChars(builders);
 			InjectBuilders(builders);
@@ -641,6 +717,68 @@ namespace NativeScript.Editor
 			return JsonUtility.FromJson<JsonDocument>(json);
 		}
 		
+		static void LoadMemoryProfile(JsonDocument doc)
+		{
+			memoryProfilePeaks = null;
+			if (!doc.UseMemoryProfile)
+			{
+				return;
+			}
+			string profilePath = Path.Combine(
+				Application.dataPath,
+				NativeScriptConstants.MEMORY_PROFILE_PATH);
+			if (!File.Exists(profilePath))
+			{
+				Debug.LogWarningFormat(
+					"Not sizing pools from a memory profile because {0} " +
+					"doesn't exist. Enable RecordMemoryProfile on " +
+					"BootScript and play to record one.",
+					profilePath);
+				return;
+			}
+			string json = File.ReadAllText(profilePath);
+			NativeScript.Bindings.MemoryProfile profile =
+				JsonUtility.FromJson<NativeScript.Bindings.MemoryProfile>(json);
+			memoryProfilePeaks = new Dictionary<string, int>();
+			if (profile.Pools != null)
+			{
+				foreach (NativeScript.Bindings.MemoryProfilePool pool in profile.Pools)
+				{
+					memoryProfilePeaks[pool.Name] = pool.Peak;
+				}
+			}
+			memoryProfileMargin = doc.MemoryProfileMargin != 0
+				? doc.MemoryProfileMargin
+				: BaseMemoryProfileMargin;
+		}
+		
+		// Get the size of a pool from its peak in the memory profile plus
+		// the margin. Pools the profile doesn't have keep maxSimultaneous.
+		// Stores indexed by handle never use handle 0, so they get one more.
+		// Free lists grow when they run out, so they don't need it.
+		static int GetProfiledMaxSimultaneous(
+			string poolName,
+			int maxSimultaneous,
+			bool isIndexedByHandle)
+		{
+			int peak;
+			if (memoryProfilePeaks == null
+				|| !memoryProfilePeaks.TryGetValue(poolName, out peak))
+			{
+				return maxSimultaneous;
+			}
+			
+			int margin = (peak * memoryProfileMargin + 99) / 100;
+			int size = peak + margin;
+			if (isIndexedByHandle)
+			{
+				size++;
+			}
+			return Math.Max(
+				size,
+				MinProfiledMaxSimultaneous);
+		}
+		
 		static Assembly[] GetAssemblies(string[] assemblyNames)
 		{
 			const int numDefaultAssemblies =
@@ -1353,6 +1491,25 @@ namespace NativeScript.Editor
 			return type.IsValueType && !IsFullValueType(type);
 		}
 		
+		// C# pointers can only be used in an unsafe context
+		static bool IsUnsafeBinding(
+			Type returnType,
+			ParameterInfo[] parameters)
+		{
+			if (returnType != null && returnType.IsPointer)
+			{
+				return true;
+			}
+			foreach (ParameterInfo param in parameters)
+			{
+				if (param.Kind == TypeKind.Pointer)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		
 		static bool IsFullValueType(Type type)
 		{
 			if (!type.IsValueType)
@@ -1551,6 +1708,20 @@ namespace NativeScript.Editor
 			bool isStatic = IsStatic(type);
 			if (!isStatic && typeKind == TypeKind.ManagedStruct)
 			{
+				// Build function name suffix
+				builders.TempStrBuilder.Length = 0;
+				AppendReleaseFunctionNameSuffix(
+					GetTypeName(type),
+					typeParams,
+					builders.TempStrBuilder);
+				string funcNameSuffix = builders.TempStrBuilder.ToString();
+				
+				// The C# store and C++ ref counts are the same size
+				maxSimultaneous = GetProfiledMaxSimultaneous(
+					"RefCounts" + funcNameSuffix,
+					maxSimultaneous,
+					true);
+				
 				// C# StructStore Init call
 				builders.CsharpStoreInitCalls.Append(
 					"\t\t\tNativeScript.Bindings.StructStore<");
@@ -1561,13 +1732,19 @@ namespace NativeScript.Editor
 				builders.CsharpStoreInitCalls.Append(maxSimultaneous);
 				builders.CsharpStoreInitCalls.AppendLine(");");
 				
-				// Build function name suffix
-				builders.TempStrBuilder.Length = 0;
-				AppendReleaseFunctionNameSuffix(
-					GetTypeName(type),
-					typeParams,
-					builders.TempStrBuilder);
-				string funcNameSuffix = builders.TempStrBuilder.ToString();
+				// C# StructStore snapshot calls
+				builders.CsharpStoreSnapshotSaves.Append(
+					"\t\t\tNativeScript.Bindings.StructStore<");
+				AppendCsharpTypeFullName(
+					type,
+					builders.CsharpStoreSnapshotSaves);
+				builders.CsharpStoreSnapshotSaves.AppendLine(">.SaveSnapshot(slot);");
+				builders.CsharpStoreSnapshotRestores.Append(
+					"\t\t\tNativeScript.Bindings.StructStore<");
+				AppendCsharpTypeFullName(
+					type,
+					builders.CsharpStoreSnapshotRestores);
+				builders.CsharpStoreSnapshotRestores.AppendLine(">.RestoreSnapshot(slot);");
 				
 				// Build function name
 				builders.TempStrBuilder.Length = 0;
@@ -1651,10 +1828,9 @@ namespace NativeScript.Editor
 				// C++ init body for handle array length
 				builders.CppInitBodyArrays.Append("\tPlugin::RefCounts");
 				builders.CppInitBodyArrays.Append(funcNameSuffix);
-				builders.CppInitBodyArrays.AppendLine(" = (int32_t*)curMemory;");
-				builders.CppInitBodyArrays.Append("\tcurMemory += ");
+				builders.CppInitBodyArrays.Append(" = Plugin::PlaceRegion<int32_t>(curMemory, ");
 				builders.CppInitBodyArrays.Append(maxSimultaneous);
-				builders.CppInitBodyArrays.AppendLine(" * sizeof(int32_t);");
+				builders.CppInitBodyArrays.AppendLine(");");
 				builders.CppInitBodyArrays.Append("\tPlugin::RefCountsLen");
 				builders.CppInitBodyArrays.Append(funcNameSuffix);
 				builders.CppInitBodyArrays.Append(" = ");
@@ -1662,6 +1838,15 @@ namespace NativeScript.Editor
 				builders.CppInitBodyArrays.AppendLine(";");
 				builders.CppInitBodyArrays.AppendLine("\t");
 				
+				// C++ usage report of the ref counts
+				builders.CppMemoryUsage.Append("\t\treport.AddRefCounts(\"RefCounts");
+				builders.CppMemoryUsage.Append(funcNameSuffix);
+				builders.CppMemoryUsage.Append("\", RefCounts");
+				builders.CppMemoryUsage.Append(funcNameSuffix);
+				builders.CppMemoryUsage.Append(", RefCountsLen");
+				builders.CppMemoryUsage.Append(funcNameSuffix);
+				builders.CppMemoryUsage.AppendLine(");");
+				
 				// C++ ref count state and functions
 				builders.CppGlobalStateAndFunctions.Append("\tint32_t RefCountsLen");
 				builders.CppGlobalStateAndFunctions.Append(funcNameSuffix);
@@ -1777,6 +1962,15 @@ namespace NativeScript.Editor
 				indent,
 				builders.CppMethodDefinitions);
 			
+			// Check for destroyed Unity objects without calling C#
+			if (type == typeof(UnityEngine.Object))
+			{
+				AppendIsAlive(
+					GetTypeName(type),
+					indent,
+					builders);
+			}
+			
 			// Constructors
 			if (typeKind == TypeKind.FullStruct)
 			{
@@ -1887,6 +2081,34 @@ namespace NativeScript.Editor
 				}
 			}
 			
+			// Pointer and length access for NativeArray<T>
+			if (type.IsGenericType
+				&& type.GetGenericTypeDefinition() == typeof(Unity.Collections.NativeArray<>))
+			{
+				AppendNativeArraySpan(
+					type,
+					typeParams,
+					indent,
+					cppMethodDefinitionsIndent,
+					builders);
+			}
+			
+			// Copy to C++ by value
+			MemberInfo[] valueMembers = null;
+			if (jsonType.ValueMembers != null)
+			{
+				valueMembers = GetValueMembers(
+					type,
+					typeKind,
+					jsonType.ValueMembers);
+				AppendValueMirrorGetValue(
+					type,
+					valueMembers,
+					indent,
+					cppMethodDefinitionsIndent,
+					builders);
+			}
+			
 			// Boxing
 			if (typeKind != TypeKind.Class)
 			{
@@ -1909,6 +2131,15 @@ namespace NativeScript.Editor
 				cppMethodDefinitionsIndent,
 				builders.CppMethodDefinitions);
 			
+			// By-value mirror of the type
+			if (valueMembers != null)
+			{
+				AppendValueMirror(
+					type,
+					valueMembers,
+					builders);
+			}
+			
 			// Generate iterator if this type implements IEnumerable<T>
 			Type[] allInterfaces = type.GetInterfaces();
 			foreach (Type interfaceType in allInterfaces)
@@ -4363,6 +4594,7 @@ namespace NativeScript.Editor
 		
 		static void AppendArray(
 			JsonArray jsonArray,
+			JsonType[] jsonTypes,
 			Assembly[] assemblies,
 			StringBuilders builders)
 		{
@@ -4371,6 +4603,10 @@ namespace NativeScript.Editor
 				jsonArray.Type,
 				assemblies);
 			TypeKind elementTypeKind = GetTypeKind(elementType);
+			MemberInfo[] elementValueMembers = FindValueMembers(
+				elementType,
+				jsonTypes,
+				assemblies);
 			
 			// Default ranks to just 1
 			int[] ranks;
@@ -4642,6 +4878,21 @@ namespace NativeScript.Editor
 					cppElementProxyTypeName,
 					builders.CppMethodDefinitions);
 				
+				// Copy elements to C++ by value
+				if (rank == 1 && elementValueMembers != null)
+				{
+					AppendArrayGetValues(
+						elementType,
+						elementValueMembers,
+						arrayType,
+						cppArrayTypeName,
+						cppGenericArrayTypeName,
+						bindingArrayTypeName,
+						indent,
+						cppMethodDefinitionsIndent,
+						builders);
+				}
+				
 				// C++ type definition (end)
 				AppendCppTypeDefinitionEnd(
 					false,
@@ -4655,8 +4906,17 @@ namespace NativeScript.Editor
 				
 				if (rank == 1)
 				{
+					AppendArrayGetItems(
+						elementType,
+						elementTypeKind,
+						arrayType,
+						cppArrayTypeName,
+						bindingArrayTypeName,
+						builders);
+					
 					AppendArrayIterator(
 						elementType,
+						elementTypeKind,
 						cppGenericArrayTypeName,
 						bindingArrayTypeName,
 						builders.CppTypeDefinitions,
@@ -4665,1214 +4925,1202 @@ namespace NativeScript.Editor
 			}
 		}
 		
-		static void AppendArrayIterator(
-			Type elementType,
-			string cppGenericArrayTypeName,
-			string bindingArrayTypeName,
-			StringBuilder cppTypeDefinitions,
-			StringBuilder cppMethodDefinitions)
+		static void AppendNativeArraySpan(
+			Type type,
+			Type[] typeParams,
+			int indent,
+			int cppMethodDefinitionsIndent,
+			StringBuilders builders)
 		{
-			// Iterator type definition
-			cppTypeDefinitions.AppendLine("namespace Plugin");
-			cppTypeDefinitions.AppendLine("{");
-			cppTypeDefinitions.Append("\tstruct ");
-			cppTypeDefinitions.Append(bindingArrayTypeName);
-			cppTypeDefinitions.AppendLine("Iterator");
-			cppTypeDefinitions.AppendLine("\t{");
-			cppTypeDefinitions.Append("\t\tSystem::");
-			cppTypeDefinitions.Append(cppGenericArrayTypeName);
-			cppTypeDefinitions.AppendLine("& array;");
-			cppTypeDefinitions.AppendLine("\t\tint index;");
-			cppTypeDefinitions.Append("\t\t");
-			cppTypeDefinitions.Append(bindingArrayTypeName);
-			cppTypeDefinitions.Append("Iterator(System::");
-			cppTypeDefinitions.Append(cppGenericArrayTypeName);
-			cppTypeDefinitions.AppendLine("& array, int32_t index);");
-			cppTypeDefinitions.Append("\t\t");
-			cppTypeDefinitions.Append(bindingArrayTypeName);
-			cppTypeDefinitions.AppendLine("Iterator& operator++();");
-			cppTypeDefinitions.Append("\t\tbool operator!=(const ");
-			cppTypeDefinitions.Append(bindingArrayTypeName);
-			cppTypeDefinitions.AppendLine("Iterator& other);");
-			cppTypeDefinitions.Append("\t\t");
-			AppendCppTypeFullName(
+			// C++'s System::Boolean is four bytes but NativeArray<bool>
+			// elements are one byte, so the memory can't be shared
+			Type elementType = typeParams[0];
+			if (elementType == typeof(bool))
+			{
+				return;
+			}
+			
+			// Only types with the same layout in C# and C++ can be shared.
+			// Managed structs are represented in C++ by a handle.
+			if (!IsFullValueType(elementType))
+			{
+				return;
+			}
+			
+			builders.TempStrBuilder.Length = 0;
+			AppendReleaseFunctionNameSuffix(
+				GetTypeName(type),
+				typeParams,
+				builders.TempStrBuilder);
+			string funcNameSuffix = builders.TempStrBuilder.ToString();
+			string getSpanFuncName = funcNameSuffix + "GetSpan";
+			string fromNativeFuncName = funcNameSuffix + "FromNative";
+			
+			builders.TempStrBuilder.Length = 0;
+			AppendCsharpTypeFullName(
+				type,
+				builders.TempStrBuilder);
+			string csharpTypeName = builders.TempStrBuilder.ToString();
+			
+			builders.TempStrBuilder.Length = 0;
+			AppendCsharpTypeFullName(
 				elementType,
-				cppTypeDefinitions);
-			cppTypeDefinitions.AppendLine(" operator*();");
-			cppTypeDefinitions.AppendLine("\t};");
-			cppTypeDefinitions.AppendLine("}");
-			cppTypeDefinitions.AppendLine();;
+				builders.TempStrBuilder);
+			string csharpElementTypeName = builders.TempStrBuilder.ToString();
 			
-			// begin() and end() declarations
-			cppTypeDefinitions.AppendLine("namespace System");
-			cppTypeDefinitions.AppendLine("{");
-			cppTypeDefinitions.Append("\tPlugin::");
-			cppTypeDefinitions.Append(bindingArrayTypeName);
-			cppTypeDefinitions.Append("Iterator begin(System::");
-			cppTypeDefinitions.Append(cppGenericArrayTypeName);
-			cppTypeDefinitions.AppendLine("& array);");
-			cppTypeDefinitions.Append("\tPlugin::");
-			cppTypeDefinitions.Append(bindingArrayTypeName);
-			cppTypeDefinitions.Append("Iterator end(System::");
-			cppTypeDefinitions.Append(cppGenericArrayTypeName);
-			cppTypeDefinitions.AppendLine("& array);");
-			cppTypeDefinitions.AppendLine("}");
-			cppTypeDefinitions.AppendLine();;
+			builders.TempStrBuilder.Length = 0;
+			AppendCppTypeFullName(
+				type,
+				builders.TempStrBuilder);
+			string cppTypeName = builders.TempStrBuilder.ToString();
 			
-			// Iterator method definitions
-			cppMethodDefinitions.AppendLine("namespace Plugin");
-			cppMethodDefinitions.AppendLine("{");
-			cppMethodDefinitions.Append('\t');
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator(System::");
-			cppMethodDefinitions.Append(cppGenericArrayTypeName);
-			cppMethodDefinitions.AppendLine("& array, int32_t index)");
-			cppMethodDefinitions.AppendLine("\t\t: array(array)");
-			cppMethodDefinitions.AppendLine("\t\t, index(index)");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append('\t');
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator& ");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.AppendLine("operator++()");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\tindex++;");
-			cppMethodDefinitions.AppendLine("\t\treturn *this;");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append("\tbool ");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.Append("operator!=(const ");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.AppendLine("Iterator& other)");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\treturn index != other.index;");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append('\t');
+			builders.TempStrBuilder.Length = 0;
 			AppendCppTypeFullName(
 				elementType,
-				cppMethodDefinitions);
-			cppMethodDefinitions.Append(' ');
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.AppendLine("operator*()");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\treturn array[index];");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("}");
-			cppMethodDefinitions.AppendLine();;
+				builders.TempStrBuilder);
+			string cppElementTypeName = builders.TempStrBuilder.ToString();
 			
-			// begin() and end() definitions
-			cppMethodDefinitions.AppendLine("namespace System");
-			cppMethodDefinitions.AppendLine("{");
-			cppMethodDefinitions.Append("\tPlugin::");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator begin(System::");
-			cppMethodDefinitions.Append(cppGenericArrayTypeName);
-			cppMethodDefinitions.AppendLine("& array)");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.Append("\t\treturn Plugin::");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.AppendLine("Iterator(array, 0);");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append("\tPlugin::");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.Append("Iterator end(System::");
-			cppMethodDefinitions.Append(cppGenericArrayTypeName);
-			cppMethodDefinitions.AppendLine("& array)");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.Append("\t\treturn Plugin::");
-			cppMethodDefinitions.Append(bindingArrayTypeName);
-			cppMethodDefinitions.AppendLine("Iterator(array, array.GetLength() - 1);");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("}");
-			cppMethodDefinitions.AppendLine();;
-		}
-		
-		static void AppendGenericEnumerableIterator(
-			Type enumerableType,
-			Type enumeratorType,
-			Type elementType,
-			string bindingEnumerableTypeName,
-			StringBuilder cppTypeDefinitions,
-			StringBuilder cppMethodDefinitions)
-		{
-			// Iterator type definition
-			cppTypeDefinitions.AppendLine("namespace Plugin");
-			cppTypeDefinitions.AppendLine("{");
-			cppTypeDefinitions.Append("\tstruct ");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.AppendLine("Iterator");
-			cppTypeDefinitions.AppendLine("\t{");
-			cppTypeDefinitions.Append("\t\t");
-			AppendCppTypeFullName(
-				enumeratorType,
-				cppTypeDefinitions);
-			cppTypeDefinitions.AppendLine(" enumerator;");
-			cppTypeDefinitions.AppendLine("\t\tbool hasMore;");
-			cppTypeDefinitions.Append("\t\t");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.AppendLine("Iterator(decltype(nullptr));");
-			cppTypeDefinitions.Append("\t\t");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.Append("Iterator(");
-			AppendCppTypeFullName(
-				enumerableType,
-				cppTypeDefinitions);
-			cppTypeDefinitions.AppendLine("& enumerable);");
-			cppTypeDefinitions.Append("\t\t~");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.AppendLine("Iterator();");
-			cppTypeDefinitions.Append("\t\t");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.AppendLine("Iterator& operator++();");
-			cppTypeDefinitions.Append("\t\tbool operator!=(const ");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.AppendLine("Iterator& other);");
-			cppTypeDefinitions.Append("\t\t");
-			AppendCppTypeFullName(
-				elementType,
-				cppTypeDefinitions);
-			cppTypeDefinitions.AppendLine(" operator*();");
-			cppTypeDefinitions.AppendLine("\t};");
-			cppTypeDefinitions.AppendLine("}");
-			cppTypeDefinitions.AppendLine();;
+			// C# delegate types
+			builders.CsharpDelegateTypes.AppendLine(
+				"\t\t[UnmanagedFunctionPointer(CallingConvention.Cdecl)]");
+			builders.CsharpDelegateTypes.Append("\t\tdelegate System.IntPtr ");
+			builders.CsharpDelegateTypes.Append(getSpanFuncName);
+			builders.CsharpDelegateTypes.AppendLine(
+				"DelegateType(int thisHandle, ref int length);");
+			builders.CsharpDelegateTypes.AppendLine(
+				"\t\t[UnmanagedFunctionPointer(CallingConvention.Cdecl)]");
+			builders.CsharpDelegateTypes.Append("\t\tdelegate int ");
+			builders.CsharpDelegateTypes.Append(fromNativeFuncName);
+			builders.CsharpDelegateTypes.AppendLine(
+				"DelegateType(System.IntPtr data, int length);");
+			
+			// C# delegates and init calls
+			AppendCsharpCsharpDelegate(
+				getSpanFuncName,
+				builders.CsharpInitCall,
+				builders.CsharpCsharpDelegates);
+			AppendCsharpCsharpDelegate(
+				fromNativeFuncName,
+				builders.CsharpInitCall,
+				builders.CsharpCsharpDelegates);
 			
-			// begin() and end() declarations
-			int indent = AppendNamespaceBeginning(
-				enumerableType.Namespace,
-				cppTypeDefinitions);
-			AppendIndent(
-				indent,
-				cppTypeDefinitions);
-			cppTypeDefinitions.Append("Plugin::");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.Append("Iterator begin(");
-			AppendCppTypeFullName(
-				enumerableType,
-				cppTypeDefinitions);
-			cppTypeDefinitions.AppendLine("& enumerable);");
-			AppendIndent(
-				indent,
-				cppTypeDefinitions);
-			cppTypeDefinitions.Append("Plugin::");
-			cppTypeDefinitions.Append(bindingEnumerableTypeName);
-			cppTypeDefinitions.Append("Iterator end(");
-			AppendCppTypeFullName(
-				enumerableType,
-				cppTypeDefinitions);
-			cppTypeDefinitions.AppendLine("& enumerable);");
-			AppendNamespaceEnding(
-				indent,
-				cppTypeDefinitions);
-			cppTypeDefinitions.AppendLine();;
+			// C# function to get a pointer to the array's elements
+			StringBuilder output = builders.CsharpFunctions;
+			output.Append("\t\t[MonoPInvokeCallback(typeof(");
+			output.Append(getSpanFuncName);
+			output.AppendLine("DelegateType))]");
+			output.Append("\t\tstatic unsafe System.IntPtr ");
+			output.Append(getSpanFuncName);
+			output.AppendLine("(int thisHandle, ref int length)");
+			output.AppendLine("\t\t{");
+			output.AppendLine("\t\t\ttry");
+			output.AppendLine("\t\t\t{");
+			output.Append("\t\t\t\tvar thiz = (");
+			output.Append(csharpTypeName);
+			output.Append(')');
+			AppendHandleStoreTypeName(
+				type,
+				output);
+			output.AppendLine(".Get(thisHandle);");
+			output.AppendLine("\t\t\t\tlength = thiz.Length;");
+			output.AppendLine("\t\t\t\treturn (System.IntPtr)Unity.Collections.LowLevel.Unsafe.NativeArrayUnsafeUtility.GetUnsafeBufferPointerWithoutChecks(thiz);");
+			output.AppendLine("\t\t\t}");
+			output.AppendLine("\t\t\tcatch (System.Exception ex)");
+			output.AppendLine("\t\t\t{");
+			output.AppendLine("\t\t\t\tNativeScript.Bindings.UnhandledCsharpException = ex;");
+			output.AppendLine("\t\t\t\tNativeScript.Bindings.SetCsharpException();");
+			output.AppendLine("\t\t\t\tlength = default(int);");
+			output.AppendLine("\t\t\t\treturn default(System.IntPtr);");
+			output.AppendLine("\t\t\t}");
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t\t");
 			
-			// Iterator method definitions
-			cppMethodDefinitions.AppendLine("namespace Plugin");
-			cppMethodDefinitions.AppendLine("{");
-			cppMethodDefinitions.Append('\t');
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.AppendLine("Iterator(decltype(nullptr))");
-			cppMethodDefinitions.AppendLine("\t\t: enumerator(nullptr)");
-			cppMethodDefinitions.AppendLine("\t\t, hasMore(false)");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append('\t');
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator(");
-			AppendCppTypeFullName(
-				enumerableType,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine("& enumerable)");
-			cppMethodDefinitions.AppendLine("\t\t: enumerator(enumerable.GetEnumerator())");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\thasMore = enumerator.MoveNext();");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append('\t');
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator::~");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.AppendLine("Iterator()");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\tif (enumerator != nullptr)");
-			cppMethodDefinitions.AppendLine("\t\t{");
-			cppMethodDefinitions.AppendLine("\t\t\tenumerator.Dispose();");
-			cppMethodDefinitions.AppendLine("\t\t}");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append('\t');
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator& ");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.AppendLine("operator++()");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\thasMore = enumerator.MoveNext();");
-			cppMethodDefinitions.AppendLine("\t\treturn *this;");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append("\tbool ");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.Append("operator!=(const ");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.AppendLine("Iterator& other)");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\treturn hasMore;");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("\t");
-			cppMethodDefinitions.Append('\t');
-			AppendCppTypeFullName(
-				elementType,
-				cppMethodDefinitions);
-			cppMethodDefinitions.Append(' ');
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator::");
-			cppMethodDefinitions.AppendLine("operator*()");
-			cppMethodDefinitions.AppendLine("\t{");
-			cppMethodDefinitions.AppendLine("\t\treturn enumerator.GetCurrent();");
-			cppMethodDefinitions.AppendLine("\t}");
-			cppMethodDefinitions.AppendLine("}");
-			cppMethodDefinitions.AppendLine();;
+			// C# function to wrap native memory in an array. The memory is
+			// owned by C++ so the array uses no allocator.
+			output.Append("\t\t[MonoPInvokeCallback(typeof(");
+			output.Append(fromNativeFuncName);
+			output.AppendLine("DelegateType))]");
+			output.Append("\t\tstatic unsafe int ");
+			output.Append(fromNativeFuncName);
+			output.AppendLine("(System.IntPtr data, int length)");
+			output.AppendLine("\t\t{");
+			output.AppendLine("\t\t\ttry");
+			output.AppendLine("\t\t\t{");
+			output.Append("\t\t\t\tvar array = Unity.Collections.LowLevel.Unsafe.NativeArrayUnsafeUtility.ConvertExistingDataToNativeArray<");
+			output.Append(csharpElementTypeName);
+			output.AppendLine(">((void*)data, length, Unity.Collections.Allocator.None);");
+			output.AppendLine("#if ENABLE_UNITY_COLLECTIONS_CHECKS");
+			output.AppendLine("\t\t\t\tUnity.Collections.LowLevel.Unsafe.NativeArrayUnsafeUtility.SetAtomicSafetyHandle(ref array, Unity.Collections.LowLevel.Unsafe.AtomicSafetyHandle.GetTempUnsafePtrSliceHandle());");
+			output.AppendLine("#endif");
+			output.Append("\t\t\t\treturn ");
+			AppendHandleStoreTypeName(
+				type,
+				output);
+			output.AppendLine(".Store(array);");
+			output.AppendLine("\t\t\t}");
+			output.AppendLine("\t\t\tcatch (System.Exception ex)");
+			output.AppendLine("\t\t\t{");
+			output.AppendLine("\t\t\t\tNativeScript.Bindings.UnhandledCsharpException = ex;");
+			output.AppendLine("\t\t\t\tNativeScript.Bindings.SetCsharpException();");
+			output.AppendLine("\t\t\t\treturn default(int);");
+			output.AppendLine("\t\t\t}");
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t\t");
 			
-			// begin() and end() definitions
-			indent = AppendNamespaceBeginning(
-				enumerableType.Namespace,
-				cppMethodDefinitions);
-			AppendIndent(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.Append("Plugin::");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator begin(");
-			AppendCppTypeFullName(
-				enumerableType,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine("& enumerable)");
+			// C++ function pointers
+			builders.CppFunctionPointers.Append("\tvoid* (*");
+			builders.CppFunctionPointers.Append(getSpanFuncName);
+			builders.CppFunctionPointers.AppendLine(
+				")(int32_t thisHandle, int32_t* length);");
+			builders.CppFunctionPointers.Append("\tint32_t (*");
+			builders.CppFunctionPointers.Append(fromNativeFuncName);
+			builders.CppFunctionPointers.AppendLine(
+				")(void* data, int32_t length);");
+			
+			// C++ init body
+			builders.CppInitBodyParameterReads.Append("\tPlugin::");
+			builders.CppInitBodyParameterReads.Append(getSpanFuncName);
+			builders.CppInitBodyParameterReads.AppendLine(
+				" = *(void* (**)(int32_t thisHandle, int32_t* length))curMemory;");
+			builders.CppInitBodyParameterReads.Append(
+				"\tcurMemory += sizeof(Plugin::");
+			builders.CppInitBodyParameterReads.Append(getSpanFuncName);
+			builders.CppInitBodyParameterReads.AppendLine(");");
+			builders.CppInitBodyParameterReads.Append("\tPlugin::");
+			builders.CppInitBodyParameterReads.Append(fromNativeFuncName);
+			builders.CppInitBodyParameterReads.AppendLine(
+				" = *(int32_t (**)(void* data, int32_t length))curMemory;");
+			builders.CppInitBodyParameterReads.Append(
+				"\tcurMemory += sizeof(Plugin::");
+			builders.CppInitBodyParameterReads.Append(fromNativeFuncName);
+			builders.CppInitBodyParameterReads.AppendLine(");");
+			
+			// C++ method declarations
 			AppendIndent(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine("{");
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append("Plugin::NativeArraySpan<");
+			builders.CppTypeDefinitions.Append(cppElementTypeName);
+			builders.CppTypeDefinitions.AppendLine("> GetSpan();");
 			AppendIndent(
 				indent + 1,
-				cppMethodDefinitions);
-			cppMethodDefinitions.Append("return Plugin::");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.AppendLine("Iterator(enumerable);");
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append("static ");
+			builders.CppTypeDefinitions.Append(cppTypeName);
+			builders.CppTypeDefinitions.Append(" FromNative(");
+			builders.CppTypeDefinitions.Append(cppElementTypeName);
+			builders.CppTypeDefinitions.AppendLine("* data, int32_t length);");
+			
+			// C++ GetSpan definition
+			output = builders.CppMethodDefinitions;
+			int bodyIndent = cppMethodDefinitionsIndent + 1;
 			AppendIndent(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine("}");
+				cppMethodDefinitionsIndent,
+				output);
+			output.Append("Plugin::NativeArraySpan<");
+			output.Append(cppElementTypeName);
+			output.Append("> ");
+			output.Append(cppTypeName);
+			output.AppendLine("::GetSpan()");
 			AppendIndent(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine();;
+				cppMethodDefinitionsIndent,
+				output);
+			output.AppendLine("{");
 			AppendIndent(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.Append("Plugin::");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.Append("Iterator end(");
-			AppendCppTypeFullName(
-				enumerableType,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine("& enumerable)");
+				bodyIndent,
+				output);
+			output.Append("Plugin::NativeArraySpan<");
+			output.Append(cppElementTypeName);
+			output.AppendLine("> span;");
 			AppendIndent(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine("{");
+				bodyIndent,
+				output);
+			output.Append("span.Data = (");
+			output.Append(cppElementTypeName);
+			output.Append("*)Plugin::");
+			output.Append(getSpanFuncName);
+			output.AppendLine("(Handle, &span.Length);");
+			AppendCppUnhandledExceptionHandling(
+				bodyIndent,
+				output);
 			AppendIndent(
-				indent + 1,
-				cppMethodDefinitions);
-			cppMethodDefinitions.Append("return Plugin::");
-			cppMethodDefinitions.Append(bindingEnumerableTypeName);
-			cppMethodDefinitions.AppendLine("Iterator(nullptr);");
+				bodyIndent,
+				output);
+			output.AppendLine("return span;");
 			AppendIndent(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine("}");
-			AppendNamespaceEnding(
-				indent,
-				cppMethodDefinitions);
-			cppMethodDefinitions.AppendLine();;
-		}
-		
-		static void AppendCppArrayIndexOperatorMethodDefinition(
-			int rank,
-			int indent,
-			TypeName enclosingTypeTypeName,
-			string nextCppElementProxyTypeName,
-			StringBuilder output)
-		{
+				cppMethodDefinitionsIndent,
+				output);
+			output.AppendLine("}");
 			AppendIndent(
-				indent,
+				cppMethodDefinitionsIndent,
 				output);
-			AppendCppTypeFullName(
-				GetTypeName(nextCppElementProxyTypeName, "Plugin"),
+			output.AppendLine();
+			
+			// C++ FromNative definition
+			AppendIndent(
+				cppMethodDefinitionsIndent,
 				output);
+			output.Append(cppTypeName);
 			output.Append(' ');
-			output.Append(enclosingTypeTypeName.Namespace);
-			output.Append("::");
-			AppendTypeNameWithoutGenericSuffix(
-				enclosingTypeTypeName.Name,
-				output);
-			output.AppendLine("::operator[](int32_t index)");
+			output.Append(cppTypeName);
+			output.Append("::FromNative(");
+			output.Append(cppElementTypeName);
+			output.AppendLine("* data, int32_t length)");
 			AppendIndent(
-				indent,
+				cppMethodDefinitionsIndent,
 				output);
 			output.AppendLine("{");
 			AppendIndent(
-				indent + 1,
+				bodyIndent,
+				output);
+			output.Append("auto returnValue = Plugin::");
+			output.Append(fromNativeFuncName);
+			output.AppendLine("(data, length);");
+			AppendCppUnhandledExceptionHandling(
+				bodyIndent,
 				output);
-			output.Append("return Plugin::");
-			output.Append(nextCppElementProxyTypeName);
-			output.Append("(Plugin::InternalUse::Only, Handle, ");
-			for (int i = 0; i < rank; ++i)
-			{
-				output.Append("Index");
-				output.Append(i);
-				output.Append(", ");
-			}
-			output.AppendLine("index);");
 			AppendIndent(
-				indent,
+				bodyIndent,
+				output);
+			output.Append("return ");
+			output.Append(cppTypeName);
+			output.AppendLine("(Plugin::InternalUse::Only, returnValue);");
+			AppendIndent(
+				cppMethodDefinitionsIndent,
 				output);
 			output.AppendLine("}");
 			AppendIndent(
-				indent,
+				cppMethodDefinitionsIndent,
 				output);
-			output.AppendLine();;
+			output.AppendLine();
 		}
 		
-		static void AppendCppArrayTypeName(
-			int rank,
-			StringBuilder output)
+		// Get the fields and properties to copy into the by-value mirror of
+		// a managed struct
+		static MemberInfo[] GetValueMembers(
+			Type type,
+			TypeKind typeKind,
+			string[] memberNames)
 		{
-			output.Append("Array");
-			output.Append(rank);
+			if (typeKind != TypeKind.ManagedStruct || type.IsGenericType)
+			{
+				throw new Exception(
+					"ValueMembers is only supported by non-generic " +
+					"managed structs but was set for " + type.FullName);
+			}
+			
+			MemberInfo[] members = new MemberInfo[memberNames.Length];
+			for (int i = 0; i < memberNames.Length; ++i)
+			{
+				string memberName = memberNames[i];
+				MemberInfo member = type.GetField(
+					memberName,
+					BindingFlags.Instance | BindingFlags.Public);
+				if (member == null)
+				{
+					PropertyInfo property = type.GetProperty(
+						memberName,
+						BindingFlags.Instance | BindingFlags.Public);
+					if (property != null
+						&& property.GetGetMethod() != null
+						&& property.GetIndexParameters().Length == 0)
+					{
+						member = property;
+					}
+				}
+				if (member == null)
+				{
+					throw new Exception(
+						"Couldn't find public instance field or readable " +
+						"property \"" + memberName + "\" of " +
+						type.FullName);
+				}
+				
+				// Only types with the same layout in C# and C++ can be
+				// copied. Class references are copied as handles.
+				Type memberType = GetValueMemberType(member);
+				TypeKind memberTypeKind = GetTypeKind(memberType);
+				if ((memberTypeKind != TypeKind.Primitive
+					&& memberTypeKind != TypeKind.Enum
+					&& memberTypeKind != TypeKind.FullStruct
+					&& memberTypeKind != TypeKind.Class)
+					|| (memberTypeKind == TypeKind.FullStruct
+						&& HasBoolField(memberType)))
+				{
+					throw new Exception(
+						"Type of " + type.FullName + "." + memberName +
+						" can't be copied by value");
+				}
+				members[i] = member;
+			}
+			return members;
 		}
 		
-		static void AppendCppArrayElementProxyName(
-			int rank,
-			int maxRank,
-			Type elementType,
-			StringBuilder output)
+		static Type GetValueMemberType(MemberInfo member)
 		{
-			output.Append("ArrayElementProxy");
-			output.Append(rank);
-			output.Append('_');
-			output.Append(maxRank);
-			output.Append('<');
-			AppendCppTypeFullName(
-				elementType,
-				output);
-			output.Append('>');
+			FieldInfo field = member as FieldInfo;
+			return field != null
+				? field.FieldType
+				: ((PropertyInfo)member).PropertyType;
 		}
-
-		static ParameterInfo[] BuildArrayGetItemsParams(
-			int rank,
-			string indexName)
+		
+		// Bools are one byte in C# structs but four in C++ structs
+		static bool HasBoolField(Type type)
 		{
-			ParameterInfo[] parameters = new ParameterInfo[rank];
-			for (int i = 0; i < rank; ++i)
+			foreach (FieldInfo field in type.GetFields(
+				BindingFlags.Instance
+				| BindingFlags.Public
+				| BindingFlags.NonPublic))
 			{
-				ParameterInfo param = new ParameterInfo();
-				param.Name = indexName + i;
-				param.ParameterType = typeof(int);
-				param.IsOut = false;
-				param.IsRef = false;
-				param.DereferencedParameterType = param.ParameterType;
-				param.Kind = GetTypeKind(
-					param.DereferencedParameterType);
-				parameters[i] = param;
+				if (field.FieldType == typeof(bool)
+					|| (!field.FieldType.IsPrimitive
+						&& !field.FieldType.IsEnum
+						&& HasBoolField(field.FieldType)))
+				{
+					return true;
+				}
 			}
-			return parameters;
+			return false;
 		}
 		
-		static ParameterInfo[] BuildArraySetItemsParams(
-			int rank,
-			string indexName,
-			Type elementType)
+		// Find the by-value mirror members of a type listed in the JSON
+		static MemberInfo[] FindValueMembers(
+			Type type,
+			JsonType[] jsonTypes,
+			Assembly[] assemblies)
 		{
-			ParameterInfo[] parameters = new ParameterInfo[rank+1];
-			for (int i = 0; i < rank; ++i)
+			if (jsonTypes == null)
 			{
-				ParameterInfo param = new ParameterInfo();
-				param.Name = indexName + i;
-				param.ParameterType = typeof(int);
-				param.IsOut = false;
-				param.IsRef = false;
-				param.DereferencedParameterType = param.ParameterType;
-				param.Kind = GetTypeKind(
-					param.DereferencedParameterType);
-				parameters[i] = param;
+				return null;
 			}
-			
-			ParameterInfo lastParamInfo = new ParameterInfo();
-			lastParamInfo.Name = "item";
-			lastParamInfo.ParameterType = elementType;
-			lastParamInfo.IsOut = false;
-			lastParamInfo.IsRef = false;
-			lastParamInfo.DereferencedParameterType = lastParamInfo.ParameterType;
-			lastParamInfo.Kind = GetTypeKind(
-				lastParamInfo.DereferencedParameterType);
-			parameters[rank] = lastParamInfo;
-			
-			return parameters;
+			foreach (JsonType jsonType in jsonTypes)
+			{
+				if (jsonType.ValueMembers != null
+					&& GetType(jsonType.Name, assemblies) == type)
+				{
+					return GetValueMembers(
+						type,
+						GetTypeKind(type),
+						jsonType.ValueMembers);
+				}
+			}
+			return null;
 		}
 		
-		static void AppendArrayGetItemFuncName(
-			TypeName elementTypeTypeName,
-			string bindingArrayTypeName,
-			int rank,
-			StringBuilder output)
+		static bool HasHandleValueMember(MemberInfo[] members)
 		{
-			AppendNamespace(
-				elementTypeTypeName.Namespace,
-				string.Empty,
-				output);
-			output.Append(elementTypeTypeName.Name);
-			AppendTypeNameWithoutGenericSuffix(
-				bindingArrayTypeName,
-				output);
-			output.Append("GetItem");
-			output.Append(rank);
+			foreach (MemberInfo member in members)
+			{
+				if (GetTypeKind(GetValueMemberType(member)) == TypeKind.Class)
+				{
+					return true;
+				}
+			}
+			return false;
 		}
 		
-		static void AppendArraySetItemFuncName(
-			TypeName elementTypeTypeName,
-			string bindingArrayTypeName,
-			int rank,
+		static void AppendValueMirrorFieldName(
+			MemberInfo member,
 			StringBuilder output)
 		{
-			AppendNamespace(
-				elementTypeTypeName.Namespace,
-				string.Empty,
-				output);
-			output.Append(elementTypeTypeName.Name);
-			AppendTypeNameWithoutGenericSuffix(
-				bindingArrayTypeName,
-				output);
-			output.Append("SetItem");
-			output.Append(rank);
+			output.Append(member.Name);
+			if (GetTypeKind(GetValueMemberType(member)) == TypeKind.Class)
+			{
+				output.Append("Handle");
+			}
 		}
 		
-		static void AppendArrayElementProxy(
-			Type elementType,
-			TypeKind elementTypeKind,
-			int rank,
-			int maxRank,
-			Type[] cppTypeParams,
-			string cppArrayTypeName,
+		// Mirror of a managed struct that can be copied to C++ by value.
+		// Bools are four bytes to match System::Boolean and class fields are
+		// handles to the objects.
+		static void AppendValueMirror(
+			Type type,
+			MemberInfo[] members,
 			StringBuilders builders)
 		{
-			// Build element proxy name
-			builders.TempStrBuilder.Length = 0;
-			AppendCppArrayElementProxyName(
-				rank,
-				maxRank,
-				elementType,
-				builders.TempStrBuilder);
-			string cppElementProxyTypeName = builders.TempStrBuilder.ToString();
-			
-			// Build next element proxy name
-			builders.TempStrBuilder.Length = 0;
-			AppendCppArrayElementProxyName(
-				rank + 1,
-				maxRank,
-				elementType,
-				builders.TempStrBuilder);
-			string nextCppElementProxyTypeName = builders.TempStrBuilder.ToString();
-			
-			// GetItem name
 			builders.TempStrBuilder.Length = 0;
-			AppendArrayGetItemFuncName(
-				GetTypeName(elementType),
-				cppArrayTypeName,
-				rank,
+			AppendReleaseFunctionNameSuffix(
+				GetTypeName(type),
+				null,
 				builders.TempStrBuilder);
-			string getItemFuncName = builders.TempStrBuilder.ToString();
+			string csharpMirrorName = builders.TempStrBuilder.ToString()
+				+ "Value";
+			string mirrorName = type.Name + "Value";
+			TypeName mirrorTypeName = GetTypeName(
+				mirrorName,
+				type.Namespace);
+			bool hasHandles = HasHandleValueMember(members);
+			
+			// C# mirror
+			StringBuilder output = builders.CsharpFunctions;
+			output.AppendLine("\t\t[StructLayout(LayoutKind.Sequential)]");
+			output.Append("\t\tstruct ");
+			output.AppendLine(csharpMirrorName);
+			output.AppendLine("\t\t{");
+			foreach (MemberInfo member in members)
+			{
+				Type memberType = GetValueMemberType(member);
+				output.Append("\t\t\tpublic ");
+				if (memberType == typeof(bool)
+					|| GetTypeKind(memberType) == TypeKind.Class)
+				{
+					output.Append("int");
+				}
+				else
+				{
+					AppendCsharpTypeFullName(
+						memberType,
+						output);
+				}
+				output.Append(' ');
+				AppendValueMirrorFieldName(
+					member,
+					output);
+				output.AppendLine(";");
+			}
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t\t");
 			
-			// SetItem name
-			builders.TempStrBuilder.Length = 0;
-			AppendArraySetItemFuncName(
-				GetTypeName(elementType),
-				cppArrayTypeName,
-				rank,
-				builders.TempStrBuilder);
-			string setItemFuncName = builders.TempStrBuilder.ToString();
+			// C++ type declaration
+			int indent = AppendCppTypeDeclaration(
+				mirrorTypeName,
+				false,
+				null,
+				builders.CppTypeDeclarations);
 			
-			// GetItem call params
-			ParameterInfo[] getItemCallParams = BuildArrayGetItemsParams(
-				rank,
-				"Index");
-			
-			// SetItem params
-			ParameterInfo[] setItemCallParams = BuildArraySetItemsParams(
-				rank,
-				"Index",
-				elementType);
-			
-			// C++ element proxy type declaration
-			int indent = AppendNamespaceBeginning(
-				"Plugin",
-				builders.CppTemplateSpecializationDeclarations);
-			AppendIndent(indent, builders.CppTemplateSpecializationDeclarations);
-			builders.CppTemplateSpecializationDeclarations.Append("template<> struct ");
-			AppendTypeNameWithoutGenericSuffix(
-				cppElementProxyTypeName,
-				builders.CppTemplateSpecializationDeclarations);
-			builders.CppTemplateSpecializationDeclarations.AppendLine(";");
-			AppendNamespaceEnding(
-				indent,
-				builders.CppTemplateSpecializationDeclarations);
-			builders.CppTemplateSpecializationDeclarations.AppendLine();;
-			
-			// C++ element proxy type definition
-			AppendNamespaceBeginning(
-				"Plugin",
-				builders.CppTypeDefinitions);
-			AppendIndent(
-				indent,
-				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.Append("template<> struct ");
-			builders.CppTypeDefinitions.Append(cppElementProxyTypeName);
-			builders.CppTypeDefinitions.AppendLine();;
-			AppendIndent(
+			// C++ type definition
+			output = builders.CppTypeDefinitions;
+			AppendCppTypeDefinitionBegin(
+				mirrorTypeName,
+				TypeKind.FullStruct,
+				null,
+				default(TypeName),
+				null,
+				null,
+				false,
 				indent,
-				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.AppendLine("{");
-			AppendIndent(
-				indent + 1,
-				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.AppendLine("int32_t Handle;");
-			for (int i = 0; i < rank; ++i)
+				output);
+			foreach (MemberInfo member in members)
 			{
+				Type memberType = GetValueMemberType(member);
 				AppendIndent(
 					indent + 1,
-					builders.CppTypeDefinitions);
-				builders.CppTypeDefinitions.Append("int32_t Index");
-				builders.CppTypeDefinitions.Append(i);
-				builders.CppTypeDefinitions.AppendLine(";");
-			}
-			AppendIndent(
-				indent + 1,
-				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.Append(cppElementProxyTypeName);
-			builders.CppTypeDefinitions.Append(
-				"(Plugin::InternalUse, int32_t handle, ");
-			for (int i = 0; i < rank; ++i)
-			{
-				builders.CppTypeDefinitions.Append("int32_t index");
-				builders.CppTypeDefinitions.Append(i);
-				if (i != rank - 1)
+					output);
+				if (GetTypeKind(memberType) == TypeKind.Class)
 				{
-					builders.CppTypeDefinitions.Append(", ");
+					output.Append("int32_t");
+				}
+				else
+				{
+					AppendCppTypeFullName(
+						memberType,
+						output);
 				}
+				output.Append(' ');
+				AppendValueMirrorFieldName(
+					member,
+					output);
+				output.AppendLine(";");
 			}
-			builders.CppTypeDefinitions.AppendLine(");");
-			if (rank == maxRank)
+			
+			// Without handles the mirror is plain old data
+			if (!hasHandles)
 			{
-				AppendIndent(
-					indent + 1,
-					builders.CppTypeDefinitions);
-				builders.CppTypeDefinitions.Append("void operator=(");
-				AppendCppTypeFullName(
-					elementType,
-					builders.CppTypeDefinitions);
-				builders.CppTypeDefinitions.AppendLine(" item);");
-				AppendIndent(
-					indent + 1,
-					builders.CppTypeDefinitions);
-				builders.CppTypeDefinitions.Append("operator ");
-				AppendCppTypeFullName(
-					elementType,
-					builders.CppTypeDefinitions);
-				builders.CppTypeDefinitions.AppendLine("();");
+				AppendCppTypeDefinitionEnd(
+					false,
+					indent,
+					output);
+				return;
 			}
-			else
-			{
-				AppendIndent(
-					indent + 1,
-					builders.CppTypeDefinitions);
-				builders.CppTypeDefinitions.Append("Plugin::");
-				AppendCppArrayElementProxyName(
-					rank + 1,
-					maxRank,
-					elementType,
-					builders.CppTypeDefinitions);
-				builders.CppTypeDefinitions.Append(" operator[](");
-				builders.CppTypeDefinitions.AppendLine("int32_t index);");
+			
+			AppendIndent(indent + 1, output);
+			output.Append(mirrorName);
+			output.AppendLine("();");
+			AppendIndent(indent + 1, output);
+			output.Append(mirrorName);
+			output.Append("(const ");
+			output.Append(mirrorName);
+			output.AppendLine("& other);");
+			AppendIndent(indent + 1, output);
+			output.Append(mirrorName);
+			output.Append('(');
+			output.Append(mirrorName);
+			output.AppendLine("&& other);");
+			AppendIndent(indent + 1, output);
+			output.Append('~');
+			output.Append(mirrorName);
+			output.AppendLine("();");
+			AppendIndent(indent + 1, output);
+			output.Append(mirrorName);
+			output.Append("& operator=(const ");
+			output.Append(mirrorName);
+			output.AppendLine("& other);");
+			AppendIndent(indent + 1, output);
+			output.Append(mirrorName);
+			output.Append("& operator=(");
+			output.Append(mirrorName);
+			output.AppendLine("&& other);");
+			foreach (MemberInfo member in members)
+			{
+				Type memberType = GetValueMemberType(member);
+				if (GetTypeKind(memberType) == TypeKind.Class)
+				{
+					AppendIndent(indent + 1, output);
+					AppendCppTypeFullName(
+						memberType,
+						output);
+					output.Append(" Get");
+					output.Append(char.ToUpper(member.Name[0]));
+					output.Append(member.Name, 1, member.Name.Length - 1);
+					output.AppendLine("() const;");
+				}
 			}
-			AppendIndent(
+			AppendCppTypeDefinitionEnd(
+				false,
 				indent,
-				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.AppendLine("};");
-			builders.CppTypeDefinitions.AppendLine("}");
-			builders.CppTypeDefinitions.AppendLine();;
+				output);
 			
-			// C++ element proxy method definitions (beginning)
-			int cppMethodDefinitionsIndent = AppendNamespaceBeginning(
-				"Plugin",
-				builders.CppMethodDefinitions);
+			// C++ method definitions
+			output = builders.CppMethodDefinitions;
+			int bodyIndent = indent + 1;
+			AppendNamespaceBeginning(
+				type.Namespace,
+				output);
 			
-			// C++ element proxy constructor definition
-			AppendIndent(
-				cppMethodDefinitionsIndent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.Append(cppElementProxyTypeName);
-			builders.CppMethodDefinitions.Append(
-				"::ArrayElementProxy");
-			builders.CppMethodDefinitions.Append(rank);
-			builders.CppMethodDefinitions.Append('_');
-			builders.CppMethodDefinitions.Append(maxRank);
-			builders.CppMethodDefinitions.Append(
-				"(Plugin::InternalUse, int32_t handle, ");
-			for (int i = 0; i < rank; ++i)
+			// Default constructor holds no handles
+			AppendIndent(indent, output);
+			output.Append(mirrorName);
+			output.Append("::");
+			output.Append(mirrorName);
+			output.AppendLine("()");
+			AppendIndent(indent, output);
+			output.AppendLine("{");
+			AppendCppValueMirrorHandles(
+				members,
+				string.Empty,
+				"{0} = 0;",
+				bodyIndent,
+				output);
+			AppendIndent(indent, output);
+			output.AppendLine("}");
+			AppendIndent(indent, output);
+			output.AppendLine();
+			
+			// Copy constructor
+			AppendIndent(indent, output);
+			output.Append(mirrorName);
+			output.Append("::");
+			output.Append(mirrorName);
+			output.Append("(const ");
+			output.Append(mirrorName);
+			output.AppendLine("& other)");
+			AppendIndent(indent, output);
+			output.AppendLine("{");
+			AppendCppValueMirrorCopyFields(
+				members,
+				bodyIndent,
+				output);
+			AppendCppValueMirrorHandles(
+				members,
+				string.Empty,
+				"Plugin::ReferenceManagedClass({0});",
+				bodyIndent,
+				output);
+			AppendIndent(indent, output);
+			output.AppendLine("}");
+			AppendIndent(indent, output);
+			output.AppendLine();
+			
+			// Move constructor
+			AppendIndent(indent, output);
+			output.Append(mirrorName);
+			output.Append("::");
+			output.Append(mirrorName);
+			output.Append('(');
+			output.Append(mirrorName);
+			output.AppendLine("&& other)");
+			AppendIndent(indent, output);
+			output.AppendLine("{");
+			AppendCppValueMirrorCopyFields(
+				members,
+				bodyIndent,
+				output);
+			AppendCppValueMirrorHandles(
+				members,
+				"other.",
+				"{0} = 0;",
+				bodyIndent,
+				output);
+			AppendIndent(indent, output);
+			output.AppendLine("}");
+			AppendIndent(indent, output);
+			output.AppendLine();
+			
+			// Destructor
+			AppendIndent(indent, output);
+			output.Append(mirrorName);
+			output.Append("::~");
+			output.Append(mirrorName);
+			output.AppendLine("()");
+			AppendIndent(indent, output);
+			output.AppendLine("{");
+			AppendCppValueMirrorHandles(
+				members,
+				string.Empty,
+				"Plugin::DereferenceManagedClass({0});",
+				bodyIndent,
+				output);
+			AppendIndent(indent, output);
+			output.AppendLine("}");
+			AppendIndent(indent, output);
+			output.AppendLine();
+			
+			// Copy assignment references before dereferencing so assigning
+			// to self doesn't release anything
+			AppendIndent(indent, output);
+			output.Append(mirrorName);
+			output.Append("& ");
+			output.Append(mirrorName);
+			output.Append("::operator=(const ");
+			output.Append(mirrorName);
+			output.AppendLine("& other)");
+			AppendIndent(indent, output);
+			output.AppendLine("{");
+			AppendCppValueMirrorHandles(
+				members,
+				"other.",
+				"Plugin::ReferenceManagedClass({0});",
+				bodyIndent,
+				output);
+			AppendCppValueMirrorHandles(
+				members,
+				string.Empty,
+				"Plugin::DereferenceManagedClass({0});",
+				bodyIndent,
+				output);
+			AppendCppValueMirrorCopyFields(
+				members,
+				bodyIndent,
+				output);
+			AppendIndent(bodyIndent, output);
+			output.AppendLine("return *this;");
+			AppendIndent(indent, output);
+			output.AppendLine("}");
+			AppendIndent(indent, output);
+			output.AppendLine();
+			
+			// Move assignment
+			AppendIndent(indent, output);
+			output.Append(mirrorName);
+			output.Append("& ");
+			output.Append(mirrorName);
+			output.Append("::operator=(");
+			output.Append(mirrorName);
+			output.AppendLine("&& other)");
+			AppendIndent(indent, output);
+			output.AppendLine("{");
+			AppendIndent(bodyIndent, output);
+			output.AppendLine("if (this != &other)");
+			AppendIndent(bodyIndent, output);
+			output.AppendLine("{");
+			AppendCppValueMirrorHandles(
+				members,
+				string.Empty,
+				"Plugin::DereferenceManagedClass({0});",
+				bodyIndent + 1,
+				output);
+			AppendCppValueMirrorCopyFields(
+				members,
+				bodyIndent + 1,
+				output);
+			AppendCppValueMirrorHandles(
+				members,
+				"other.",
+				"{0} = 0;",
+				bodyIndent + 1,
+				output);
+			AppendIndent(bodyIndent, output);
+			output.AppendLine("}");
+			AppendIndent(bodyIndent, output);
+			output.AppendLine("return *this;");
+			AppendIndent(indent, output);
+			output.AppendLine("}");
+			AppendIndent(indent, output);
+			output.AppendLine();
+			
+			// Getters for objects referred to by handles
+			foreach (MemberInfo member in members)
 			{
-				builders.CppMethodDefinitions.Append("int32_t index");
-				builders.CppMethodDefinitions.Append(i);
-				if (i != rank - 1)
+				Type memberType = GetValueMemberType(member);
+				if (GetTypeKind(memberType) != TypeKind.Class)
 				{
-					builders.CppMethodDefinitions.Append(", ");
+					continue;
 				}
-			}
-			builders.CppMethodDefinitions.AppendLine(")");
-			AppendIndent(
-				cppMethodDefinitionsIndent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("{");
-			AppendIndent(
-				cppMethodDefinitionsIndent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("Handle = handle;");
-			for (int i = 0; i < rank; ++i)
-			{
-				AppendIndent(
-					cppMethodDefinitionsIndent + 1,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append("Index");
-				builders.CppMethodDefinitions.Append(i);
-				builders.CppMethodDefinitions.Append(" = index");
-				builders.CppMethodDefinitions.Append(i);
-				builders.CppMethodDefinitions.AppendLine(";");
-			}
-			AppendIndent(
-				cppMethodDefinitionsIndent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("}");
-			AppendIndent(
-				cppMethodDefinitionsIndent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine();;
-			
-			if (rank == maxRank)
-			{
-				// C++ element proxy operator= definition
-				AppendIndent(
-					cppMethodDefinitionsIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append("void ");
-				builders.CppMethodDefinitions.Append(cppElementProxyTypeName);
-				builders.CppMethodDefinitions.Append("::");
-				builders.CppMethodDefinitions.Append("operator=(");
+				AppendIndent(indent, output);
 				AppendCppTypeFullName(
-					elementType,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine(" item)");
-				AppendIndent(
-					cppMethodDefinitionsIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("{");
-				AppendCppPluginFunctionCall(
-					false,
-					GetTypeName(cppArrayTypeName, "System"),
-					TypeKind.Class,
-					cppTypeParams,
-					typeof(void),
-					setItemFuncName,
-					setItemCallParams,
-					cppMethodDefinitionsIndent + 1,
-					builders.CppMethodDefinitions);
-				AppendIndent(
-					cppMethodDefinitionsIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("}");
-				AppendIndent(
-					cppMethodDefinitionsIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine();;
-				
-				// C++ element proxy type conversion operator definition
-				AppendIndent(
-					cppMethodDefinitionsIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append(cppElementProxyTypeName);
-				builders.CppMethodDefinitions.Append("::");
-				builders.CppMethodDefinitions.Append("operator ");
+					memberType,
+					output);
+				output.Append(' ');
+				output.Append(mirrorName);
+				output.Append("::Get");
+				output.Append(char.ToUpper(member.Name[0]));
+				output.Append(member.Name, 1, member.Name.Length - 1);
+				output.AppendLine("() const");
+				AppendIndent(indent, output);
+				output.AppendLine("{");
+				AppendIndent(bodyIndent, output);
+				output.Append("return ");
 				AppendCppTypeFullName(
-					elementType,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("()");
-				AppendIndent(
-					cppMethodDefinitionsIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("{");
-				AppendCppPluginFunctionCall(
-					false,
-					GetTypeName(cppArrayTypeName, "System"),
-					TypeKind.Class,
-					cppTypeParams,
-					elementType,
-					getItemFuncName,
-					getItemCallParams,
-					indent + 1,
-					builders.CppMethodDefinitions);
-				AppendCppMethodReturn(
-					elementType,
-					elementTypeKind,
-					indent + 1,
-					builders.CppMethodDefinitions);
-				AppendIndent(
-					cppMethodDefinitionsIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("}");
+					memberType,
+					output);
+				output.Append("(Plugin::InternalUse::Only, ");
+				AppendValueMirrorFieldName(
+					member,
+					output);
+				output.AppendLine(");");
+				AppendIndent(indent, output);
+				output.AppendLine("}");
+				AppendIndent(indent, output);
+				output.AppendLine();
 			}
-			else
+			AppendCppMethodDefinitionsEnd(
+				indent,
+				output);
+		}
+		
+		static void AppendCppValueMirrorCopyFields(
+			MemberInfo[] members,
+			int indent,
+			StringBuilder output)
+		{
+			foreach (MemberInfo member in members)
 			{
-				AppendCppArrayIndexOperatorMethodDefinition(
-					rank,
-					cppMethodDefinitionsIndent,
-					GetTypeName(cppElementProxyTypeName, "Plugin"),
-					nextCppElementProxyTypeName,
-					builders.CppMethodDefinitions);
+				AppendIndent(indent, output);
+				AppendValueMirrorFieldName(
+					member,
+					output);
+				output.Append(" = other.");
+				AppendValueMirrorFieldName(
+					member,
+					output);
+				output.AppendLine(";");
 			}
-			
-			// C++ method definitions (ending)
-			AppendCppMethodDefinitionsEnd(
-				cppMethodDefinitionsIndent,
-				builders.CppMethodDefinitions);
 		}
 		
-		static void AppendArrayConstructor(
-			Type elementType,
-			Type arrayType,
-			string cppArrayTypeName,
-			int rank,
-			string csharpTypeName,
-			Type[] cppCtorInitTypes,
+		// Append a statement for every handle field of a mirror. The format
+		// is passed the prefixed field name as {0}.
+		static void AppendCppValueMirrorHandles(
+			MemberInfo[] members,
+			string prefix,
+			string format,
+			int indent,
+			StringBuilder output)
+		{
+			foreach (MemberInfo member in members)
+			{
+				if (GetTypeKind(GetValueMemberType(member)) == TypeKind.Class)
+				{
+					AppendIndent(indent, output);
+					output.AppendFormat(
+						format,
+						prefix + member.Name + "Handle");
+					output.AppendLine();
+				}
+			}
+		}
+		
+		// Copy members from a managed struct to its C# mirror. The
+		// destination includes the member access operator.
+		static void AppendCsharpValueMirrorCopy(
+			MemberInfo[] members,
+			string source,
+			string destination,
+			int indent,
+			StringBuilder output)
+		{
+			for (int i = 0; i < members.Length; ++i)
+			{
+				MemberInfo member = members[i];
+				Type memberType = GetValueMemberType(member);
+				if (i > 0)
+				{
+					output.AppendLine();
+					AppendIndent(indent, output);
+				}
+				output.Append(destination);
+				AppendValueMirrorFieldName(
+					member,
+					output);
+				output.Append(" = ");
+				if (GetTypeKind(memberType) == TypeKind.Class)
+				{
+					output.Append(
+						"NativeScript.Bindings.ObjectStore.GetHandle(");
+					output.Append(source);
+					output.Append('.');
+					output.Append(member.Name);
+					output.Append(");");
+				}
+				else
+				{
+					output.Append(source);
+					output.Append('.');
+					output.Append(member.Name);
+					if (memberType == typeof(bool))
+					{
+						output.Append(" ? 1 : 0");
+					}
+					output.Append(';');
+				}
+			}
+		}
+		
+		// Build the parameter for a pointer to mirrors
+		static ParameterInfo GetValueMirrorPointerParameter(string name)
+		{
+			ParameterInfo param = new ParameterInfo();
+			param.Name = name;
+			param.ParameterType = typeof(void).MakePointerType();
+			param.IsOut = false;
+			param.IsRef = false;
+			param.DereferencedParameterType = param.ParameterType;
+			param.Kind = TypeKind.Pointer;
+			return param;
+		}
+		
+		// Copy a managed struct to C++ by value
+		static void AppendValueMirrorGetValue(
+			Type type,
+			MemberInfo[] members,
 			int indent,
+			int cppMethodDefinitionsIndent,
 			StringBuilders builders)
 		{
 			builders.TempStrBuilder.Length = 0;
-			AppendNamespace(
-				elementType.Namespace,
-				string.Empty,
+			AppendReleaseFunctionNameSuffix(
+				GetTypeName(type),
+				null,
 				builders.TempStrBuilder);
-			AppendTypeNameWithoutGenericSuffix(
-				csharpTypeName,
+			string funcNameSuffix = builders.TempStrBuilder.ToString();
+			string funcName = funcNameSuffix + "GetValue";
+			string csharpMirrorName = funcNameSuffix + "Value";
+			
+			builders.TempStrBuilder.Length = 0;
+			AppendCppTypeFullName(
+				type,
 				builders.TempStrBuilder);
-			builders.TempStrBuilder.Append("Constructor");
-			builders.TempStrBuilder.Append(rank);
-			string funcName = builders.TempStrBuilder.ToString();
+			string cppTypeName = builders.TempStrBuilder.ToString();
+			string cppMirrorName = cppTypeName + "Value";
 			
-			ParameterInfo[] parameters = new ParameterInfo[rank];
-			for (int i = 0; i < rank; ++i)
-			{
-				ParameterInfo info = new ParameterInfo();
-				info.Name = "length" + i;
-				info.ParameterType = typeof(int);
-				info.IsOut = false;
-				info.IsRef = false;
-				info.DereferencedParameterType = info.ParameterType;
-				info.Kind = TypeKind.Primitive;
-				parameters[i] = info;
-			}
-
-			TypeName cppArrayTypeTypeName = GetTypeName(
-				cppArrayTypeName,
-				"System");
+			ParameterInfo[] parameters = {
+				GetValueMirrorPointerParameter("value")
+			};
 			
-			// C# Delegate Type
+			// C# delegate type and init call
 			AppendCsharpDelegateType(
 				funcName,
-				true,
-				arrayType,
-				TypeKind.Class,
-				arrayType,
+				false,
+				type,
+				TypeKind.ManagedStruct,
+				typeof(void),
 				parameters,
 				builders.CsharpDelegateTypes);
-			
-			// C# Init Call
 			AppendCsharpCsharpDelegate(
 				funcName,
+				true,
 				builders.CsharpInitCall,
 				builders.CsharpCsharpDelegates);
 			
-			// C# Init Param
-
 			// C# function
+			StringBuilder output = builders.CsharpFunctions;
 			AppendCsharpFunctionBeginning(
-				arrayType,
+				type,
 				funcName,
-				true,
-				TypeKind.Class,
-				arrayType,
+				false,
+				TypeKind.ManagedStruct,
+				typeof(void),
 				parameters,
-				builders.CsharpFunctions);
-			AppendHandleStoreTypeName(
-				arrayType,
-				builders.CsharpFunctions);
-			builders.CsharpFunctions.Append(".Store(new ");
-			AppendCsharpTypeFullName(
-				elementType,
-				builders.CsharpFunctions);
-			builders.CsharpFunctions.Append('[');
-			for (int i = 0; i < rank; ++i)
-			{
-				builders.CsharpFunctions.Append("length");
-				builders.CsharpFunctions.Append(i);
-				if (i != rank-1)
-				{
-					builders.CsharpFunctions.Append(", ");
-				}
-			}
-			builders.CsharpFunctions.Append("]);");
+				output);
+			output.Append("var pValue = (");
+			output.Append(csharpMirrorName);
+			output.AppendLine("*)value;");
+			output.Append("\t\t\t\t");
+			AppendCsharpValueMirrorCopy(
+				members,
+				"thiz",
+				"pValue->",
+				4,
+				output);
 			AppendCsharpFunctionReturn(
 				parameters,
-				arrayType,
-				TypeKind.Class,
+				typeof(void),
+				TypeKind.None,
 				null,
-				true,
-				builders.CsharpFunctions);
+				false,
+				output);
 			
-			// C++ function pointer definition
+			// C++ function pointer and init
 			AppendCppFunctionPointerDefinition(
 				funcName,
-				true,
-				cppArrayTypeTypeName,
-				TypeKind.Class,
-				parameters,
-				arrayType,
+				false,
+				GetTypeName(type),
+				TypeKind.ManagedStruct,
+				parameters,
+				typeof(void),
 				builders.CppFunctionPointers);
-			
-			// C++ init body
 			AppendCppInitBodyFunctionPointerParameterRead(
 				funcName,
-				true,
-				cppArrayTypeTypeName,
-				TypeKind.Class,
+				false,
+				GetTypeName(type),
+				TypeKind.ManagedStruct,
 				parameters,
-				arrayType,
+				typeof(void),
 				builders.CppInitBodyParameterReads);
 			
 			// C++ method declaration
 			AppendIndent(
 				indent + 1,
 				builders.CppTypeDefinitions);
-			AppendCppMethodDeclaration(
-				cppArrayTypeName,
-				false,
-				false,
-				false,
-				null,
-				null,
-				parameters,
-				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append(cppMirrorName);
+			builders.CppTypeDefinitions.AppendLine(" GetValue();");
 			
 			// C++ method definition
-			Type[] cppTypeParams = { elementType };
-			AppendCppMethodDefinitionBegin(
-				GetTypeName(cppArrayTypeName, "System"),
-				null,
-				cppArrayTypeName,
-				cppTypeParams,
+			output = builders.CppMethodDefinitions;
+			int bodyIndent = cppMethodDefinitionsIndent + 1;
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.Append(cppMirrorName);
+			output.Append(' ');
+			output.Append(cppTypeName);
+			output.AppendLine("::GetValue()");
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.AppendLine("{");
+			AppendIndent(bodyIndent, output);
+			output.Append(cppMirrorName);
+			output.AppendLine(" value;");
+			AppendIndent(bodyIndent, output);
+			output.Append("Plugin::");
+			output.Append(funcName);
+			output.AppendLine("(Handle, &value);");
+			AppendCppValueMirrorHandles(
+				members,
+				"value.",
+				"Plugin::ReferenceManagedClass({0});",
+				bodyIndent,
+				output);
+			AppendCppUnhandledExceptionHandling(
+				bodyIndent,
+				output);
+			AppendIndent(bodyIndent, output);
+			output.AppendLine("return value;");
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.AppendLine("}");
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.AppendLine();
+		}
+		
+		// Copy a range of array elements to C++ by value in one call
+		static void AppendArrayGetValues(
+			Type elementType,
+			MemberInfo[] members,
+			Type arrayType,
+			string cppArrayTypeName,
+			string cppGenericArrayTypeName,
+			string bindingArrayTypeName,
+			int indent,
+			int cppMethodDefinitionsIndent,
+			StringBuilders builders)
+		{
+			string funcName = bindingArrayTypeName + "GetValues";
+			
+			builders.TempStrBuilder.Length = 0;
+			AppendReleaseFunctionNameSuffix(
+				GetTypeName(elementType),
 				null,
-				parameters,
-				indent,
-				builders.CppMethodDefinitions);
-			string separator = ": ";
-			foreach (Type interfaceType in cppCtorInitTypes)
+				builders.TempStrBuilder);
+			string csharpMirrorName = builders.TempStrBuilder.ToString()
+				+ "Value";
+			
+			builders.TempStrBuilder.Length = 0;
+			AppendCppTypeFullName(
+				elementType,
+				builders.TempStrBuilder);
+			string cppMirrorName = builders.TempStrBuilder.ToString()
+				+ "Value";
+			
+			ParameterInfo[] parameters = new ParameterInfo[3];
+			string[] paramNames = { "startIndex", "count" };
+			for (int i = 0; i < paramNames.Length; ++i)
 			{
-				AppendIndent(
-					indent + 1,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append(separator);
-				AppendCppTypeFullName(
-					interfaceType,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("(nullptr)");
-				separator = ", ";
+				ParameterInfo param = new ParameterInfo();
+				param.Name = paramNames[i];
+				param.ParameterType = typeof(int);
+				param.IsOut = false;
+				param.IsRef = false;
+				param.DereferencedParameterType = param.ParameterType;
+				param.Kind = TypeKind.Primitive;
+				parameters[i] = param;
 			}
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("{");
-			AppendCppPluginFunctionCall(
+			parameters[2] = GetValueMirrorPointerParameter("values");
+			
+			// C# delegate type and init call
+			AppendCsharpDelegateType(
+				funcName,
+				false,
+				arrayType,
+				TypeKind.Class,
+				typeof(void),
+				parameters,
+				builders.CsharpDelegateTypes);
+			AppendCsharpCsharpDelegate(
+				funcName,
 				true,
+				builders.CsharpInitCall,
+				builders.CsharpCsharpDelegates);
+			
+			// C# function
+			StringBuilder output = builders.CsharpFunctions;
+			AppendCsharpFunctionBeginning(
+				arrayType,
+				funcName,
+				false,
+				TypeKind.Class,
+				typeof(void),
+				parameters,
+				output);
+			output.Append("var pValues = (");
+			output.Append(csharpMirrorName);
+			output.AppendLine("*)values;");
+			output.AppendLine("\t\t\t\tfor (int i = 0; i < count; ++i)");
+			output.AppendLine("\t\t\t\t{");
+			output.AppendLine("\t\t\t\t\tvar item = thiz[startIndex + i];");
+			output.Append("\t\t\t\t\t");
+			AppendCsharpValueMirrorCopy(
+				members,
+				"item",
+				"pValues[i].",
+				5,
+				output);
+			output.AppendLine();
+			output.Append("\t\t\t\t}");
+			AppendCsharpFunctionReturn(
+				parameters,
+				typeof(void),
+				TypeKind.None,
+				null,
+				false,
+				output);
+			
+			// C++ function pointer and init
+			TypeName cppArrayTypeTypeName = GetTypeName(
+				"System",
+				cppArrayTypeName);
+			AppendCppFunctionPointerDefinition(
+				funcName,
+				false,
 				cppArrayTypeTypeName,
 				TypeKind.Class,
-				cppTypeParams,
-				arrayType,
+				parameters,
+				typeof(void),
+				builders.CppFunctionPointers);
+			AppendCppInitBodyFunctionPointerParameterRead(
 				funcName,
+				false,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
 				parameters,
-				indent + 1,
-				builders.CppMethodDefinitions);
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"Handle = returnValue;");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"if (returnValue)");
+				typeof(void),
+				builders.CppInitBodyParameterReads);
+			
+			// C++ method declaration
 			AppendIndent(
 				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"{");
-			AppendIndent(
-				indent + 2,
-				builders.CppMethodDefinitions);
-			AppendReferenceManagedHandleFunctionCall(
-				cppArrayTypeTypeName,
-				TypeKind.Class,
-				cppTypeParams,
-				"returnValue",
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(";");
-			if (rank > 1)
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append(
+				"void GetValues(int32_t startIndex, int32_t count, ");
+			builders.CppTypeDefinitions.Append(cppMirrorName);
+			builders.CppTypeDefinitions.AppendLine("* values);");
+			
+			// C++ method definition
+			output = builders.CppMethodDefinitions;
+			int bodyIndent = cppMethodDefinitionsIndent + 1;
+			bool hasHandles = HasHandleValueMember(members);
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.Append("void ");
+			output.Append(cppGenericArrayTypeName);
+			output.Append("::GetValues(int32_t startIndex, int32_t count, ");
+			output.Append(cppMirrorName);
+			output.AppendLine("* values)");
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.AppendLine("{");
+			if (hasHandles)
 			{
-				AppendIndent(
-					indent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append("InternalLength = ");
-				for (int i = 0; i < rank; ++i)
-				{
-					builders.CppMethodDefinitions.Append("length");
-					builders.CppMethodDefinitions.Append(i);
-					if (i != rank - 1)
-					{
-						builders.CppMethodDefinitions.Append(" * ");
-					}
-				}
-				builders.CppMethodDefinitions.AppendLine(";");
-				for (int i = 0; i < rank; ++i)
-				{
-					AppendIndent(
-						indent + 2,
-						builders.CppMethodDefinitions);
-					builders.CppMethodDefinitions.Append("InternalLengths[");
-					builders.CppMethodDefinitions.Append(i);
-					builders.CppMethodDefinitions.Append("] = length");
-					builders.CppMethodDefinitions.Append(i);
-					builders.CppMethodDefinitions.AppendLine(";");
-				}
+				// Release the objects the values refer to before C# writes
+				// over their handles
+				AppendIndent(bodyIndent, output);
+				output.AppendLine("for (int32_t i = 0; i < count; ++i)");
+				AppendIndent(bodyIndent, output);
+				output.AppendLine("{");
+				AppendIndent(bodyIndent + 1, output);
+				output.Append("values[i] = ");
+				output.Append(cppMirrorName);
+				output.AppendLine("();");
+				AppendIndent(bodyIndent, output);
+				output.AppendLine("}");
 			}
-			else
+			AppendIndent(bodyIndent, output);
+			output.Append("Plugin::");
+			output.Append(funcName);
+			output.AppendLine("(Handle, startIndex, count, values);");
+			if (hasHandles)
 			{
-				AppendIndent(
-					indent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine(
-					"InternalLength = length0;");
+				AppendIndent(bodyIndent, output);
+				output.AppendLine("for (int32_t i = 0; i < count; ++i)");
+				AppendIndent(bodyIndent, output);
+				output.AppendLine("{");
+				AppendCppValueMirrorHandles(
+					members,
+					"values[i].",
+					"Plugin::ReferenceManagedClass({0});",
+					bodyIndent + 1,
+					output);
+				AppendIndent(bodyIndent, output);
+				output.AppendLine("}");
 			}
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"}");
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("}");
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine();;
+			AppendCppUnhandledExceptionHandling(
+				bodyIndent,
+				output);
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.AppendLine("}");
+			AppendIndent(cppMethodDefinitionsIndent, output);
+			output.AppendLine();
 		}
 		
-		static void AppendArrayCppGetLengthFunction(
-			int indent,
+		static void AppendArrayGetItems(
+			Type elementType,
+			TypeKind elementTypeKind,
+			Type arrayType,
 			string cppArrayTypeName,
-			Type[] cppTypeParams,
+			string bindingArrayTypeName,
 			StringBuilders builders)
 		{
-			ParameterInfo[] parameters = new ParameterInfo[0];
+			string funcName = bindingArrayTypeName + "GetItems";
 			
-			// C++ method declaration
-			AppendIndent(
-				indent + 1,
-				builders.CppTypeDefinitions);
-			AppendCppMethodDeclaration(
-				"GetLength",
-				false,
-				false,
-				false,
-				typeof(int),
-				null,
-				parameters,
-				builders.CppTypeDefinitions);
-			
-			// C++ method definition
-			AppendCppMethodDefinitionBegin(
-				GetTypeName(cppArrayTypeName, "System"),
-				typeof(int),
-				"GetLength",
-				cppTypeParams,
-				null,
-				parameters,
-				indent,
-				builders.CppMethodDefinitions);
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("{");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"int32_t returnVal = InternalLength;");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("if (returnVal == 0)");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("{");
-			AppendIndent(
-				indent + 2,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"returnVal = Array::GetLength();");
-			AppendIndent(
-				indent + 2,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"InternalLength = returnVal;");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("};");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("return returnVal;");
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("}");
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine();;
-		}
-		
-		static void AppendArrayCppGetRankFunction(
-			int indent,
-			string cppArrayTypeName,
-			Type[] cppTypeParams,
-			int rank,
-			StringBuilders builders)
-		{
-			ParameterInfo[] parameters = new ParameterInfo[0];
-			
-			// C++ method declaration
-			AppendIndent(
-				indent + 1,
-				builders.CppTypeDefinitions);
-			AppendCppMethodDeclaration(
-				"GetRank",
-				false,
-				false,
-				false,
-				typeof(int),
-				null,
-				parameters,
-				builders.CppTypeDefinitions);
-			
-			// C++ method definition
-			AppendCppMethodDefinitionBegin(
-				GetTypeName(cppArrayTypeName, "System"),
-				typeof(int),
-				"GetRank",
-				cppTypeParams,
-				null,
-				parameters,
-				indent,
-				builders.CppMethodDefinitions);
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("{");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.Append("return ");
-			builders.CppMethodDefinitions.Append(rank);
-			builders.CppMethodDefinitions.AppendLine(";");
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("}");
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine();;
-		}
-		
-		static void AppendArrayMultidimensionalGetLength(
-			Type elementType,
-			Type arrayType,
-			string cppArrayTypeName,
-			int rank,
-			string csharpTypeName,
-			int indent,
-			StringBuilders builders)
-		{
-			builders.TempStrBuilder.Length = 0;
-			AppendNamespace(
-				elementType.Namespace,
-				string.Empty,
-				builders.TempStrBuilder);
-			AppendTypeNameWithoutGenericSuffix(
-				csharpTypeName,
-				builders.TempStrBuilder);
-			builders.TempStrBuilder.Append("GetLength");
-			builders.TempStrBuilder.Append(rank);
-			string funcName = builders.TempStrBuilder.ToString();
-			
-			ParameterInfo[] parameters = {
-				new ParameterInfo {
-					Name = "dimension",
-					ParameterType = typeof(int),
-					IsOut = false,
-					IsRef = false,
-					DereferencedParameterType = typeof(int),
-					Kind = TypeKind.Primitive,
-				}
-			};
-
-			TypeName cppArrayTypeTypeName = GetTypeName(
-				cppArrayTypeName,
-				"System");
+			// Parameters: where to start, how many, and where to write them
+			ParameterInfo[] parameters = new ParameterInfo[3];
+			string[] paramNames = { "startIndex", "count", "items" };
+			Type[] paramTypes = { typeof(int), typeof(int), typeof(IntPtr) };
+			for (int i = 0; i < parameters.Length; ++i)
+			{
+				ParameterInfo param = new ParameterInfo();
+				param.Name = paramNames[i];
+				param.ParameterType = paramTypes[i];
+				param.IsOut = false;
+				param.IsRef = false;
+				param.DereferencedParameterType = param.ParameterType;
+				param.Kind = GetTypeKind(
+					param.DereferencedParameterType);
+				parameters[i] = param;
+			}
 			
 			// C# Delegate Type
 			AppendCsharpDelegateType(
@@ -5880,7 +6128,7 @@ namespace NativeScript.Editor
 				false,
 				arrayType,
 				TypeKind.Class,
-				typeof(int),
+				typeof(void),
 				parameters,
 				builders.CsharpDelegateTypes);
 			
@@ -5890,27 +6138,31 @@ namespace NativeScript.Editor
 				builders.CsharpInitCall,
 				builders.CsharpCsharpDelegates);
 			
-			// C# Init Param
-
 			// C# function
 			AppendCsharpFunctionBeginning(
 				arrayType,
 				funcName,
 				false,
 				TypeKind.Class,
-				typeof(int),
+				typeof(void),
 				parameters,
 				builders.CsharpFunctions);
-			builders.CsharpFunctions.Append(
-				"thiz.GetLength(dimension);");
+			AppendCsharpArrayGetItemsBody(
+				elementType,
+				elementTypeKind,
+				builders.CsharpFunctions);
 			AppendCsharpFunctionReturn(
 				parameters,
-				typeof(int),
-				TypeKind.Primitive,
+				typeof(void),
+				TypeKind.None,
 				null,
 				false,
 				builders.CsharpFunctions);
 			
+			TypeName cppArrayTypeTypeName = GetTypeName(
+				"System",
+				cppArrayTypeName);
+			
 			// C++ function pointer definition
 			AppendCppFunctionPointerDefinition(
 				funcName,
@@ -5918,7 +6170,7 @@ namespace NativeScript.Editor
 				cppArrayTypeTypeName,
 				TypeKind.Class,
 				parameters,
-				arrayType,
+				typeof(void),
 				builders.CppFunctionPointers);
 			
 			// C++ init body
@@ -5928,495 +6180,2253 @@ namespace NativeScript.Editor
 				cppArrayTypeTypeName,
 				TypeKind.Class,
 				parameters,
-				arrayType,
+				typeof(void),
 				builders.CppInitBodyParameterReads);
-			
-			// C++ method declaration
-			AppendIndent(
-				indent + 1,
-				builders.CppTypeDefinitions);
-			AppendCppMethodDeclaration(
-				"GetLength",
-				false,
-				false,
-				false,
-				typeof(int),
-				null,
-				parameters,
-				builders.CppTypeDefinitions);
-			
-			// C++ method definition
-			Type[] cppTypeParams = { elementType };
-			AppendCppMethodDefinitionBegin(
-				GetTypeName(cppArrayTypeName, "System"),
-				typeof(int),
-				"GetLength",
-				cppTypeParams,
-				null,
-				parameters,
-				indent,
-				builders.CppMethodDefinitions);
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("{");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.Append(
-				"assert(dimension >= 0 && dimension < ");
-			builders.CppMethodDefinitions.Append(rank);
-			builders.CppMethodDefinitions.AppendLine(");");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"int32_t length = InternalLengths[dimension];");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("if (length)");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("{");
-			AppendIndent(
-				indent + 2,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("return length;");
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("}");
-			AppendCppPluginFunctionCall(
-				false,
-				GetTypeName(cppArrayTypeName, "System"),
-				TypeKind.Class,
-				cppTypeParams,
-				typeof(int),
-				funcName,
-				parameters,
-				indent + 1,
-				builders.CppMethodDefinitions);
-			AppendIndent(
-				indent + 1,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine(
-				"InternalLengths[dimension] = returnValue;");
-			AppendCppMethodReturn(
-				typeof(int),
-				TypeKind.Primitive,
-				indent + 1,
-				builders.CppMethodDefinitions);
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine("}");
-			AppendIndent(
-				indent,
-				builders.CppMethodDefinitions);
-			builders.CppMethodDefinitions.AppendLine();;
 		}
 		
-		static void AppendArrayGetItem(
-			Type elementType,
-			TypeKind elementTypeKind,
-			Type arrayType,
-			string cppArrayTypeName,
-			int rank,
-			StringBuilders builders)
+		// Get the Marshal.WriteX function to write a primitive with, the size
+		// of one element, and the type to cast to before writing
+		static void GetCsharpMarshalWrite(
+			Type type,
+			out string writeFuncName,
+			out string elementSize,
+			out string castTypeName)
 		{
-			builders.TempStrBuilder.Length = 0;
-			AppendArrayGetItemFuncName(
-				GetTypeName(elementType),
-				cppArrayTypeName,
-				rank,
-				builders.TempStrBuilder);
-			string funcName = builders.TempStrBuilder.ToString();
-			
-			ParameterInfo[] parameters = BuildArrayGetItemsParams(
-				rank,
-				"index");
-			
-			// C# Delegate Type
-			AppendCsharpDelegateType(
-				funcName,
-				false,
-				arrayType,
-				TypeKind.Class,
-				elementType,
-				parameters,
-				builders.CsharpDelegateTypes);
-			
-			// C# Init Call
-			AppendCsharpCsharpDelegate(
-				funcName,
-				builders.CsharpInitCall,
-				builders.CsharpCsharpDelegates);
-			
-			// C# Init Param
-
-			// C# function
-			AppendCsharpFunctionBeginning(
-				arrayType,
-				funcName,
-				false,
-				TypeKind.Class,
-				elementType,
-				parameters,
-				builders.CsharpFunctions);
-			builders.CsharpFunctions.Append("thiz[");
-			for (int i = 0; i < rank; ++i)
+			if (type == typeof(bool))
 			{
-				builders.CsharpFunctions.Append("index");
-				builders.CsharpFunctions.Append(i);
-				if (i != rank-1)
-				{
-					builders.CsharpFunctions.Append(", ");
-				}
+				writeFuncName = "WriteInt32";
+				elementSize = "4";
+				castTypeName = null;
+			}
+			else if (type == typeof(byte) || type == typeof(sbyte))
+			{
+				writeFuncName = "WriteByte";
+				elementSize = "1";
+				castTypeName = "byte";
+			}
+			else if (type == typeof(short)
+				|| type == typeof(ushort)
+				|| type == typeof(char))
+			{
+				writeFuncName = "WriteInt16";
+				elementSize = "2";
+				castTypeName = "short";
+			}
+			else if (type == typeof(long) || type == typeof(ulong))
+			{
+				writeFuncName = "WriteInt64";
+				elementSize = "8";
+				castTypeName = "long";
+			}
+			else if (type == typeof(IntPtr) || type == typeof(UIntPtr))
+			{
+				writeFuncName = "WriteIntPtr";
+				elementSize = "IntPtr.Size";
+				castTypeName = "System.IntPtr";
+			}
+			else
+			{
+				writeFuncName = "WriteInt32";
+				elementSize = "4";
+				castTypeName = "int";
 			}
-			builders.CsharpFunctions.Append("];");
-			AppendCsharpFunctionReturn(
-				parameters,
-				elementType,
-				elementTypeKind,
-				null,
-				false,
-				builders.CsharpFunctions);
-
-			TypeName cppArrayTypeTypeName = GetTypeName(
-				"System",
-				cppArrayTypeName);
-
-			// C++ function pointer definition
-			AppendCppFunctionPointerDefinition(
-				funcName,
-				false,
-				cppArrayTypeTypeName,
-				TypeKind.Class,
-				parameters,
-				elementType,
-				builders.CppFunctionPointers);
-			
-			// C++ init body
-			AppendCppInitBodyFunctionPointerParameterRead(
-				funcName,
-				false,
-				cppArrayTypeTypeName,
-				TypeKind.Class,
-				parameters,
-				elementType,
-				builders.CppInitBodyParameterReads);
 		}
 		
-		static void AppendArraySetItem(
+		static void AppendCsharpArrayGetItemsBody(
 			Type elementType,
-			Type arrayType,
-			string cppArrayTypeName,
-			int rank,
-			StringBuilders builders)
+			TypeKind elementTypeKind,
+			StringBuilder output)
 		{
-			builders.TempStrBuilder.Length = 0;
-			AppendArraySetItemFuncName(
-				GetTypeName(elementType),
-				cppArrayTypeName,
-				rank,
-				builders.TempStrBuilder);
-			string funcName = builders.TempStrBuilder.ToString();
-			
-			// Build parameters as indexes then element
-			ParameterInfo[] parameters = BuildArraySetItemsParams(
-				rank,
-				"index",
-				elementType);
-			
-			// C# Delegate Type
-			AppendCsharpDelegateType(
-				funcName,
-				false,
-				arrayType,
-				TypeKind.Class,
-				typeof(void),
-				parameters,
-				builders.CsharpDelegateTypes);
-			
-			// C# Init Call
-			AppendCsharpCsharpDelegate(
-				funcName,
-				builders.CsharpInitCall,
-				builders.CsharpCsharpDelegates);
+			// Primitives with a Marshal.Copy overload are copied all at once
+			if (elementType == typeof(byte)
+				|| elementType == typeof(char)
+				|| elementType == typeof(short)
+				|| elementType == typeof(int)
+				|| elementType == typeof(long)
+				|| elementType == typeof(float)
+				|| elementType == typeof(double)
+				|| elementType == typeof(IntPtr))
+			{
+				output.Append("Marshal.Copy(thiz, startIndex, items, count);");
+				return;
+			}
 			
-			// C# Init Param
-
-			// C# function
-			AppendCsharpFunctionBeginning(
-				arrayType,
-				funcName,
-				false,
-				TypeKind.Class,
-				typeof(void),
-				parameters,
-				builders.CsharpFunctions);
-			builders.CsharpFunctions.Append("thiz[");
-			for (int i = 0; i < rank; ++i)
+			// Full structs are written with their marshaled size
+			if (elementTypeKind == TypeKind.FullStruct)
 			{
-				builders.CsharpFunctions.Append("index");
-				builders.CsharpFunctions.Append(i);
-				if (i != rank-1)
-				{
-					builders.CsharpFunctions.Append(", ");
-				}
+				output.Append("int itemSize = Marshal.SizeOf(typeof(");
+				AppendCsharpTypeFullName(
+					elementType,
+					output);
+				output.AppendLine("));");
+				output.Append("\t\t\t\t");
 			}
-			builders.CsharpFunctions.Append("] = item;");
-			AppendCsharpFunctionReturn(
-				parameters,
-				typeof(void),
-				TypeKind.None,
-				null,
-				false,
-				builders.CsharpFunctions);
-
-			TypeName cppArrayTypeTypeName = GetTypeName(
-				"System",
-				cppArrayTypeName);
-
-			// C++ function pointer definition
-			AppendCppFunctionPointerDefinition(
-				funcName,
-				false,
-				cppArrayTypeTypeName,
-				TypeKind.Class,
-				parameters,
-				arrayType,
-				builders.CppFunctionPointers);
 			
-			// C++ init body
-			AppendCppInitBodyFunctionPointerParameterRead(
-				funcName,
-				false,
-				cppArrayTypeTypeName,
-				TypeKind.Class,
-				parameters,
-				arrayType,
-				builders.CppInitBodyParameterReads);
+			output.AppendLine("for (int i = 0; i < count; ++i)");
+			output.AppendLine("\t\t\t\t{");
+			output.Append("\t\t\t\t\t");
+			switch (elementTypeKind)
+			{
+				case TypeKind.Class:
+				case TypeKind.ManagedStruct:
+					output.Append("Marshal.WriteInt32(items, i * 4, ");
+					AppendHandleStoreTypeName(
+						elementType,
+						output);
+					output.Append(
+						elementTypeKind == TypeKind.Class
+							? ".GetHandle("
+							: ".Store(");
+					output.AppendLine("thiz[startIndex + i]));");
+					break;
+				case TypeKind.FullStruct:
+					output.AppendLine(
+						"Marshal.StructureToPtr(thiz[startIndex + i], new IntPtr(items.ToInt64() + i * itemSize), false);");
+					break;
+				default:
+					Type primitiveType = elementTypeKind == TypeKind.Enum
+						? Enum.GetUnderlyingType(elementType)
+						: elementType;
+					string writeFuncName;
+					string elementSize;
+					string castTypeName;
+					GetCsharpMarshalWrite(
+						primitiveType,
+						out writeFuncName,
+						out elementSize,
+						out castTypeName);
+					output.Append("Marshal.");
+					output.Append(writeFuncName);
+					output.Append("(items, i * ");
+					output.Append(elementSize);
+					output.Append(", ");
+					if (primitiveType == typeof(bool))
+					{
+						output.AppendLine("thiz[startIndex + i] ? 1 : 0);");
+					}
+					else if (primitiveType == typeof(UIntPtr))
+					{
+						output.AppendLine("(System.IntPtr)(long)(ulong)thiz[startIndex + i]);");
+					}
+					else
+					{
+						output.Append('(');
+						output.Append(castTypeName);
+						output.Append(')');
+						if (elementTypeKind == TypeKind.Enum)
+						{
+							output.Append('(');
+							AppendCsharpTypeFullName(
+								primitiveType,
+								output);
+							output.Append(')');
+						}
+						output.AppendLine("thiz[startIndex + i]);");
+					}
+					break;
+			}
+			output.Append("\t\t\t\t}");
 		}
 		
-		static void AppendDelegate(
-			JsonDelegate jsonDelegate,
-			Assembly[] assemblies,
-			int defaultMaxSimultaneous,
-			StringBuilders builders)
+		static void AppendArrayIterator(
+			Type elementType,
+			TypeKind elementTypeKind,
+			string cppGenericArrayTypeName,
+			string bindingArrayTypeName,
+			StringBuilder cppTypeDefinitions,
+			StringBuilder cppMethodDefinitions)
 		{
-			Type type = GetType(
-				jsonDelegate.Type,
-				assemblies);
-			if (jsonDelegate.GenericParams != null)
+			// Classes and managed structs are buffered as handles that each
+			// hold a reference until the buffer is refilled or released
+			bool isHandle = elementTypeKind == TypeKind.Class
+				|| elementTypeKind == TypeKind.ManagedStruct;
+			string iteratorTypeName = bindingArrayTypeName + "Iterator";
+			
+			// Iterator type definition
+			cppTypeDefinitions.AppendLine("namespace Plugin");
+			cppTypeDefinitions.AppendLine("{");
+			cppTypeDefinitions.Append("\tstruct ");
+			cppTypeDefinitions.AppendLine(iteratorTypeName);
+			cppTypeDefinitions.AppendLine("\t{");
+			cppTypeDefinitions.Append("\t\tSystem::");
+			cppTypeDefinitions.Append(cppGenericArrayTypeName);
+			cppTypeDefinitions.AppendLine("& array;");
+			cppTypeDefinitions.AppendLine("\t\tint index;");
+			cppTypeDefinitions.AppendLine("\t\tint32_t length;");
+			cppTypeDefinitions.AppendLine("\t\tint32_t bufferStart;");
+			cppTypeDefinitions.AppendLine("\t\tint32_t bufferCount;");
+			cppTypeDefinitions.Append("\t\t");
+			if (isHandle)
 			{
-				for (int i = 0; i < jsonDelegate.GenericParams.Length; ++i)
-				{
-					// C++ template declaration
-					AppendCppTemplateDeclaration(
-						GetTypeName(type),
-						builders.CppTemplateDeclarations);
-				}
-
-				foreach (JsonGenericParams jsonGenericParams
-					in jsonDelegate.GenericParams)
-				{
-					Type[] typeParams = GetTypes(
-						jsonGenericParams.Types,
-						assemblies);
-					Type genericType = type.MakeGenericType(typeParams);
-					
-					// Build numbered C++ class name (e.g. Action_2)
-					builders.TempStrBuilder.Length = 0;
-					AppendTypeNameWithoutSuffixes(
-						type.Name,
-						builders.TempStrBuilder);
-					builders.TempStrBuilder.Append('_');
-					builders.TempStrBuilder.Append(
-						jsonGenericParams.Types.Length);
-					string cppTypeName = builders.TempStrBuilder.ToString();
-					
-					// Max simultaneous handles of this type
-					int maxSimultaneous = jsonGenericParams.MaxSimultaneous != 0
-						? jsonGenericParams.MaxSimultaneous
-						: jsonDelegate.MaxSimultaneous != 0
-							? jsonDelegate.MaxSimultaneous
-							: defaultMaxSimultaneous;
-					
-					AppendDelegate(
-						genericType,
-						cppTypeName,
-						typeParams,
-						maxSimultaneous,
-						builders);
-				}
+				cppTypeDefinitions.Append("int32_t");
 			}
 			else
 			{
-				int maxSimultaneous = jsonDelegate.MaxSimultaneous != 0
-					? jsonDelegate.MaxSimultaneous
-					: defaultMaxSimultaneous;
-				AppendDelegate(
-					type,
-					type.Name,
-					null,
-					maxSimultaneous,
-					builders);
+				AppendCppTypeFullName(
+					elementType,
+					cppTypeDefinitions);
 			}
-		}
-
-		static void AppendDelegate(
-			Type type,
-			string cppTypeName,
-			Type[] typeParams,
-			int maxSimultaneous,
-			StringBuilders builders)
-		{
-			builders.TempStrBuilder.Length = 0;
-			AppendNamespace(
-				type.Namespace,
-				string.Empty,
-				builders.TempStrBuilder);
-			AppendTypeNameWithoutSuffixes(
-				type.Name,
-				builders.TempStrBuilder);
-			AppendTypeNames(
-				typeParams,
-				builders.TempStrBuilder);
-			string bindingTypeName = builders.TempStrBuilder.ToString();
-			
-			builders.TempStrBuilder.Length = 0;
-			builders.TempStrBuilder.Append("Release");
-			builders.TempStrBuilder.Append(bindingTypeName);
-			string releaseFuncName = builders.TempStrBuilder.ToString();
-			
-			builders.TempStrBuilder.Length = 0;
-			builders.TempStrBuilder.Append(bindingTypeName);
-			builders.TempStrBuilder.Append("Constructor");
-			string constructorFuncName = builders.TempStrBuilder.ToString();
+			cppTypeDefinitions.AppendLine(" buffer[ArrayIteratorChunkSize];");
+			cppTypeDefinitions.Append("\t\t");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.Append("(System::");
+			cppTypeDefinitions.Append(cppGenericArrayTypeName);
+			cppTypeDefinitions.AppendLine("& array, int32_t index);");
+			cppTypeDefinitions.Append("\t\t");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.Append("(const ");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.AppendLine("& other) = delete;");
+			cppTypeDefinitions.Append("\t\t");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.Append('(');
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.AppendLine("&& other);");
+			if (isHandle)
+			{
+				cppTypeDefinitions.Append("\t\t~");
+				cppTypeDefinitions.Append(iteratorTypeName);
+				cppTypeDefinitions.AppendLine("();");
+			}
+			cppTypeDefinitions.Append("\t\t");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.AppendLine("& operator++();");
+			cppTypeDefinitions.Append("\t\tbool operator!=(const ");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.AppendLine("& other);");
+			cppTypeDefinitions.Append("\t\t");
+			AppendCppTypeFullName(
+				elementType,
+				cppTypeDefinitions);
+			cppTypeDefinitions.AppendLine(" operator*();");
+			cppTypeDefinitions.AppendLine("\t\tvoid FetchItems();");
+			if (isHandle)
+			{
+				cppTypeDefinitions.AppendLine("\t\tvoid ReleaseItems();");
+			}
+			cppTypeDefinitions.AppendLine("\t};");
+			cppTypeDefinitions.AppendLine("}");
+			cppTypeDefinitions.AppendLine();;
 			
-			builders.TempStrBuilder.Length = 0;
-			builders.TempStrBuilder.Append(bindingTypeName);
-			builders.TempStrBuilder.Append("Add");
-			string addFuncName = builders.TempStrBuilder.ToString();
+			// begin() and end() declarations
+			cppTypeDefinitions.AppendLine("namespace System");
+			cppTypeDefinitions.AppendLine("{");
+			cppTypeDefinitions.Append("\tPlugin::");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.Append(" begin(System::");
+			cppTypeDefinitions.Append(cppGenericArrayTypeName);
+			cppTypeDefinitions.AppendLine("& array);");
+			cppTypeDefinitions.Append("\tPlugin::");
+			cppTypeDefinitions.Append(iteratorTypeName);
+			cppTypeDefinitions.Append(" end(System::");
+			cppTypeDefinitions.Append(cppGenericArrayTypeName);
+			cppTypeDefinitions.AppendLine("& array);");
+			cppTypeDefinitions.AppendLine("}");
+			cppTypeDefinitions.AppendLine();;
 			
-			builders.TempStrBuilder.Length = 0;
-			builders.TempStrBuilder.Append(bindingTypeName);
-			builders.TempStrBuilder.Append("Remove");
-			string removeFuncName = builders.TempStrBuilder.ToString();
+			// Iterator method definitions
+			cppMethodDefinitions.AppendLine("namespace Plugin");
+			cppMethodDefinitions.AppendLine("{");
 			
-			TypeName typeTypeName = GetTypeName(type);
-
-			// C++ type declaration
-			int indent = AppendCppTypeDeclaration(
-				typeTypeName,
-				false,
-				typeParams,
-				typeParams != null ?
-					builders.CppTemplateSpecializationDeclarations :
-					builders.CppTypeDeclarations);
+			// Constructor. Fetching is deferred until the first dereference
+			// so end() iterators never call into C#.
+			cppMethodDefinitions.Append('\t');
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append("::");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append("(System::");
+			cppMethodDefinitions.Append(cppGenericArrayTypeName);
+			cppMethodDefinitions.AppendLine("& array, int32_t index)");
+			cppMethodDefinitions.AppendLine("\t\t: array(array)");
+			cppMethodDefinitions.AppendLine("\t\t, index(index)");
+			cppMethodDefinitions.AppendLine("\t\t, length(-1)");
+			cppMethodDefinitions.AppendLine("\t\t, bufferStart(index)");
+			cppMethodDefinitions.AppendLine("\t\t, bufferCount(0)");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
 			
-			ParameterInfo[] addRemoveParams = {
-				new ParameterInfo
-				{
-					Name = "del",
-					ParameterType = type,
-					DereferencedParameterType = type,
-					IsOut = false,
-					IsRef = false,
-					Kind = TypeKind.Class,
-					IsVirtual = true
-				}};
+			// Move constructor. Takes ownership of the buffered elements.
+			cppMethodDefinitions.Append('\t');
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append("::");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append('(');
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.AppendLine("&& other)");
+			cppMethodDefinitions.AppendLine("\t\t: array(other.array)");
+			cppMethodDefinitions.AppendLine("\t\t, index(other.index)");
+			cppMethodDefinitions.AppendLine("\t\t, length(other.length)");
+			cppMethodDefinitions.AppendLine("\t\t, bufferStart(other.bufferStart)");
+			cppMethodDefinitions.AppendLine("\t\t, bufferCount(other.bufferCount)");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.AppendLine("\t\tfor (int32_t i = 0; i < bufferCount; ++i)");
+			cppMethodDefinitions.AppendLine("\t\t{");
+			cppMethodDefinitions.AppendLine("\t\t\tbuffer[i] = other.buffer[i];");
+			cppMethodDefinitions.AppendLine("\t\t}");
+			cppMethodDefinitions.AppendLine("\t\tother.bufferCount = 0;");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
 			
-			ParameterInfo[] releaseParams = {
-				new ParameterInfo
-				{
-					Name = "handle",
-					ParameterType = typeof(int),
-					DereferencedParameterType = typeof(int),
-					IsOut = false,
-					IsRef = false,
-					Kind = TypeKind.Primitive
-				},
-				new ParameterInfo
-				{
-					Name = "classHandle",
-					ParameterType = typeof(int),
-					DereferencedParameterType = typeof(int),
-					IsOut = false,
-					IsRef = false,
-					Kind = TypeKind.Primitive
-				}};
+			// Destructor
+			if (isHandle)
+			{
+				cppMethodDefinitions.Append('\t');
+				cppMethodDefinitions.Append(iteratorTypeName);
+				cppMethodDefinitions.Append("::~");
+				cppMethodDefinitions.Append(iteratorTypeName);
+				cppMethodDefinitions.AppendLine("()");
+				cppMethodDefinitions.AppendLine("\t{");
+				cppMethodDefinitions.AppendLine("\t\tReleaseItems();");
+				cppMethodDefinitions.AppendLine("\t}");
+				cppMethodDefinitions.AppendLine("\t");
+			}
 			
-			ParameterInfo[] constructorParams = {
-				new ParameterInfo
-				{
-					Name = "cppHandle",
-					ParameterType = typeof(int),
-					DereferencedParameterType = typeof(int),
-					IsOut = false,
-					IsRef = false,
-					Kind = TypeKind.Primitive
-				},
-				new ParameterInfo
-				{
-					Name = "handle",
-					ParameterType = typeof(int),
-					DereferencedParameterType = typeof(int),
-					IsOut = true,
-					IsRef = false,
-					Kind = TypeKind.Primitive
-				},
-				new ParameterInfo
-				{
-					Name = "classHandle",
-					ParameterType = typeof(int),
-					DereferencedParameterType = typeof(int),
-					IsOut = true,
-					IsRef = false,
-					Kind = TypeKind.Primitive
-				}};
+			// operator++
+			cppMethodDefinitions.Append('\t');
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append("& ");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append("::");
+			cppMethodDefinitions.AppendLine("operator++()");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.AppendLine("\t\tindex++;");
+			cppMethodDefinitions.AppendLine("\t\treturn *this;");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
 			
-			AppendCppPointerFreeListStateAndFunctions(
-				GetTypeName(cppTypeName, type.Namespace),
-				typeParams,
-				bindingTypeName,
-				builders.CppGlobalStateAndFunctions);
-
-			AppendCppPointerFreeListInit(
-				typeParams,
-				GetTypeName(cppTypeName, type.Namespace),
-				maxSimultaneous,
-				bindingTypeName,
-				builders.CppInitBodyArrays,
-				builders.CppInitBodyFirstBoot);
-
-			// C++ type definition (begin)
-			AppendCppTypeDefinitionBegin(
-				GetTypeName(cppTypeName, type.Namespace),
-				TypeKind.Class,
-				typeParams,
-				GetTypeName(typeof(object)),
-				null,
-				null,
-				false,
-				indent,
-				builders.CppTypeDefinitions);
+			// operator!=
+			cppMethodDefinitions.Append("\tbool ");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append("::");
+			cppMethodDefinitions.Append("operator!=(const ");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.AppendLine("& other)");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.AppendLine("\t\treturn index != other.index;");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
 			
-			// C++ type fields
-			AppendIndent(
-				indent + 1,
-				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.AppendLine("int32_t CppHandle;");
-			AppendIndent(
-				indent + 1,
-				builders.CppTypeDefinitions);
-			builders.CppTypeDefinitions.AppendLine("int32_t ClassHandle;");
+			// operator*. Reads from the buffer, refilling it when the index
+			// has moved past the buffered chunk.
+			cppMethodDefinitions.Append('\t');
+			AppendCppTypeFullName(
+				elementType,
+				cppMethodDefinitions);
+			cppMethodDefinitions.Append(' ');
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append("::");
+			cppMethodDefinitions.AppendLine("operator*()");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.AppendLine("\t\tint32_t offset = index - bufferStart;");
+			cppMethodDefinitions.AppendLine("\t\tif (offset < 0 || offset >= bufferCount)");
+			cppMethodDefinitions.AppendLine("\t\t{");
+			cppMethodDefinitions.AppendLine("\t\t\tFetchItems();");
+			cppMethodDefinitions.AppendLine("\t\t\toffset = 0;");
+			cppMethodDefinitions.AppendLine("\t\t}");
+			if (isHandle)
+			{
+				cppMethodDefinitions.Append("\t\treturn ");
+				AppendCppTypeFullName(
+					elementType,
+					cppMethodDefinitions);
+				cppMethodDefinitions.AppendLine(
+					"(Plugin::InternalUse::Only, buffer[offset]);");
+			}
+			else
+			{
+				cppMethodDefinitions.AppendLine("\t\treturn buffer[offset];");
+			}
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
 			
-			// C++ method declarations
-			AppendIndent(
+			// FetchItems. Gets the next chunk of elements in one call. The
+			// length is only read from C# for the first chunk.
+			cppMethodDefinitions.Append("\tvoid ");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.AppendLine("::FetchItems()");
+			cppMethodDefinitions.AppendLine("\t{");
+			if (isHandle)
+			{
+				cppMethodDefinitions.AppendLine("\t\tReleaseItems();");
+			}
+			cppMethodDefinitions.AppendLine("\t\tif (length < 0)");
+			cppMethodDefinitions.AppendLine("\t\t{");
+			cppMethodDefinitions.AppendLine("\t\t\tlength = array.GetLength();");
+			cppMethodDefinitions.AppendLine("\t\t}");
+			cppMethodDefinitions.AppendLine("\t\tint32_t count = length - index;");
+			cppMethodDefinitions.AppendLine("\t\tif (count > ArrayIteratorChunkSize)");
+			cppMethodDefinitions.AppendLine("\t\t{");
+			cppMethodDefinitions.AppendLine("\t\t\tcount = ArrayIteratorChunkSize;");
+			cppMethodDefinitions.AppendLine("\t\t}");
+			cppMethodDefinitions.Append("\t\tPlugin::");
+			cppMethodDefinitions.Append(bindingArrayTypeName);
+			cppMethodDefinitions.AppendLine(
+				"GetItems(array.Handle, index, count, buffer);");
+			AppendCppUnhandledExceptionHandling(
+				2,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("\t\tbufferStart = index;");
+			cppMethodDefinitions.AppendLine("\t\tbufferCount = count;");
+			if (isHandle)
+			{
+				cppMethodDefinitions.AppendLine("\t\tfor (int32_t i = 0; i < count; ++i)");
+				cppMethodDefinitions.AppendLine("\t\t{");
+				cppMethodDefinitions.AppendLine("\t\t\tif (buffer[i])");
+				cppMethodDefinitions.AppendLine("\t\t\t{");
+				cppMethodDefinitions.Append("\t\t\t\t");
+				AppendCppArrayIteratorRefCountCall(
+					elementType,
+					elementTypeKind,
+					"Reference",
+					cppMethodDefinitions);
+				cppMethodDefinitions.AppendLine("\t\t\t}");
+				cppMethodDefinitions.AppendLine("\t\t}");
+			}
+			cppMethodDefinitions.AppendLine("\t}");
+			
+			// ReleaseItems. Drops the references held by the buffer.
+			if (isHandle)
+			{
+				cppMethodDefinitions.AppendLine("\t");
+				cppMethodDefinitions.Append("\tvoid ");
+				cppMethodDefinitions.Append(iteratorTypeName);
+				cppMethodDefinitions.AppendLine("::ReleaseItems()");
+				cppMethodDefinitions.AppendLine("\t{");
+				cppMethodDefinitions.AppendLine("\t\tfor (int32_t i = 0; i < bufferCount; ++i)");
+				cppMethodDefinitions.AppendLine("\t\t{");
+				cppMethodDefinitions.AppendLine("\t\t\tif (buffer[i])");
+				cppMethodDefinitions.AppendLine("\t\t\t{");
+				cppMethodDefinitions.Append("\t\t\t\t");
+				AppendCppArrayIteratorRefCountCall(
+					elementType,
+					elementTypeKind,
+					"Dereference",
+					cppMethodDefinitions);
+				cppMethodDefinitions.AppendLine("\t\t\t}");
+				cppMethodDefinitions.AppendLine("\t\t}");
+				cppMethodDefinitions.AppendLine("\t\tbufferCount = 0;");
+				cppMethodDefinitions.AppendLine("\t}");
+			}
+			cppMethodDefinitions.AppendLine("}");
+			cppMethodDefinitions.AppendLine();;
+			
+			// begin() and end() definitions
+			cppMethodDefinitions.AppendLine("namespace System");
+			cppMethodDefinitions.AppendLine("{");
+			cppMethodDefinitions.Append("\tPlugin::");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append(" begin(System::");
+			cppMethodDefinitions.Append(cppGenericArrayTypeName);
+			cppMethodDefinitions.AppendLine("& array)");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.Append("\t\treturn Plugin::");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.AppendLine("(array, 0);");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
+			cppMethodDefinitions.Append("\tPlugin::");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.Append(" end(System::");
+			cppMethodDefinitions.Append(cppGenericArrayTypeName);
+			cppMethodDefinitions.AppendLine("& array)");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.Append("\t\treturn Plugin::");
+			cppMethodDefinitions.Append(iteratorTypeName);
+			cppMethodDefinitions.AppendLine("(array, array.GetLength());");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("}");
+			cppMethodDefinitions.AppendLine();;
+		}
+		
+		static void AppendCppArrayIteratorRefCountCall(
+			Type elementType,
+			TypeKind elementTypeKind,
+			string operation,
+			StringBuilder output)
+		{
+			output.Append("Plugin::");
+			output.Append(operation);
+			output.Append("Managed");
+			if (elementTypeKind == TypeKind.ManagedStruct)
+			{
+				AppendReleaseFunctionNameSuffix(
+					GetTypeName(elementType),
+					elementType.GetGenericArguments(),
+					output);
+			}
+			else
+			{
+				output.Append("Class");
+			}
+			output.AppendLine("(buffer[i]);");
+		}
+		
+		static void AppendGenericEnumerableIterator(
+			Type enumerableType,
+			Type enumeratorType,
+			Type elementType,
+			string bindingEnumerableTypeName,
+			StringBuilder cppTypeDefinitions,
+			StringBuilder cppMethodDefinitions)
+		{
+			// Class elements are fetched from C# in chunks of handles that
+			// each hold a reference until the chunk is released
+			bool isBatched = GetTypeKind(elementType) == TypeKind.Class;
+			
+			// Iterator type definition
+			cppTypeDefinitions.AppendLine("namespace Plugin");
+			cppTypeDefinitions.AppendLine("{");
+			cppTypeDefinitions.Append("\tstruct ");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.AppendLine("Iterator");
+			cppTypeDefinitions.AppendLine("\t{");
+			cppTypeDefinitions.Append("\t\t");
+			AppendCppTypeFullName(
+				enumeratorType,
+				cppTypeDefinitions);
+			cppTypeDefinitions.AppendLine(" enumerator;");
+			cppTypeDefinitions.AppendLine("\t\tbool hasMore;");
+			if (isBatched)
+			{
+				cppTypeDefinitions.AppendLine("\t\tint32_t index;");
+				cppTypeDefinitions.AppendLine("\t\tint32_t count;");
+				cppTypeDefinitions.AppendLine("\t\tint32_t handles[EnumerableIteratorChunkSize];");
+			}
+			cppTypeDefinitions.Append("\t\t");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.AppendLine("Iterator(decltype(nullptr));");
+			cppTypeDefinitions.Append("\t\t");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.Append("Iterator(");
+			AppendCppTypeFullName(
+				enumerableType,
+				cppTypeDefinitions);
+			cppTypeDefinitions.AppendLine("& enumerable);");
+			if (isBatched)
+			{
+				cppTypeDefinitions.Append("\t\t");
+				cppTypeDefinitions.Append(bindingEnumerableTypeName);
+				cppTypeDefinitions.Append("Iterator(const ");
+				cppTypeDefinitions.Append(bindingEnumerableTypeName);
+				cppTypeDefinitions.AppendLine("Iterator& other) = delete;");
+				cppTypeDefinitions.Append("\t\t");
+				cppTypeDefinitions.Append(bindingEnumerableTypeName);
+				cppTypeDefinitions.Append("Iterator(");
+				cppTypeDefinitions.Append(bindingEnumerableTypeName);
+				cppTypeDefinitions.AppendLine("Iterator&& other);");
+			}
+			cppTypeDefinitions.Append("\t\t~");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.AppendLine("Iterator();");
+			cppTypeDefinitions.Append("\t\t");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.AppendLine("Iterator& operator++();");
+			cppTypeDefinitions.Append("\t\tbool operator!=(const ");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.AppendLine("Iterator& other);");
+			cppTypeDefinitions.Append("\t\t");
+			AppendCppTypeFullName(
+				elementType,
+				cppTypeDefinitions);
+			cppTypeDefinitions.AppendLine(" operator*();");
+			if (isBatched)
+			{
+				cppTypeDefinitions.AppendLine("\t\tvoid FetchItems();");
+				cppTypeDefinitions.AppendLine("\t\tvoid ReleaseItems();");
+			}
+			cppTypeDefinitions.AppendLine("\t};");
+			cppTypeDefinitions.AppendLine("}");
+			cppTypeDefinitions.AppendLine();;
+			
+			// begin() and end() declarations
+			int indent = AppendNamespaceBeginning(
+				enumerableType.Namespace,
+				cppTypeDefinitions);
+			AppendIndent(
+				indent,
+				cppTypeDefinitions);
+			cppTypeDefinitions.Append("Plugin::");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.Append("Iterator begin(");
+			AppendCppTypeFullName(
+				enumerableType,
+				cppTypeDefinitions);
+			cppTypeDefinitions.AppendLine("& enumerable);");
+			AppendIndent(
+				indent,
+				cppTypeDefinitions);
+			cppTypeDefinitions.Append("Plugin::");
+			cppTypeDefinitions.Append(bindingEnumerableTypeName);
+			cppTypeDefinitions.Append("Iterator end(");
+			AppendCppTypeFullName(
+				enumerableType,
+				cppTypeDefinitions);
+			cppTypeDefinitions.AppendLine("& enumerable);");
+			AppendNamespaceEnding(
+				indent,
+				cppTypeDefinitions);
+			cppTypeDefinitions.AppendLine();;
+			
+			// Iterator method definitions
+			cppMethodDefinitions.AppendLine("namespace Plugin");
+			cppMethodDefinitions.AppendLine("{");
+			cppMethodDefinitions.Append('\t');
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator::");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.AppendLine("Iterator(decltype(nullptr))");
+			cppMethodDefinitions.AppendLine("\t\t: enumerator(nullptr)");
+			cppMethodDefinitions.AppendLine("\t\t, hasMore(false)");
+			if (isBatched)
+			{
+				cppMethodDefinitions.AppendLine("\t\t, index(0)");
+				cppMethodDefinitions.AppendLine("\t\t, count(0)");
+			}
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
+			cppMethodDefinitions.Append('\t');
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator::");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator(");
+			AppendCppTypeFullName(
+				enumerableType,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("& enumerable)");
+			cppMethodDefinitions.AppendLine("\t\t: enumerator(enumerable.GetEnumerator())");
+			if (isBatched)
+			{
+				cppMethodDefinitions.AppendLine("\t\t, hasMore(true)");
+				cppMethodDefinitions.AppendLine("\t\t, index(0)");
+				cppMethodDefinitions.AppendLine("\t\t, count(0)");
+				cppMethodDefinitions.AppendLine("\t{");
+				cppMethodDefinitions.AppendLine("\t\tFetchItems();");
+			}
+			else
+			{
+				cppMethodDefinitions.AppendLine("\t{");
+				cppMethodDefinitions.AppendLine("\t\thasMore = enumerator.MoveNext();");
+			}
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
+			if (isBatched)
+			{
+				cppMethodDefinitions.Append('\t');
+				cppMethodDefinitions.Append(bindingEnumerableTypeName);
+				cppMethodDefinitions.Append("Iterator::");
+				cppMethodDefinitions.Append(bindingEnumerableTypeName);
+				cppMethodDefinitions.Append("Iterator(");
+				cppMethodDefinitions.Append(bindingEnumerableTypeName);
+				cppMethodDefinitions.AppendLine("Iterator&& other)");
+				cppMethodDefinitions.AppendLine("\t\t: enumerator(other.enumerator)");
+				cppMethodDefinitions.AppendLine("\t\t, hasMore(other.hasMore)");
+				cppMethodDefinitions.AppendLine("\t\t, index(other.index)");
+				cppMethodDefinitions.AppendLine("\t\t, count(other.count)");
+				cppMethodDefinitions.AppendLine("\t{");
+				cppMethodDefinitions.AppendLine("\t\tfor (int32_t i = 0; i < count; ++i)");
+				cppMethodDefinitions.AppendLine("\t\t{");
+				cppMethodDefinitions.AppendLine("\t\t\thandles[i] = other.handles[i];");
+				cppMethodDefinitions.AppendLine("\t\t}");
+				cppMethodDefinitions.AppendLine("\t\tother.count = 0;");
+				cppMethodDefinitions.AppendLine("\t\tother.enumerator = nullptr;");
+				cppMethodDefinitions.AppendLine("\t}");
+				cppMethodDefinitions.AppendLine("\t");
+			}
+			cppMethodDefinitions.Append('\t');
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator::~");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.AppendLine("Iterator()");
+			cppMethodDefinitions.AppendLine("\t{");
+			if (isBatched)
+			{
+				cppMethodDefinitions.AppendLine("\t\tReleaseItems();");
+			}
+			cppMethodDefinitions.AppendLine("\t\tif (enumerator != nullptr)");
+			cppMethodDefinitions.AppendLine("\t\t{");
+			cppMethodDefinitions.AppendLine("\t\t\tenumerator.Dispose();");
+			cppMethodDefinitions.AppendLine("\t\t}");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
+			cppMethodDefinitions.Append('\t');
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator& ");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator::");
+			cppMethodDefinitions.AppendLine("operator++()");
+			cppMethodDefinitions.AppendLine("\t{");
+			if (isBatched)
+			{
+				cppMethodDefinitions.AppendLine("\t\tindex++;");
+				cppMethodDefinitions.AppendLine("\t\tif (index == count && hasMore)");
+				cppMethodDefinitions.AppendLine("\t\t{");
+				cppMethodDefinitions.AppendLine("\t\t\tFetchItems();");
+				cppMethodDefinitions.AppendLine("\t\t}");
+			}
+			else
+			{
+				cppMethodDefinitions.AppendLine("\t\thasMore = enumerator.MoveNext();");
+			}
+			cppMethodDefinitions.AppendLine("\t\treturn *this;");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
+			cppMethodDefinitions.Append("\tbool ");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator::");
+			cppMethodDefinitions.Append("operator!=(const ");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.AppendLine("Iterator& other)");
+			cppMethodDefinitions.AppendLine("\t{");
+			cppMethodDefinitions.AppendLine(
+				isBatched
+					? "\t\treturn index < count;"
+					: "\t\treturn hasMore;");
+			cppMethodDefinitions.AppendLine("\t}");
+			cppMethodDefinitions.AppendLine("\t");
+			cppMethodDefinitions.Append('\t');
+			AppendCppTypeFullName(
+				elementType,
+				cppMethodDefinitions);
+			cppMethodDefinitions.Append(' ');
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator::");
+			cppMethodDefinitions.AppendLine("operator*()");
+			cppMethodDefinitions.AppendLine("\t{");
+			if (isBatched)
+			{
+				cppMethodDefinitions.Append("\t\treturn ");
+				AppendCppTypeFullName(
+					elementType,
+					cppMethodDefinitions);
+				cppMethodDefinitions.AppendLine(
+					"(Plugin::InternalUse::Only, handles[index]);");
+			}
+			else
+			{
+				cppMethodDefinitions.AppendLine("\t\treturn enumerator.GetCurrent();");
+			}
+			cppMethodDefinitions.AppendLine("\t}");
+			if (isBatched)
+			{
+				cppMethodDefinitions.AppendLine("\t");
+				cppMethodDefinitions.Append("\tvoid ");
+				cppMethodDefinitions.Append(bindingEnumerableTypeName);
+				cppMethodDefinitions.AppendLine("Iterator::FetchItems()");
+				cppMethodDefinitions.AppendLine("\t{");
+				cppMethodDefinitions.AppendLine("\t\tReleaseItems();");
+				cppMethodDefinitions.AppendLine("\t\tindex = 0;");
+				cppMethodDefinitions.AppendLine("\t\tcount = Plugin::EnumeratorMoveNextBatch(");
+				cppMethodDefinitions.AppendLine("\t\t\tenumerator.Handle,");
+				cppMethodDefinitions.AppendLine("\t\t\thandles,");
+				cppMethodDefinitions.AppendLine("\t\t\tEnumerableIteratorChunkSize);");
+				cppMethodDefinitions.AppendLine("\t\tfor (int32_t i = 0; i < count; ++i)");
+				cppMethodDefinitions.AppendLine("\t\t{");
+				cppMethodDefinitions.AppendLine("\t\t\tPlugin::ReferenceManagedClass(handles[i]);");
+				cppMethodDefinitions.AppendLine("\t\t}");
+				cppMethodDefinitions.AppendLine("\t\tif (Plugin::unhandledCsharpException)");
+				cppMethodDefinitions.AppendLine("\t\t{");
+				cppMethodDefinitions.AppendLine("\t\t\t// Release the elements fetched before the exception");
+				cppMethodDefinitions.AppendLine("\t\t\thasMore = false;");
+				cppMethodDefinitions.AppendLine("\t\t\tReleaseItems();");
+				cppMethodDefinitions.AppendLine("\t\t\tPlugin::ThrowUnhandledCsharpException();");
+				cppMethodDefinitions.AppendLine("\t\t}");
+				cppMethodDefinitions.AppendLine("\t\thasMore = count == EnumerableIteratorChunkSize;");
+				cppMethodDefinitions.AppendLine("\t}");
+				cppMethodDefinitions.AppendLine("\t");
+				cppMethodDefinitions.Append("\tvoid ");
+				cppMethodDefinitions.Append(bindingEnumerableTypeName);
+				cppMethodDefinitions.AppendLine("Iterator::ReleaseItems()");
+				cppMethodDefinitions.AppendLine("\t{");
+				cppMethodDefinitions.AppendLine("\t\tfor (int32_t i = 0; i < count; ++i)");
+				cppMethodDefinitions.AppendLine("\t\t{");
+				cppMethodDefinitions.AppendLine("\t\t\tPlugin::DereferenceManagedClass(handles[i]);");
+				cppMethodDefinitions.AppendLine("\t\t}");
+				cppMethodDefinitions.AppendLine("\t\tcount = 0;");
+				cppMethodDefinitions.AppendLine("\t}");
+			}
+			cppMethodDefinitions.AppendLine("}");
+			cppMethodDefinitions.AppendLine();;
+			
+			// begin() and end() definitions
+			indent = AppendNamespaceBeginning(
+				enumerableType.Namespace,
+				cppMethodDefinitions);
+			AppendIndent(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.Append("Plugin::");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator begin(");
+			AppendCppTypeFullName(
+				enumerableType,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("& enumerable)");
+			AppendIndent(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				cppMethodDefinitions);
+			cppMethodDefinitions.Append("return Plugin::");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.AppendLine("Iterator(enumerable);");
+			AppendIndent(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("}");
+			AppendIndent(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine();;
+			AppendIndent(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.Append("Plugin::");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.Append("Iterator end(");
+			AppendCppTypeFullName(
+				enumerableType,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("& enumerable)");
+			AppendIndent(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				cppMethodDefinitions);
+			cppMethodDefinitions.Append("return Plugin::");
+			cppMethodDefinitions.Append(bindingEnumerableTypeName);
+			cppMethodDefinitions.AppendLine("Iterator(nullptr);");
+			AppendIndent(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine("}");
+			AppendNamespaceEnding(
+				indent,
+				cppMethodDefinitions);
+			cppMethodDefinitions.AppendLine();;
+		}
+		
+		static void AppendCppArrayIndexOperatorMethodDefinition(
+			int rank,
+			int indent,
+			TypeName enclosingTypeTypeName,
+			string nextCppElementProxyTypeName,
+			StringBuilder output)
+		{
+			AppendIndent(
+				indent,
+				output);
+			AppendCppTypeFullName(
+				GetTypeName(nextCppElementProxyTypeName, "Plugin"),
+				output);
+			output.Append(' ');
+			output.Append(enclosingTypeTypeName.Namespace);
+			output.Append("::");
+			AppendTypeNameWithoutGenericSuffix(
+				enclosingTypeTypeName.Name,
+				output);
+			output.AppendLine("::operator[](int32_t index)");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				output);
+			output.Append("return Plugin::");
+			output.Append(nextCppElementProxyTypeName);
+			output.Append("(Plugin::InternalUse::Only, Handle, ");
+			for (int i = 0; i < rank; ++i)
+			{
+				output.Append("Index");
+				output.Append(i);
+				output.Append(", ");
+			}
+			output.AppendLine("index);");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("}");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine();;
+		}
+		
+		static void AppendCppArrayTypeName(
+			int rank,
+			StringBuilder output)
+		{
+			output.Append("Array");
+			output.Append(rank);
+		}
+		
+		static void AppendCppArrayElementProxyName(
+			int rank,
+			int maxRank,
+			Type elementType,
+			StringBuilder output)
+		{
+			output.Append("ArrayElementProxy");
+			output.Append(rank);
+			output.Append('_');
+			output.Append(maxRank);
+			output.Append('<');
+			AppendCppTypeFullName(
+				elementType,
+				output);
+			output.Append('>');
+		}
+
+		static ParameterInfo[] BuildArrayGetItemsParams(
+			int rank,
+			string indexName)
+		{
+			ParameterInfo[] parameters = new ParameterInfo[rank];
+			for (int i = 0; i < rank; ++i)
+			{
+				ParameterInfo param = new ParameterInfo();
+				param.Name = indexName + i;
+				param.ParameterType = typeof(int);
+				param.IsOut = false;
+				param.IsRef = false;
+				param.DereferencedParameterType = param.ParameterType;
+				param.Kind = GetTypeKind(
+					param.DereferencedParameterType);
+				parameters[i] = param;
+			}
+			return parameters;
+		}
+		
+		static ParameterInfo[] BuildArraySetItemsParams(
+			int rank,
+			string indexName,
+			Type elementType)
+		{
+			ParameterInfo[] parameters = new ParameterInfo[rank+1];
+			for (int i = 0; i < rank; ++i)
+			{
+				ParameterInfo param = new ParameterInfo();
+				param.Name = indexName + i;
+				param.ParameterType = typeof(int);
+				param.IsOut = false;
+				param.IsRef = false;
+				param.DereferencedParameterType = param.ParameterType;
+				param.Kind = GetTypeKind(
+					param.DereferencedParameterType);
+				parameters[i] = param;
+			}
+			
+			ParameterInfo lastParamInfo = new ParameterInfo();
+			lastParamInfo.Name = "item";
+			lastParamInfo.ParameterType = elementType;
+			lastParamInfo.IsOut = false;
+			lastParamInfo.IsRef = false;
+			lastParamInfo.DereferencedParameterType = lastParamInfo.ParameterType;
+			lastParamInfo.Kind = GetTypeKind(
+				lastParamInfo.DereferencedParameterType);
+			parameters[rank] = lastParamInfo;
+			
+			return parameters;
+		}
+		
+		static void AppendArrayGetItemFuncName(
+			TypeName elementTypeTypeName,
+			string bindingArrayTypeName,
+			int rank,
+			StringBuilder output)
+		{
+			AppendNamespace(
+				elementTypeTypeName.Namespace,
+				string.Empty,
+				output);
+			output.Append(elementTypeTypeName.Name);
+			AppendTypeNameWithoutGenericSuffix(
+				bindingArrayTypeName,
+				output);
+			output.Append("GetItem");
+			output.Append(rank);
+		}
+		
+		static void AppendArraySetItemFuncName(
+			TypeName elementTypeTypeName,
+			string bindingArrayTypeName,
+			int rank,
+			StringBuilder output)
+		{
+			AppendNamespace(
+				elementTypeTypeName.Namespace,
+				string.Empty,
+				output);
+			output.Append(elementTypeTypeName.Name);
+			AppendTypeNameWithoutGenericSuffix(
+				bindingArrayTypeName,
+				output);
+			output.Append("SetItem");
+			output.Append(rank);
+		}
+		
+		static void AppendArrayElementProxy(
+			Type elementType,
+			TypeKind elementTypeKind,
+			int rank,
+			int maxRank,
+			Type[] cppTypeParams,
+			string cppArrayTypeName,
+			StringBuilders builders)
+		{
+			// Build element proxy name
+			builders.TempStrBuilder.Length = 0;
+			AppendCppArrayElementProxyName(
+				rank,
+				maxRank,
+				elementType,
+				builders.TempStrBuilder);
+			string cppElementProxyTypeName = builders.TempStrBuilder.ToString();
+			
+			// Build next element proxy name
+			builders.TempStrBuilder.Length = 0;
+			AppendCppArrayElementProxyName(
+				rank + 1,
+				maxRank,
+				elementType,
+				builders.TempStrBuilder);
+			string nextCppElementProxyTypeName = builders.TempStrBuilder.ToString();
+			
+			// GetItem name
+			builders.TempStrBuilder.Length = 0;
+			AppendArrayGetItemFuncName(
+				GetTypeName(elementType),
+				cppArrayTypeName,
+				rank,
+				builders.TempStrBuilder);
+			string getItemFuncName = builders.TempStrBuilder.ToString();
+			
+			// SetItem name
+			builders.TempStrBuilder.Length = 0;
+			AppendArraySetItemFuncName(
+				GetTypeName(elementType),
+				cppArrayTypeName,
+				rank,
+				builders.TempStrBuilder);
+			string setItemFuncName = builders.TempStrBuilder.ToString();
+			
+			// GetItem call params
+			ParameterInfo[] getItemCallParams = BuildArrayGetItemsParams(
+				rank,
+				"Index");
+			
+			// SetItem params
+			ParameterInfo[] setItemCallParams = BuildArraySetItemsParams(
+				rank,
+				"Index",
+				elementType);
+			
+			// C++ element proxy type declaration
+			int indent = AppendNamespaceBeginning(
+				"Plugin",
+				builders.CppTemplateSpecializationDeclarations);
+			AppendIndent(indent, builders.CppTemplateSpecializationDeclarations);
+			builders.CppTemplateSpecializationDeclarations.Append("template<> struct ");
+			AppendTypeNameWithoutGenericSuffix(
+				cppElementProxyTypeName,
+				builders.CppTemplateSpecializationDeclarations);
+			builders.CppTemplateSpecializationDeclarations.AppendLine(";");
+			AppendNamespaceEnding(
+				indent,
+				builders.CppTemplateSpecializationDeclarations);
+			builders.CppTemplateSpecializationDeclarations.AppendLine();;
+			
+			// C++ element proxy type definition
+			AppendNamespaceBeginning(
+				"Plugin",
+				builders.CppTypeDefinitions);
+			AppendIndent(
+				indent,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append("template<> struct ");
+			builders.CppTypeDefinitions.Append(cppElementProxyTypeName);
+			builders.CppTypeDefinitions.AppendLine();;
+			AppendIndent(
+				indent,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("int32_t Handle;");
+			for (int i = 0; i < rank; ++i)
+			{
+				AppendIndent(
+					indent + 1,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append("int32_t Index");
+				builders.CppTypeDefinitions.Append(i);
+				builders.CppTypeDefinitions.AppendLine(";");
+			}
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append(cppElementProxyTypeName);
+			builders.CppTypeDefinitions.Append(
+				"(Plugin::InternalUse, int32_t handle, ");
+			for (int i = 0; i < rank; ++i)
+			{
+				builders.CppTypeDefinitions.Append("int32_t index");
+				builders.CppTypeDefinitions.Append(i);
+				if (i != rank - 1)
+				{
+					builders.CppTypeDefinitions.Append(", ");
+				}
+			}
+			builders.CppTypeDefinitions.AppendLine(");");
+			if (rank == maxRank)
+			{
+				AppendIndent(
+					indent + 1,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append("void operator=(");
+				AppendCppTypeFullName(
+					elementType,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.AppendLine(" item);");
+				AppendIndent(
+					indent + 1,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append("operator ");
+				AppendCppTypeFullName(
+					elementType,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.AppendLine("();");
+			}
+			else
+			{
+				AppendIndent(
+					indent + 1,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append("Plugin::");
+				AppendCppArrayElementProxyName(
+					rank + 1,
+					maxRank,
+					elementType,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append(" operator[](");
+				builders.CppTypeDefinitions.AppendLine("int32_t index);");
+			}
+			AppendIndent(
+				indent,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("};");
+			builders.CppTypeDefinitions.AppendLine("}");
+			builders.CppTypeDefinitions.AppendLine();;
+			
+			// C++ element proxy method definitions (beginning)
+			int cppMethodDefinitionsIndent = AppendNamespaceBeginning(
+				"Plugin",
+				builders.CppMethodDefinitions);
+			
+			// C++ element proxy constructor definition
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.Append(cppElementProxyTypeName);
+			builders.CppMethodDefinitions.Append(
+				"::ArrayElementProxy");
+			builders.CppMethodDefinitions.Append(rank);
+			builders.CppMethodDefinitions.Append('_');
+			builders.CppMethodDefinitions.Append(maxRank);
+			builders.CppMethodDefinitions.Append(
+				"(Plugin::InternalUse, int32_t handle, ");
+			for (int i = 0; i < rank; ++i)
+			{
+				builders.CppMethodDefinitions.Append("int32_t index");
+				builders.CppMethodDefinitions.Append(i);
+				if (i != rank - 1)
+				{
+					builders.CppMethodDefinitions.Append(", ");
+				}
+			}
+			builders.CppMethodDefinitions.AppendLine(")");
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				cppMethodDefinitionsIndent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("Handle = handle;");
+			for (int i = 0; i < rank; ++i)
+			{
+				AppendIndent(
+					cppMethodDefinitionsIndent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("Index");
+				builders.CppMethodDefinitions.Append(i);
+				builders.CppMethodDefinitions.Append(" = index");
+				builders.CppMethodDefinitions.Append(i);
+				builders.CppMethodDefinitions.AppendLine(";");
+			}
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("}");
+			AppendIndent(
+				cppMethodDefinitionsIndent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine();;
+			
+			if (rank == maxRank)
+			{
+				// C++ element proxy operator= definition
+				AppendIndent(
+					cppMethodDefinitionsIndent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("void ");
+				builders.CppMethodDefinitions.Append(cppElementProxyTypeName);
+				builders.CppMethodDefinitions.Append("::");
+				builders.CppMethodDefinitions.Append("operator=(");
+				AppendCppTypeFullName(
+					elementType,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine(" item)");
+				AppendIndent(
+					cppMethodDefinitionsIndent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("{");
+				AppendCppPluginFunctionCall(
+					false,
+					GetTypeName(cppArrayTypeName, "System"),
+					TypeKind.Class,
+					cppTypeParams,
+					typeof(void),
+					setItemFuncName,
+					setItemCallParams,
+					cppMethodDefinitionsIndent + 1,
+					builders.CppMethodDefinitions);
+				AppendIndent(
+					cppMethodDefinitionsIndent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("}");
+				AppendIndent(
+					cppMethodDefinitionsIndent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine();;
+				
+				// C++ element proxy type conversion operator definition
+				AppendIndent(
+					cppMethodDefinitionsIndent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append(cppElementProxyTypeName);
+				builders.CppMethodDefinitions.Append("::");
+				builders.CppMethodDefinitions.Append("operator ");
+				AppendCppTypeFullName(
+					elementType,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("()");
+				AppendIndent(
+					cppMethodDefinitionsIndent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("{");
+				AppendCppPluginFunctionCall(
+					false,
+					GetTypeName(cppArrayTypeName, "System"),
+					TypeKind.Class,
+					cppTypeParams,
+					elementType,
+					getItemFuncName,
+					getItemCallParams,
+					indent + 1,
+					builders.CppMethodDefinitions);
+				AppendCppMethodReturn(
+					elementType,
+					elementTypeKind,
+					indent + 1,
+					builders.CppMethodDefinitions);
+				AppendIndent(
+					cppMethodDefinitionsIndent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("}");
+			}
+			else
+			{
+				AppendCppArrayIndexOperatorMethodDefinition(
+					rank,
+					cppMethodDefinitionsIndent,
+					GetTypeName(cppElementProxyTypeName, "Plugin"),
+					nextCppElementProxyTypeName,
+					builders.CppMethodDefinitions);
+			}
+			
+			// C++ method definitions (ending)
+			AppendCppMethodDefinitionsEnd(
+				cppMethodDefinitionsIndent,
+				builders.CppMethodDefinitions);
+		}
+		
+		static void AppendArrayConstructor(
+			Type elementType,
+			Type arrayType,
+			string cppArrayTypeName,
+			int rank,
+			string csharpTypeName,
+			Type[] cppCtorInitTypes,
+			int indent,
+			StringBuilders builders)
+		{
+			builders.TempStrBuilder.Length = 0;
+			AppendNamespace(
+				elementType.Namespace,
+				string.Empty,
+				builders.TempStrBuilder);
+			AppendTypeNameWithoutGenericSuffix(
+				csharpTypeName,
+				builders.TempStrBuilder);
+			builders.TempStrBuilder.Append("Constructor");
+			builders.TempStrBuilder.Append(rank);
+			string funcName = builders.TempStrBuilder.ToString();
+			
+			ParameterInfo[] parameters = new ParameterInfo[rank];
+			for (int i = 0; i < rank; ++i)
+			{
+				ParameterInfo info = new ParameterInfo();
+				info.Name = "length" + i;
+				info.ParameterType = typeof(int);
+				info.IsOut = false;
+				info.IsRef = false;
+				info.DereferencedParameterType = info.ParameterType;
+				info.Kind = TypeKind.Primitive;
+				parameters[i] = info;
+			}
+
+			TypeName cppArrayTypeTypeName = GetTypeName(
+				cppArrayTypeName,
+				"System");
+			
+			// C# Delegate Type
+			AppendCsharpDelegateType(
+				funcName,
+				true,
+				arrayType,
+				TypeKind.Class,
+				arrayType,
+				parameters,
+				builders.CsharpDelegateTypes);
+			
+			// C# Init Call
+			AppendCsharpCsharpDelegate(
+				funcName,
+				builders.CsharpInitCall,
+				builders.CsharpCsharpDelegates);
+			
+			// C# Init Param
+
+			// C# function
+			AppendCsharpFunctionBeginning(
+				arrayType,
+				funcName,
+				true,
+				TypeKind.Class,
+				arrayType,
+				parameters,
+				builders.CsharpFunctions);
+			AppendHandleStoreTypeName(
+				arrayType,
+				builders.CsharpFunctions);
+			builders.CsharpFunctions.Append(".Store(new ");
+			AppendCsharpTypeFullName(
+				elementType,
+				builders.CsharpFunctions);
+			builders.CsharpFunctions.Append('[');
+			for (int i = 0; i < rank; ++i)
+			{
+				builders.CsharpFunctions.Append("length");
+				builders.CsharpFunctions.Append(i);
+				if (i != rank-1)
+				{
+					builders.CsharpFunctions.Append(", ");
+				}
+			}
+			builders.CsharpFunctions.Append("]);");
+			AppendCsharpFunctionReturn(
+				parameters,
+				arrayType,
+				TypeKind.Class,
+				null,
+				true,
+				builders.CsharpFunctions);
+			
+			// C++ function pointer definition
+			AppendCppFunctionPointerDefinition(
+				funcName,
+				true,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				arrayType,
+				builders.CppFunctionPointers);
+			
+			// C++ init body
+			AppendCppInitBodyFunctionPointerParameterRead(
+				funcName,
+				true,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				arrayType,
+				builders.CppInitBodyParameterReads);
+			
+			// C++ method declaration
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			AppendCppMethodDeclaration(
+				cppArrayTypeName,
+				false,
+				false,
+				false,
+				null,
+				null,
+				parameters,
+				builders.CppTypeDefinitions);
+			
+			// C++ method definition
+			Type[] cppTypeParams = { elementType };
+			AppendCppMethodDefinitionBegin(
+				GetTypeName(cppArrayTypeName, "System"),
+				null,
+				cppArrayTypeName,
+				cppTypeParams,
+				null,
+				parameters,
+				indent,
+				builders.CppMethodDefinitions);
+			string separator = ": ";
+			foreach (Type interfaceType in cppCtorInitTypes)
+			{
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append(separator);
+				AppendCppTypeFullName(
+					interfaceType,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("(nullptr)");
+				separator = ", ";
+			}
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("{");
+			AppendCppPluginFunctionCall(
+				true,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				cppTypeParams,
+				arrayType,
+				funcName,
+				parameters,
+				indent + 1,
+				builders.CppMethodDefinitions);
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"Handle = returnValue;");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"if (returnValue)");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"{");
+			AppendIndent(
+				indent + 2,
+				builders.CppMethodDefinitions);
+			AppendReferenceManagedHandleFunctionCall(
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				cppTypeParams,
+				"returnValue",
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(";");
+			if (rank > 1)
+			{
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("InternalLength = ");
+				for (int i = 0; i < rank; ++i)
+				{
+					builders.CppMethodDefinitions.Append("length");
+					builders.CppMethodDefinitions.Append(i);
+					if (i != rank - 1)
+					{
+						builders.CppMethodDefinitions.Append(" * ");
+					}
+				}
+				builders.CppMethodDefinitions.AppendLine(";");
+				for (int i = 0; i < rank; ++i)
+				{
+					AppendIndent(
+						indent + 2,
+						builders.CppMethodDefinitions);
+					builders.CppMethodDefinitions.Append("InternalLengths[");
+					builders.CppMethodDefinitions.Append(i);
+					builders.CppMethodDefinitions.Append("] = length");
+					builders.CppMethodDefinitions.Append(i);
+					builders.CppMethodDefinitions.AppendLine(";");
+				}
+			}
+			else
+			{
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine(
+					"InternalLength = length0;");
+			}
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"}");
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("}");
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine();;
+		}
+		
+		static void AppendArrayCppGetLengthFunction(
+			int indent,
+			string cppArrayTypeName,
+			Type[] cppTypeParams,
+			StringBuilders builders)
+		{
+			ParameterInfo[] parameters = new ParameterInfo[0];
+			
+			// C++ method declaration
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			AppendCppMethodDeclaration(
+				"GetLength",
+				false,
+				false,
+				false,
+				typeof(int),
+				null,
+				parameters,
+				builders.CppTypeDefinitions);
+			
+			// C++ method definition
+			AppendCppMethodDefinitionBegin(
+				GetTypeName(cppArrayTypeName, "System"),
+				typeof(int),
+				"GetLength",
+				cppTypeParams,
+				null,
+				parameters,
+				indent,
+				builders.CppMethodDefinitions);
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"int32_t returnVal = InternalLength;");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("if (returnVal == 0)");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 2,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"returnVal = Array::GetLength();");
+			AppendIndent(
+				indent + 2,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"InternalLength = returnVal;");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("};");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("return returnVal;");
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("}");
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine();;
+		}
+		
+		static void AppendArrayCppGetRankFunction(
+			int indent,
+			string cppArrayTypeName,
+			Type[] cppTypeParams,
+			int rank,
+			StringBuilders builders)
+		{
+			ParameterInfo[] parameters = new ParameterInfo[0];
+			
+			// C++ method declaration
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			AppendCppMethodDeclaration(
+				"GetRank",
+				false,
+				false,
+				false,
+				typeof(int),
+				null,
+				parameters,
+				builders.CppTypeDefinitions);
+			
+			// C++ method definition
+			AppendCppMethodDefinitionBegin(
+				GetTypeName(cppArrayTypeName, "System"),
+				typeof(int),
+				"GetRank",
+				cppTypeParams,
+				null,
+				parameters,
+				indent,
+				builders.CppMethodDefinitions);
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.Append("return ");
+			builders.CppMethodDefinitions.Append(rank);
+			builders.CppMethodDefinitions.AppendLine(";");
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("}");
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine();;
+		}
+		
+		static void AppendArrayMultidimensionalGetLength(
+			Type elementType,
+			Type arrayType,
+			string cppArrayTypeName,
+			int rank,
+			string csharpTypeName,
+			int indent,
+			StringBuilders builders)
+		{
+			builders.TempStrBuilder.Length = 0;
+			AppendNamespace(
+				elementType.Namespace,
+				string.Empty,
+				builders.TempStrBuilder);
+			AppendTypeNameWithoutGenericSuffix(
+				csharpTypeName,
+				builders.TempStrBuilder);
+			builders.TempStrBuilder.Append("GetLength");
+			builders.TempStrBuilder.Append(rank);
+			string funcName = builders.TempStrBuilder.ToString();
+			
+			ParameterInfo[] parameters = {
+				new ParameterInfo {
+					Name = "dimension",
+					ParameterType = typeof(int),
+					IsOut = false,
+					IsRef = false,
+					DereferencedParameterType = typeof(int),
+					Kind = TypeKind.Primitive,
+				}
+			};
+
+			TypeName cppArrayTypeTypeName = GetTypeName(
+				cppArrayTypeName,
+				"System");
+			
+			// C# Delegate Type
+			AppendCsharpDelegateType(
+				funcName,
+				false,
+				arrayType,
+				TypeKind.Class,
+				typeof(int),
+				parameters,
+				builders.CsharpDelegateTypes);
+			
+			// C# Init Call
+			AppendCsharpCsharpDelegate(
+				funcName,
+				builders.CsharpInitCall,
+				builders.CsharpCsharpDelegates);
+			
+			// C# Init Param
+
+			// C# function
+			AppendCsharpFunctionBeginning(
+				arrayType,
+				funcName,
+				false,
+				TypeKind.Class,
+				typeof(int),
+				parameters,
+				builders.CsharpFunctions);
+			builders.CsharpFunctions.Append(
+				"thiz.GetLength(dimension);");
+			AppendCsharpFunctionReturn(
+				parameters,
+				typeof(int),
+				TypeKind.Primitive,
+				null,
+				false,
+				builders.CsharpFunctions);
+			
+			// C++ function pointer definition
+			AppendCppFunctionPointerDefinition(
+				funcName,
+				false,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				arrayType,
+				builders.CppFunctionPointers);
+			
+			// C++ init body
+			AppendCppInitBodyFunctionPointerParameterRead(
+				funcName,
+				false,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				arrayType,
+				builders.CppInitBodyParameterReads);
+			
+			// C++ method declaration
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			AppendCppMethodDeclaration(
+				"GetLength",
+				false,
+				false,
+				false,
+				typeof(int),
+				null,
+				parameters,
+				builders.CppTypeDefinitions);
+			
+			// C++ method definition
+			Type[] cppTypeParams = { elementType };
+			AppendCppMethodDefinitionBegin(
+				GetTypeName(cppArrayTypeName, "System"),
+				typeof(int),
+				"GetLength",
+				cppTypeParams,
+				null,
+				parameters,
+				indent,
+				builders.CppMethodDefinitions);
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.Append(
+				"assert(dimension >= 0 && dimension < ");
+			builders.CppMethodDefinitions.Append(rank);
+			builders.CppMethodDefinitions.AppendLine(");");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"int32_t length = InternalLengths[dimension];");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("if (length)");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("{");
+			AppendIndent(
+				indent + 2,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("return length;");
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("}");
+			AppendCppPluginFunctionCall(
+				false,
+				GetTypeName(cppArrayTypeName, "System"),
+				TypeKind.Class,
+				cppTypeParams,
+				typeof(int),
+				funcName,
+				parameters,
+				indent + 1,
+				builders.CppMethodDefinitions);
+			AppendIndent(
+				indent + 1,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine(
+				"InternalLengths[dimension] = returnValue;");
+			AppendCppMethodReturn(
+				typeof(int),
+				TypeKind.Primitive,
+				indent + 1,
+				builders.CppMethodDefinitions);
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine("}");
+			AppendIndent(
+				indent,
+				builders.CppMethodDefinitions);
+			builders.CppMethodDefinitions.AppendLine();;
+		}
+		
+		static void AppendArrayGetItem(
+			Type elementType,
+			TypeKind elementTypeKind,
+			Type arrayType,
+			string cppArrayTypeName,
+			int rank,
+			StringBuilders builders)
+		{
+			builders.TempStrBuilder.Length = 0;
+			AppendArrayGetItemFuncName(
+				GetTypeName(elementType),
+				cppArrayTypeName,
+				rank,
+				builders.TempStrBuilder);
+			string funcName = builders.TempStrBuilder.ToString();
+			
+			ParameterInfo[] parameters = BuildArrayGetItemsParams(
+				rank,
+				"index");
+			
+			// C# Delegate Type
+			AppendCsharpDelegateType(
+				funcName,
+				false,
+				arrayType,
+				TypeKind.Class,
+				elementType,
+				parameters,
+				builders.CsharpDelegateTypes);
+			
+			// C# Init Call
+			AppendCsharpCsharpDelegate(
+				funcName,
+				builders.CsharpInitCall,
+				builders.CsharpCsharpDelegates);
+			
+			// C# Init Param
+
+			// C# function
+			AppendCsharpFunctionBeginning(
+				arrayType,
+				funcName,
+				false,
+				TypeKind.Class,
+				elementType,
+				parameters,
+				builders.CsharpFunctions);
+			builders.CsharpFunctions.Append("thiz[");
+			for (int i = 0; i < rank; ++i)
+			{
+				builders.CsharpFunctions.Append("index");
+				builders.CsharpFunctions.Append(i);
+				if (i != rank-1)
+				{
+					builders.CsharpFunctions.Append(", ");
+				}
+			}
+			builders.CsharpFunctions.Append("];");
+			AppendCsharpFunctionReturn(
+				parameters,
+				elementType,
+				elementTypeKind,
+				null,
+				false,
+				builders.CsharpFunctions);
+
+			TypeName cppArrayTypeTypeName = GetTypeName(
+				"System",
+				cppArrayTypeName);
+
+			// C++ function pointer definition
+			AppendCppFunctionPointerDefinition(
+				funcName,
+				false,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				elementType,
+				builders.CppFunctionPointers);
+			
+			// C++ init body
+			AppendCppInitBodyFunctionPointerParameterRead(
+				funcName,
+				false,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				elementType,
+				builders.CppInitBodyParameterReads);
+		}
+		
+		static void AppendArraySetItem(
+			Type elementType,
+			Type arrayType,
+			string cppArrayTypeName,
+			int rank,
+			StringBuilders builders)
+		{
+			builders.TempStrBuilder.Length = 0;
+			AppendArraySetItemFuncName(
+				GetTypeName(elementType),
+				cppArrayTypeName,
+				rank,
+				builders.TempStrBuilder);
+			string funcName = builders.TempStrBuilder.ToString();
+			
+			// Build parameters as indexes then element
+			ParameterInfo[] parameters = BuildArraySetItemsParams(
+				rank,
+				"index",
+				elementType);
+			
+			// C# Delegate Type
+			AppendCsharpDelegateType(
+				funcName,
+				false,
+				arrayType,
+				TypeKind.Class,
+				typeof(void),
+				parameters,
+				builders.CsharpDelegateTypes);
+			
+			// C# Init Call
+			AppendCsharpCsharpDelegate(
+				funcName,
+				builders.CsharpInitCall,
+				builders.CsharpCsharpDelegates);
+			
+			// C# Init Param
+
+			// C# function
+			AppendCsharpFunctionBeginning(
+				arrayType,
+				funcName,
+				false,
+				TypeKind.Class,
+				typeof(void),
+				parameters,
+				builders.CsharpFunctions);
+			builders.CsharpFunctions.Append("thiz[");
+			for (int i = 0; i < rank; ++i)
+			{
+				builders.CsharpFunctions.Append("index");
+				builders.CsharpFunctions.Append(i);
+				if (i != rank-1)
+				{
+					builders.CsharpFunctions.Append(", ");
+				}
+			}
+			builders.CsharpFunctions.Append("] = item;");
+			AppendCsharpFunctionReturn(
+				parameters,
+				typeof(void),
+				TypeKind.None,
+				null,
+				false,
+				builders.CsharpFunctions);
+
+			TypeName cppArrayTypeTypeName = GetTypeName(
+				"System",
+				cppArrayTypeName);
+
+			// C++ function pointer definition
+			AppendCppFunctionPointerDefinition(
+				funcName,
+				false,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				arrayType,
+				builders.CppFunctionPointers);
+			
+			// C++ init body
+			AppendCppInitBodyFunctionPointerParameterRead(
+				funcName,
+				false,
+				cppArrayTypeTypeName,
+				TypeKind.Class,
+				parameters,
+				arrayType,
+				builders.CppInitBodyParameterReads);
+		}
+		
+		static void AppendDelegate(
+			JsonDelegate jsonDelegate,
+			Assembly[] assemblies,
+			int defaultMaxSimultaneous,
+			StringBuilders builders)
+		{
+			Type type = GetType(
+				jsonDelegate.Type,
+				assemblies);
+			if (jsonDelegate.GenericParams != null)
+			{
+				for (int i = 0; i < jsonDelegate.GenericParams.Length; ++i)
+				{
+					// C++ template declaration
+					AppendCppTemplateDeclaration(
+						GetTypeName(type),
+						builders.CppTemplateDeclarations);
+				}
+
+				foreach (JsonGenericParams jsonGenericParams
+					in jsonDelegate.GenericParams)
+				{
+					Type[] typeParams = GetTypes(
+						jsonGenericParams.Types,
+						assemblies);
+					Type genericType = type.MakeGenericType(typeParams);
+					
+					// Build numbered C++ class name (e.g. Action_2)
+					builders.TempStrBuilder.Length = 0;
+					AppendTypeNameWithoutSuffixes(
+						type.Name,
+						builders.TempStrBuilder);
+					builders.TempStrBuilder.Append('_');
+					builders.TempStrBuilder.Append(
+						jsonGenericParams.Types.Length);
+					string cppTypeName = builders.TempStrBuilder.ToString();
+					
+					// Max simultaneous handles of this type
+					int maxSimultaneous = jsonGenericParams.MaxSimultaneous != 0
+						? jsonGenericParams.MaxSimultaneous
+						: jsonDelegate.MaxSimultaneous != 0
+							? jsonDelegate.MaxSimultaneous
+							: defaultMaxSimultaneous;
+					
+					AppendDelegate(
+						genericType,
+						cppTypeName,
+						typeParams,
+						maxSimultaneous,
+						builders);
+				}
+			}
+			else
+			{
+				int maxSimultaneous = jsonDelegate.MaxSimultaneous != 0
+					? jsonDelegate.MaxSimultaneous
+					: defaultMaxSimultaneous;
+				AppendDelegate(
+					type,
+					type.Name,
+					null,
+					maxSimultaneous,
+					builders);
+			}
+		}
+
+		static void AppendDelegate(
+			Type type,
+			string cppTypeName,
+			Type[] typeParams,
+			int maxSimultaneous,
+			StringBuilders builders)
+		{
+			builders.TempStrBuilder.Length = 0;
+			AppendNamespace(
+				type.Namespace,
+				string.Empty,
+				builders.TempStrBuilder);
+			AppendTypeNameWithoutSuffixes(
+				type.Name,
+				builders.TempStrBuilder);
+			AppendTypeNames(
+				typeParams,
+				builders.TempStrBuilder);
+			string bindingTypeName = builders.TempStrBuilder.ToString();
+			
+			builders.TempStrBuilder.Length = 0;
+			builders.TempStrBuilder.Append("Release");
+			builders.TempStrBuilder.Append(bindingTypeName);
+			string releaseFuncName = builders.TempStrBuilder.ToString();
+			
+			builders.TempStrBuilder.Length = 0;
+			builders.TempStrBuilder.Append(bindingTypeName);
+			builders.TempStrBuilder.Append("Constructor");
+			string constructorFuncName = builders.TempStrBuilder.ToString();
+			
+			builders.TempStrBuilder.Length = 0;
+			builders.TempStrBuilder.Append(bindingTypeName);
+			builders.TempStrBuilder.Append("Add");
+			string addFuncName = builders.TempStrBuilder.ToString();
+			
+			builders.TempStrBuilder.Length = 0;
+			builders.TempStrBuilder.Append(bindingTypeName);
+			builders.TempStrBuilder.Append("Remove");
+			string removeFuncName = builders.TempStrBuilder.ToString();
+			
+			TypeName typeTypeName = GetTypeName(type);
+
+			// C++ type declaration
+			int indent = AppendCppTypeDeclaration(
+				typeTypeName,
+				false,
+				typeParams,
+				typeParams != null ?
+					builders.CppTemplateSpecializationDeclarations :
+					builders.CppTypeDeclarations);
+			
+			ParameterInfo[] addRemoveParams = {
+				new ParameterInfo
+				{
+					Name = "del",
+					ParameterType = type,
+					DereferencedParameterType = type,
+					IsOut = false,
+					IsRef = false,
+					Kind = TypeKind.Class,
+					IsVirtual = true
+				}};
+			
+			ParameterInfo[] releaseParams = {
+				new ParameterInfo
+				{
+					Name = "handle",
+					ParameterType = typeof(int),
+					DereferencedParameterType = typeof(int),
+					IsOut = false,
+					IsRef = false,
+					Kind = TypeKind.Primitive
+				},
+				new ParameterInfo
+				{
+					Name = "classHandle",
+					ParameterType = typeof(int),
+					DereferencedParameterType = typeof(int),
+					IsOut = false,
+					IsRef = false,
+					Kind = TypeKind.Primitive
+				}};
+			
+			ParameterInfo[] constructorParams = {
+				new ParameterInfo
+				{
+					Name = "cppHandle",
+					ParameterType = typeof(int),
+					DereferencedParameterType = typeof(int),
+					IsOut = false,
+					IsRef = false,
+					Kind = TypeKind.Primitive
+				},
+				new ParameterInfo
+				{
+					Name = "cppPointer",
+					ParameterType = typeof(IntPtr),
+					DereferencedParameterType = typeof(IntPtr),
+					IsOut = false,
+					IsRef = false,
+					Kind = TypeKind.Primitive
+				},
+				new ParameterInfo
+				{
+					Name = "handle",
+					ParameterType = typeof(int),
+					DereferencedParameterType = typeof(int),
+					IsOut = true,
+					IsRef = false,
+					Kind = TypeKind.Primitive
+				},
+				new ParameterInfo
+				{
+					Name = "classHandle",
+					ParameterType = typeof(int),
+					DereferencedParameterType = typeof(int),
+					IsOut = true,
+					IsRef = false,
+					Kind = TypeKind.Primitive
+				}};
+			
+			AppendCppPointerFreeListStateAndFunctions(
+				GetTypeName(cppTypeName, type.Namespace),
+				typeParams,
+				bindingTypeName,
+				builders.CppGlobalStateAndFunctions);
+
+			AppendCppPointerFreeListInit(
+				typeParams,
+				GetTypeName(cppTypeName, type.Namespace),
+				maxSimultaneous,
+				bindingTypeName,
+				builders.CppInitBodyArrays,
+				builders.CppInitBodyFirstBoot,
+				builders.CppMemoryUsage);
+
+			// C++ type definition (begin)
+			AppendCppTypeDefinitionBegin(
+				GetTypeName(cppTypeName, type.Namespace),
+				TypeKind.Class,
+				typeParams,
+				GetTypeName(typeof(object)),
+				null,
+				null,
+				false,
+				indent,
+				builders.CppTypeDefinitions);
+			
+			// C++ type fields
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("int32_t CppHandle;");
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("int32_t ClassHandle;");
+			
+			// C++ method declarations
+			AppendIndent(
 				indent + 1,
 				builders.CppTypeDefinitions);
 			AppendCppMethodDeclaration(
@@ -6596,7 +8606,6 @@ namespace NativeScript.Editor
 				typeTypeName,
 				typeParams,
 				true,
-				string.Empty,
 				releaseFuncName,
 				bindingTypeName,
 				cppMethodDefinitionsIndent,
@@ -6719,6 +8728,7 @@ namespace NativeScript.Editor
 			
 			// C# class fields
 			builders.CsharpBaseTypes.AppendLine("\tpublic int CppHandle;");
+			builders.CsharpBaseTypes.AppendLine("\tpublic IntPtr CppPointer;");
 			builders.CsharpBaseTypes.Append("\tpublic ");
 			AppendCsharpTypeFullName(
 				type,
@@ -6729,9 +8739,10 @@ namespace NativeScript.Editor
 			// C# class constructor
 			builders.CsharpBaseTypes.Append("\tpublic ");
 			builders.CsharpBaseTypes.Append(bindingTypeName);
-			builders.CsharpBaseTypes.AppendLine("(int cppHandle)");
+			builders.CsharpBaseTypes.AppendLine("(int cppHandle, IntPtr cppPointer)");
 			builders.CsharpBaseTypes.AppendLine("\t{");
 			builders.CsharpBaseTypes.AppendLine("\t\tCppHandle = cppHandle;");
+			builders.CsharpBaseTypes.AppendLine("\t\tCppPointer = cppPointer;");
 			builders.CsharpBaseTypes.AppendLine("\t\tDelegate = NativeInvoke;");
 			builders.CsharpBaseTypes.AppendLine("\t}");
 			builders.CsharpBaseTypes.AppendLine("\t");
@@ -6969,7 +8980,7 @@ namespace NativeScript.Editor
 					true,
 					jsonCtor.ParamTypes);
 				int numParams = parameters.Length;
-				ParameterInfo[] fullParams = new ParameterInfo[numParams + 2];
+				ParameterInfo[] fullParams = new ParameterInfo[numParams + 3];
 				fullParams[0] = new ParameterInfo
 				{
 					Name = "cppHandle",
@@ -6980,6 +8991,15 @@ namespace NativeScript.Editor
 					Kind = TypeKind.Primitive
 				};
 				fullParams[1] = new ParameterInfo
+				{
+					Name = "cppPointer",
+					ParameterType = typeof(IntPtr),
+					DereferencedParameterType = typeof(IntPtr),
+					IsOut = false,
+					IsRef = false,
+					Kind = TypeKind.Primitive
+				};
+				fullParams[2] = new ParameterInfo
 				{
 					Name = "handle",
 					ParameterType = typeof(int),
@@ -6992,7 +9012,7 @@ namespace NativeScript.Editor
 					parameters,
 					0,
 					fullParams,
-					2,
+					3,
 					numParams);
 				
 				constructorFuncNames[i] = constructorFuncName;
@@ -7033,7 +9053,8 @@ namespace NativeScript.Editor
 				maxSimultaneous,
 				baseTypeTypeName.Name,
 				builders.CppInitBodyArrays,
-				builders.CppInitBodyFirstBoot);
+				builders.CppInitBodyFirstBoot,
+				builders.CppMemoryUsage);
 			
 			// C++ type declaration
 			int indent = AppendCppTypeDeclaration(
@@ -7356,7 +9377,6 @@ namespace NativeScript.Editor
 				baseTypeTypeName,
 				typeParams,
 				false,
-				derivedTypeTypeName.Name,
 				releaseFuncName,
 				baseTypeTypeName.Name,
 				cppMethodDefinitionsIndent,
@@ -7406,13 +9426,16 @@ namespace NativeScript.Editor
 				AppendCppWholeObjectFreeListStateAndFunctions(
 					null,
 					baseTypeTypeName,
+					derivedTypeTypeName,
 					baseTypeTypeName.Name,
 					builders.CppGlobalStateAndFunctions);
 				AppendCppWholeObjectFreeListInit(
+					derivedTypeTypeName,
 					maxSimultaneous,
 					baseTypeTypeName.Name,
-					builders.CppInitBodyArrays,
-					builders.CppInitBodyFirstBoot);
+					builders.CppInitBodyColdArrays,
+					builders.CppInitBodyFirstBoot,
+					builders.CppMemoryUsage);
 				
 				// C++ binding function to create the base class
 				builders.TempStrBuilder.Length = 0;
@@ -7424,7 +9447,7 @@ namespace NativeScript.Editor
 					builders.CppMethodDefinitions);
 				builders.CppMethodDefinitions.Append("DLLEXPORT int32_t ");
 				builders.CppMethodDefinitions.Append(cppDefaultConstructorBindingFunctionName);
-				builders.CppMethodDefinitions.AppendLine("(int32_t handle)");
+				builders.CppMethodDefinitions.AppendLine("(int32_t handle, void** cppPointer)");
 				AppendIndent(
 					indent,
 					builders.CppMethodDefinitions);
@@ -7433,11 +9456,49 @@ namespace NativeScript.Editor
 					indent + 1,
 					builders.CppMethodDefinitions);
 				AppendCppTypeFullName(
-					baseTypeTypeName,
+					derivedTypeTypeName,
 					builders.CppMethodDefinitions);
 				builders.CppMethodDefinitions.Append("* memory = Plugin::StoreWhole");
 				builders.CppMethodDefinitions.Append(baseTypeTypeName.Name);
 				builders.CppMethodDefinitions.AppendLine("();");
+				
+				// Make the C# constructor throw if the pool can't grow
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("if (!memory)");
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("{");
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("System::String msg = \"Out of plugin memory for ");
+				AppendCppTypeFullName(
+					derivedTypeTypeName,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("\";");
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("System::Exception ex(msg);");
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("Plugin::SetException(ex.Handle);");
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("*cppPointer = nullptr;");
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("return 0;");
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("}");
 				AppendIndent(
 					indent + 1,
 					builders.CppMethodDefinitions);
@@ -7449,6 +9510,23 @@ namespace NativeScript.Editor
 					derivedTypeTypeName,
 					builders.CppMethodDefinitions);
 				builders.CppMethodDefinitions.AppendLine("(Plugin::InternalUse::Only, handle);");
+				if (jsonBaseType.HotFields != null)
+				{
+					AppendIndent(
+						indent + 1,
+						builders.CppMethodDefinitions);
+					builders.CppMethodDefinitions.Append("Plugin::Add");
+					builders.CppMethodDefinitions.Append(baseTypeTypeName.Name);
+					builders.CppMethodDefinitions.AppendLine("HotFields(thiz);");
+				}
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("*cppPointer = static_cast<");
+				AppendCppTypeFullName(
+					baseTypeTypeName,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("*>(thiz);");
 				AppendIndent(
 					indent + 1,
 					builders.CppMethodDefinitions);
@@ -7459,25 +9537,28 @@ namespace NativeScript.Editor
 				builders.CppMethodDefinitions.AppendLine("}");
 				builders.CppMethodDefinitions.AppendLine();
 
-				// C# usage of the C++ binding function to create from C# default constructor
-				ParameterInfo[] cppDefaultConstructorBindingFunctionParams = ConvertParameters(
-					new[] { typeof(int) });
-				AppendCsharpDelegate(
-					true,
-					GetTypeName(string.Empty, string.Empty),
-					null,
-					cppDefaultConstructorBindingFunctionName,
-					cppDefaultConstructorBindingFunctionParams,
-					typeof(int),
-					TypeKind.None,
-					builders.CsharpCppDelegates);
-				AppendCsharpImport(
-					GetTypeName(string.Empty, string.Empty),
-					null,
-					cppDefaultConstructorBindingFunctionName,
-					ConvertParameters(Type.EmptyTypes),
-					typeof(int),
-					builders.CsharpImports);
+				// C# usage of the C++ binding function to create from C# default constructor.
+				// The C++ object's pointer is returned via an out parameter, which the
+				// general delegate and import helpers don't support, so write them here.
+				builders.CsharpCppDelegates.AppendLine(
+					"\t\t[UnmanagedFunctionPointer(CallingConvention.Cdecl)]");
+				builders.CsharpCppDelegates.Append("\t\tpublic delegate int ");
+				builders.CsharpCppDelegates.Append(cppDefaultConstructorBindingFunctionName);
+				builders.CsharpCppDelegates.AppendLine(
+					"DelegateType(int param0, out System.IntPtr param1);");
+				builders.CsharpCppDelegates.Append("\t\tpublic static ");
+				builders.CsharpCppDelegates.Append(cppDefaultConstructorBindingFunctionName);
+				builders.CsharpCppDelegates.Append("DelegateType ");
+				builders.CsharpCppDelegates.Append(cppDefaultConstructorBindingFunctionName);
+				builders.CsharpCppDelegates.AppendLine(";");
+				builders.CsharpCppDelegates.AppendLine("\t\t");
+				builders.CsharpImports.AppendLine(
+					"\t\t[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]");
+				builders.CsharpImports.Append("\t\tpublic static extern int ");
+				builders.CsharpImports.Append(cppDefaultConstructorBindingFunctionName);
+				builders.CsharpImports.AppendLine(
+					"(int thisHandle, out System.IntPtr cppPointer);");
+				builders.CsharpImports.AppendLine("\t\t");
 				AppendCsharpGetDelegateCall(
 					GetTypeName(string.Empty, string.Empty),
 					null,
@@ -7508,6 +9589,24 @@ namespace NativeScript.Editor
 				builders.CppMethodDefinitions.Append("* instance = Plugin::Get");
 				builders.CppMethodDefinitions.Append(baseTypeTypeName.Name);
 				builders.CppMethodDefinitions.AppendLine("(cppHandle);");
+				if (jsonBaseType.HotFields != null)
+				{
+					AppendIndent(
+						indent + 1,
+						builders.CppMethodDefinitions);
+					builders.CppMethodDefinitions.Append("Plugin::Remove");
+					builders.CppMethodDefinitions.Append(baseTypeTypeName.Name);
+					builders.CppMethodDefinitions.AppendLine("HotFields(instance);");
+				}
+				if (jsonBaseType.GameObjectRegistry)
+				{
+					AppendIndent(
+						indent + 1,
+						builders.CppMethodDefinitions);
+					builders.CppMethodDefinitions.Append("Plugin::Remove");
+					builders.CppMethodDefinitions.Append(baseTypeTypeName.Name);
+					builders.CppMethodDefinitions.AppendLine("GameObject(instance);");
+				}
 				AppendIndent(
 					indent + 1,
 					builders.CppMethodDefinitions);
@@ -7516,6 +9615,14 @@ namespace NativeScript.Editor
 					baseTypeTypeName,
 					builders.CppMethodDefinitions);
 				builders.CppMethodDefinitions.AppendLine("();");
+				
+				// Free the memory only after the destructor is done using it
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("Plugin::RemoveWhole");
+				builders.CppMethodDefinitions.Append(baseTypeTypeName.Name);
+				builders.CppMethodDefinitions.AppendLine("(instance);");
 				AppendIndent(
 					indent,
 					builders.CppMethodDefinitions);
@@ -7537,6 +9644,7 @@ namespace NativeScript.Editor
 				ParameterInfo[] cppDestroyImportFunctionParams = ConvertParameters(
 					new Type[0]);
 				AppendCsharpImport(
+					false,
 					GetTypeName(string.Empty, string.Empty),
 					null,
 					cppDestroyBindingFunctionName,
@@ -7562,6 +9670,26 @@ namespace NativeScript.Editor
 				builders.CsharpDestroyQueueCases.Append(cppDestroyBindingFunctionName);
 				builders.CsharpDestroyQueueCases.AppendLine("(entry.CppHandle);");
 				builders.CsharpDestroyQueueCases.AppendLine("\t\t\t\t\t\t\tbreak;");
+				
+				// Scripts that batched spawning can add
+				if (typeof(MonoBehaviour).IsAssignableFrom(type))
+				{
+					builders.CppSpawnComponentEnumerators.Append("\t\t");
+					builders.CppSpawnComponentEnumerators.Append(baseTypeTypeName.Name);
+					builders.CppSpawnComponentEnumerators.AppendLine(",");
+					builders.CsharpSpawnComponentEnumerators.Append("\t\t\t");
+					builders.CsharpSpawnComponentEnumerators.Append(baseTypeTypeName.Name);
+					builders.CsharpSpawnComponentEnumerators.AppendLine(",");
+					builders.CsharpSpawnComponentCases.Append("\t\t\t\tcase SpawnComponent.");
+					builders.CsharpSpawnComponentCases.Append(baseTypeTypeName.Name);
+					builders.CsharpSpawnComponentCases.AppendLine(":");
+					builders.CsharpSpawnComponentCases.Append("\t\t\t\t\tgo.AddComponent<");
+					AppendCsharpTypeFullName(
+						baseTypeTypeName,
+						builders.CsharpSpawnComponentCases);
+					builders.CsharpSpawnComponentCases.AppendLine(">();");
+					builders.CsharpSpawnComponentCases.AppendLine("\t\t\t\t\tbreak;");
+				}
 			}
 
 			// C# class (beginning)
@@ -7583,7 +9711,82 @@ namespace NativeScript.Editor
 			
 			// C# class fields
 			builders.CsharpBaseTypes.AppendLine("\t\tpublic int CppHandle;");
+			builders.CsharpBaseTypes.AppendLine("\t\tpublic IntPtr CppPointer;");
 			builders.CsharpBaseTypes.AppendLine("\t\t");
+			
+			// C# detach from the C++ object when a snapshot from before it
+			// was created is restored
+			builders.CsharpBaseTypeSnapshotDetaches.Append("\t\t\t\t");
+			AppendCsharpTypeFullName(
+				baseTypeTypeName,
+				builders.CsharpBaseTypeSnapshotDetaches);
+			builders.CsharpBaseTypeSnapshotDetaches.Append(" detached");
+			builders.CsharpBaseTypeSnapshotDetaches.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotDetaches.Append(" = obj as ");
+			AppendCsharpTypeFullName(
+				baseTypeTypeName,
+				builders.CsharpBaseTypeSnapshotDetaches);
+			builders.CsharpBaseTypeSnapshotDetaches.AppendLine(";");
+			builders.CsharpBaseTypeSnapshotDetaches.Append("\t\t\t\tif (detached");
+			builders.CsharpBaseTypeSnapshotDetaches.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotDetaches.AppendLine(" != null)");
+			builders.CsharpBaseTypeSnapshotDetaches.AppendLine("\t\t\t\t{");
+			builders.CsharpBaseTypeSnapshotDetaches.Append("\t\t\t\t\tdetached");
+			builders.CsharpBaseTypeSnapshotDetaches.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotDetaches.AppendLine(".CppHandle = 0;");
+			builders.CsharpBaseTypeSnapshotDetaches.Append("\t\t\t\t\tdetached");
+			builders.CsharpBaseTypeSnapshotDetaches.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotDetaches.AppendLine(".CppPointer = IntPtr.Zero;");
+			builders.CsharpBaseTypeSnapshotDetaches.AppendLine("\t\t\t\t}");
+			
+			// C# remember the C++ object when a snapshot is saved
+			builders.CsharpBaseTypeSnapshotSaves.Append("\t\t\t\t");
+			AppendCsharpTypeFullName(
+				baseTypeTypeName,
+				builders.CsharpBaseTypeSnapshotSaves);
+			builders.CsharpBaseTypeSnapshotSaves.Append(" saved");
+			builders.CsharpBaseTypeSnapshotSaves.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotSaves.Append(" = obj as ");
+			AppendCsharpTypeFullName(
+				baseTypeTypeName,
+				builders.CsharpBaseTypeSnapshotSaves);
+			builders.CsharpBaseTypeSnapshotSaves.AppendLine(";");
+			builders.CsharpBaseTypeSnapshotSaves.Append("\t\t\t\tif (saved");
+			builders.CsharpBaseTypeSnapshotSaves.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotSaves.AppendLine(" != null)");
+			builders.CsharpBaseTypeSnapshotSaves.AppendLine("\t\t\t\t{");
+			builders.CsharpBaseTypeSnapshotSaves.Append("\t\t\t\t\tcppHandle = saved");
+			builders.CsharpBaseTypeSnapshotSaves.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotSaves.AppendLine(".CppHandle;");
+			builders.CsharpBaseTypeSnapshotSaves.Append("\t\t\t\t\tcppPointer = saved");
+			builders.CsharpBaseTypeSnapshotSaves.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotSaves.AppendLine(".CppPointer;");
+			builders.CsharpBaseTypeSnapshotSaves.AppendLine("\t\t\t\t}");
+			
+			// C# bind to the C++ object again when a snapshot from before it
+			// was released is restored
+			builders.CsharpBaseTypeSnapshotRebinds.Append("\t\t\t\t");
+			AppendCsharpTypeFullName(
+				baseTypeTypeName,
+				builders.CsharpBaseTypeSnapshotRebinds);
+			builders.CsharpBaseTypeSnapshotRebinds.Append(" rebound");
+			builders.CsharpBaseTypeSnapshotRebinds.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotRebinds.Append(" = obj as ");
+			AppendCsharpTypeFullName(
+				baseTypeTypeName,
+				builders.CsharpBaseTypeSnapshotRebinds);
+			builders.CsharpBaseTypeSnapshotRebinds.AppendLine(";");
+			builders.CsharpBaseTypeSnapshotRebinds.Append("\t\t\t\tif (rebound");
+			builders.CsharpBaseTypeSnapshotRebinds.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotRebinds.AppendLine(" != null)");
+			builders.CsharpBaseTypeSnapshotRebinds.AppendLine("\t\t\t\t{");
+			builders.CsharpBaseTypeSnapshotRebinds.Append("\t\t\t\t\trebound");
+			builders.CsharpBaseTypeSnapshotRebinds.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotRebinds.AppendLine(".CppHandle = cppHandle;");
+			builders.CsharpBaseTypeSnapshotRebinds.Append("\t\t\t\t\trebound");
+			builders.CsharpBaseTypeSnapshotRebinds.Append(baseTypeTypeName.Name);
+			builders.CsharpBaseTypeSnapshotRebinds.AppendLine(".CppPointer = cppPointers[handle];");
+			builders.CsharpBaseTypeSnapshotRebinds.AppendLine("\t\t\t\t}");
 
 			if (derivedTypeTypeName.Name != null)
 			{
@@ -7599,7 +9802,18 @@ namespace NativeScript.Editor
 					builders.CsharpBaseTypes.Append(
 						"\t\t\tCppHandle = NativeScript.Bindings.New");
 					builders.CsharpBaseTypes.Append(baseTypeTypeName.Name);
-					builders.CsharpBaseTypes.AppendLine("(handle);");
+					builders.CsharpBaseTypes.AppendLine("(handle, out CppPointer);");
+					builders.CsharpBaseTypes.AppendLine(
+						"\t\t\tif (NativeScript.Bindings.UnhandledCppException != null)");
+					builders.CsharpBaseTypes.AppendLine("\t\t\t{");
+					builders.CsharpBaseTypes.AppendLine(
+						"\t\t\t\tNativeScript.Bindings.ObjectStore.Remove(handle);");
+					builders.CsharpBaseTypes.AppendLine(
+						"\t\t\t\tException ex = NativeScript.Bindings.UnhandledCppException;");
+					builders.CsharpBaseTypes.AppendLine(
+						"\t\t\t\tNativeScript.Bindings.UnhandledCppException = null;");
+					builders.CsharpBaseTypes.AppendLine("\t\t\t\tthrow ex;");
+					builders.CsharpBaseTypes.AppendLine("\t\t\t}");
 					builders.CsharpBaseTypes.AppendLine("\t\t}");
 					builders.CsharpBaseTypes.AppendLine("\t\t");
 				}
@@ -7616,6 +9830,7 @@ namespace NativeScript.Editor
 				builders.CsharpBaseTypes.Append(baseTypeTypeName.Name);
 				builders.CsharpBaseTypes.AppendLine(", CppHandle);");
 				builders.CsharpBaseTypes.AppendLine("\t\t\t\tCppHandle = 0;");
+				builders.CsharpBaseTypes.AppendLine("\t\t\t\tCppPointer = IntPtr.Zero;");
 				builders.CsharpBaseTypes.AppendLine("\t\t\t}");
 				builders.CsharpBaseTypes.AppendLine("\t\t}");
 				builders.CsharpBaseTypes.AppendLine("\t\t");
@@ -7626,7 +9841,7 @@ namespace NativeScript.Editor
 			{
 				builders.CsharpBaseTypes.Append("\t\tpublic ");
 				builders.CsharpBaseTypes.Append(baseTypeTypeName.Name);
-				builders.CsharpBaseTypes.Append("(int cppHandle");
+				builders.CsharpBaseTypes.Append("(int cppHandle, IntPtr cppPointer");
 				ParameterInfo[] parameters = cppConstructorParams[i];
 				if (parameters.Length > 0)
 				{
@@ -7643,6 +9858,7 @@ namespace NativeScript.Editor
 				builders.CsharpBaseTypes.AppendLine(")");
 				builders.CsharpBaseTypes.AppendLine("\t\t{");
 				builders.CsharpBaseTypes.AppendLine("\t\t\tCppHandle = cppHandle;");
+				builders.CsharpBaseTypes.AppendLine("\t\t\tCppPointer = cppPointer;");
 				builders.CsharpBaseTypes.AppendLine("\t\t}");
 				builders.CsharpBaseTypes.AppendLine("\t\t");
 			}
@@ -7691,6 +9907,25 @@ namespace NativeScript.Editor
 				releaseParams,
 				builders.CsharpFunctions);
 			
+			// C# code that Unity messages run for the bindings. It goes in
+			// the overrides of C++ methods, so it's set up first.
+			builders.CsharpMessagePrologues.Clear();
+			if (jsonBaseType.GameObjectRegistry)
+			{
+				builders.CsharpMessagePrologues["Awake"] =
+					"\t\t\tif (CppHandle != 0)\n" +
+					"\t\t\t{\n" +
+					"\t\t\t\tNativeScript.Bindings.Register" +
+					baseTypeTypeName.Name +
+					"(CppPointer, gameObject.GetInstanceID());\n" +
+					"\t\t\t}\n";
+			}
+			if (typeof(MonoBehaviour).IsAssignableFrom(type))
+			{
+				builders.CsharpMessagePrologues["OnDestroy"] =
+					"\t\t\tNativeScript.Bindings.ObjectStore.MarkDestroyed(this);\n";
+			}
+			
 			// All abstract methods
 			foreach (MethodInfo methodInfo in type.GetMethods())
 			{
@@ -7818,239 +10053,1067 @@ namespace NativeScript.Editor
 						{
 							continue;
 						}
-						AppendBaseTypeProperty(
+						AppendBaseTypeProperty(
+							type,
+							baseTypeTypeName.Name,
+							baseTypeTypeName,
+							typeParams,
+							propertyInfo,
+							getMethodInfo,
+							setMethodInfo,
+							indent,
+							builders);
+					}
+				}
+			}
+			
+			// Specified virtual properties
+			if (jsonBaseType.OverrideProperties != null)
+			{
+				PropertyInfo[] properties = type.GetProperties();
+				foreach (JsonProperty jsonProperty in jsonBaseType.OverrideProperties)
+				{
+					PropertyInfo propertyInfo = null;
+					foreach (PropertyInfo curPropertyInfo in properties)
+					{
+						if (curPropertyInfo.Name == jsonProperty.Name)
+						{
+							propertyInfo = curPropertyInfo;
+							break;
+						}
+					}
+					if (propertyInfo == null)
+					{
+						// Throw an exception so the user knows what to fix in the JSON
+						StringBuilder errorBuilder = new StringBuilder(1024);
+						errorBuilder.Append("Property \"");
+						AppendCsharpTypeFullName(
+							type,
+							errorBuilder);
+						errorBuilder.Append('.');
+						errorBuilder.Append(jsonProperty.Name);
+						errorBuilder.Append(")\" not found");
+						throw new Exception(errorBuilder.ToString());
+					}
+					
+					MethodInfo getMethodInfo = propertyInfo.GetGetMethod();
+					MethodInfo setMethodInfo = propertyInfo.GetSetMethod();
+					if ((getMethodInfo == null || !getMethodInfo.IsVirtual) &&
+						(setMethodInfo == null || !setMethodInfo.IsVirtual))
+					{
+						// Throw an exception so the user knows what to fix in the JSON
+						StringBuilder errorBuilder = new StringBuilder(1024);
+						errorBuilder.Append("Property \"");
+						AppendCsharpTypeFullName(
+							type,
+							errorBuilder);
+						errorBuilder.Append('.');
+						errorBuilder.Append(jsonProperty.Name);
+						errorBuilder.Append(
+							")\" doesn't have either a virtual 'get' or 'set' to override");
+						throw new Exception(errorBuilder.ToString());
+					}
+					AppendBaseTypeProperty(
+						type,
+						baseTypeTypeName.Name,
+						baseTypeTypeName,
+						typeParams,
+						propertyInfo,
+						getMethodInfo,
+						setMethodInfo,
+						indent,
+						builders);
+				}
+			}
+			
+			// All abstract events
+			foreach (EventInfo eventInfo in type.GetEvents())
+			{
+				MethodInfo addMethodInfo = eventInfo.GetAddMethod();
+				MethodInfo removeMethodInfo = eventInfo.GetRemoveMethod();
+				if ((addMethodInfo == null || !addMethodInfo.IsAbstract) &&
+					(removeMethodInfo == null || !removeMethodInfo.IsAbstract))
+				{
+					continue;
+				}
+				AppendBaseTypeEvent(
+					type,
+					baseTypeTypeName,
+					typeParams,
+					eventInfo,
+					addMethodInfo,
+					removeMethodInfo,
+					indent,
+					builders);
+			}
+			
+			// All interface events
+			if (type.IsInterface)
+			{
+				foreach (Type interfaceType in type.GetInterfaces())
+				{
+					foreach (EventInfo eventInfo in interfaceType.GetEvents())
+					{
+						MethodInfo addMethodInfo = eventInfo.GetAddMethod();
+						MethodInfo removeMethodInfo = eventInfo.GetRemoveMethod();
+						if ((addMethodInfo == null || !addMethodInfo.IsAbstract) &&
+							(removeMethodInfo == null || !removeMethodInfo.IsAbstract))
+						{
+							continue;
+						}
+						AppendBaseTypeEvent(
 							type,
-							baseTypeTypeName.Name,
 							baseTypeTypeName,
 							typeParams,
-							propertyInfo,
-							getMethodInfo,
-							setMethodInfo,
+							eventInfo,
+							addMethodInfo,
+							removeMethodInfo,
 							indent,
 							builders);
 					}
 				}
 			}
 			
-			// Specified virtual properties
-			if (jsonBaseType.OverrideProperties != null)
+			// Specified virtual events
+			if (jsonBaseType.OverrideEvents != null)
 			{
-				PropertyInfo[] properties = type.GetProperties();
-				foreach (JsonProperty jsonProperty in jsonBaseType.OverrideProperties)
+				EventInfo[] events = type.GetEvents();
+				foreach (JsonEvent jsonEvent in jsonBaseType.OverrideEvents)
 				{
-					PropertyInfo propertyInfo = null;
-					foreach (PropertyInfo curPropertyInfo in properties)
+					EventInfo eventInfo = null;
+					foreach (EventInfo curEventInfo in events)
 					{
-						if (curPropertyInfo.Name == jsonProperty.Name)
+						if (curEventInfo.Name == jsonEvent.Name)
 						{
-							propertyInfo = curPropertyInfo;
+							eventInfo = curEventInfo;
 							break;
 						}
 					}
-					if (propertyInfo == null)
+					if (eventInfo == null)
 					{
 						// Throw an exception so the user knows what to fix in the JSON
 						StringBuilder errorBuilder = new StringBuilder(1024);
-						errorBuilder.Append("Property \"");
+						errorBuilder.Append("Event \"");
 						AppendCsharpTypeFullName(
 							type,
 							errorBuilder);
 						errorBuilder.Append('.');
-						errorBuilder.Append(jsonProperty.Name);
+						errorBuilder.Append(jsonEvent.Name);
 						errorBuilder.Append(")\" not found");
 						throw new Exception(errorBuilder.ToString());
 					}
 					
-					MethodInfo getMethodInfo = propertyInfo.GetGetMethod();
-					MethodInfo setMethodInfo = propertyInfo.GetSetMethod();
-					if ((getMethodInfo == null || !getMethodInfo.IsVirtual) &&
-						(setMethodInfo == null || !setMethodInfo.IsVirtual))
+					MethodInfo addMethodInfo = eventInfo.GetAddMethod();
+					MethodInfo removeMethodInfo = eventInfo.GetRemoveMethod();
+					if ((addMethodInfo == null || !addMethodInfo.IsVirtual) &&
+						(removeMethodInfo == null || !removeMethodInfo.IsVirtual))
 					{
 						// Throw an exception so the user knows what to fix in the JSON
 						StringBuilder errorBuilder = new StringBuilder(1024);
-						errorBuilder.Append("Property \"");
+						errorBuilder.Append("Event \"");
 						AppendCsharpTypeFullName(
 							type,
 							errorBuilder);
 						errorBuilder.Append('.');
-						errorBuilder.Append(jsonProperty.Name);
+						errorBuilder.Append(jsonEvent.Name);
 						errorBuilder.Append(
-							")\" doesn't have either a virtual 'get' or 'set' to override");
+							")\" doesn't have either a virtual 'add' or 'remove' to override");
 						throw new Exception(errorBuilder.ToString());
 					}
-					AppendBaseTypeProperty(
+					AppendBaseTypeEvent(
 						type,
-						baseTypeTypeName.Name,
 						baseTypeTypeName,
 						typeParams,
-						propertyInfo,
-						getMethodInfo,
-						setMethodInfo,
+						eventInfo,
+						addMethodInfo,
+						removeMethodInfo,
 						indent,
 						builders);
 				}
 			}
 			
-			// All abstract events
-			foreach (EventInfo eventInfo in type.GetEvents())
+			// Specified physics messages to record for C++
+			if (jsonBaseType.BatchedMessages != null)
 			{
-				MethodInfo addMethodInfo = eventInfo.GetAddMethod();
-				MethodInfo removeMethodInfo = eventInfo.GetRemoveMethod();
-				if ((addMethodInfo == null || !addMethodInfo.IsAbstract) &&
-					(removeMethodInfo == null || !removeMethodInfo.IsAbstract))
+				AppendBaseTypeBatchedMessages(
+					type,
+					baseTypeTypeName,
+					jsonBaseType.BatchedMessages,
+					indent,
+					builders);
+			}
+			
+			// Hot fields stored in columns instead of in the objects
+			if (jsonBaseType.HotFields != null)
+			{
+				if (string.IsNullOrEmpty(derivedTypeTypeName.Name))
 				{
-					continue;
+					// Throw an exception so the user knows what to fix in the JSON
+					StringBuilder errorBuilder = new StringBuilder(1024);
+					errorBuilder.Append("Base type \"");
+					AppendCsharpTypeFullName(
+						type,
+						errorBuilder);
+					errorBuilder.Append(
+						"\" has hot fields but no derived type");
+					throw new Exception(errorBuilder.ToString());
 				}
-				AppendBaseTypeEvent(
+				AppendBaseTypeHotFields(
+					baseTypeTypeName,
+					jsonBaseType.HotFields,
+					indent,
+					builders);
+			}
+			
+			// Lookup of objects by their GameObject without calling C#
+			if (jsonBaseType.GameObjectRegistry)
+			{
+				if (string.IsNullOrEmpty(derivedTypeTypeName.Name) ||
+					!typeof(MonoBehaviour).IsAssignableFrom(type))
+				{
+					// Throw an exception so the user knows what to fix in the JSON
+					StringBuilder errorBuilder = new StringBuilder(1024);
+					errorBuilder.Append("Base type \"");
+					AppendCsharpTypeFullName(
+						type,
+						errorBuilder);
+					errorBuilder.Append(
+						"\" has a GameObject registry but isn't a " +
+						"MonoBehaviour with a derived type");
+					throw new Exception(errorBuilder.ToString());
+				}
+				AppendBaseTypeGameObjectRegistry(
+					baseTypeTypeName,
+					indent,
+					builders);
+				
+				// C# message that registers the object once its GameObject
+				// can be accessed, which it can't be in the constructor
+				AppendBaseTypeMessage(
+					type,
+					"Awake",
+					builders);
+			}
+			
+			// C# message that marks the object destroyed for C++'s IsAlive
+			if (typeof(MonoBehaviour).IsAssignableFrom(type))
+			{
+				AppendBaseTypeMessage(
 					type,
+					"OnDestroy",
+					builders);
+			}
+			
+			// C# class (ending)
+			builders.CsharpBaseTypes.AppendLine("\t}");
+			builders.CsharpBaseTypes.AppendLine("}");
+			builders.CsharpBaseTypes.AppendLine();
+			
+			// C++ method definitions (end)
+			AppendCppMethodDefinitionsEnd(
+				indent,
+				builders.CppMethodDefinitions);
+
+			// C++ type definition (end)
+			AppendCppTypeDefinitionEnd(
+				false,
+				indent,
+				builders.CppTypeDefinitions);
+			
+			if (jsonBaseType.HotFields != null)
+			{
+				AppendBaseTypeHotFieldsTable(
 					baseTypeTypeName,
-					typeParams,
-					eventInfo,
-					addMethodInfo,
-					removeMethodInfo,
+					jsonBaseType.HotFields,
+					builders.CppTypeDefinitions);
+			}
+		}
+		
+		static void AppendBaseTypeNativeMethod(
+			Type type,
+			TypeName typeTypeName,
+			Type[] typeParams,
+			MethodInfo methodInfo,
+			bool typeIsDelegate,
+			int indent,
+			StringBuilders builders)
+		{
+			AppendCsharpGetDelegateCall(
+				GetTypeName(type),
+				typeParams,
+				methodInfo.Name,
+				builders.CsharpGetDelegateCalls);
+			
+			// Build the name of the C++ binding function that C# calls
+			builders.TempStrBuilder.Length = 0;
+			AppendNativeInvokeFuncName(
+				type,
+				typeParams,
+				methodInfo.Name,
+				builders.TempStrBuilder);
+			string nativeInvokeFuncName = builders.TempStrBuilder.ToString();
+			
+			AppendBaseTypeCppMethodCall(
+				type,
+				typeTypeName.Name,
+				typeTypeName,
+				typeParams,
+				methodInfo,
+				methodInfo.Name,
+				nativeInvokeFuncName,
+				methodInfo.Name,
+				IsNonDelegateClass(type),
+				typeIsDelegate,
+				indent,
+				builders);
+		}
+		
+		static void AppendIsAlive(
+			TypeName typeTypeName,
+			int indent,
+			StringBuilders builders)
+		{
+			// C++ method declaration
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine(
+				"// Check if the object is alive without calling C#. Only");
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine(
+				"// objects C# marked are seen as destroyed: C++ scripts whose");
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine(
+				"// OnDestroy ran and objects whose handle was released. Other");
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine(
+				"// destroyed objects, such as a GameObject, still seem alive.");
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("bool IsAlive() const;");
+			
+			// C++ method definition. C# sets the bit when the object is
+			// destroyed or its handle is released.
+			StringBuilder output = builders.CppMethodDefinitions;
+			AppendIndent(
+				indent,
+				output);
+			output.Append("bool ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("::IsAlive() const");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				output);
+			output.AppendLine("return Handle != 0 && !Plugin::IsDestroyed(Handle);");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("}");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine();
+		}
+		
+		// Unity physics messages that base types can record for C++ to
+		// handle all at once during the next update
+		static readonly string[] BatchedMessageNames = {
+			"OnCollisionEnter",
+			"OnCollisionStay",
+			"OnCollisionExit",
+			"OnTriggerEnter",
+			"OnTriggerStay",
+			"OnTriggerExit"
+		};
+		
+		static void AppendHotFieldsTableType(
+			TypeName typeTypeName,
+			JsonHotField[] hotFields,
+			StringBuilder output)
+		{
+			output.Append("SoaTable<");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.Append('*');
+			foreach (JsonHotField hotField in hotFields)
+			{
+				output.Append(", ");
+				output.Append(hotField.Type);
+			}
+			output.Append('>');
+		}
+		
+		static void AppendBaseTypeHotFields(
+			TypeName typeTypeName,
+			JsonHotField[] hotFields,
+			int indent,
+			StringBuilders builders)
+		{
+			// C++ row index field. It's set when the object is created from
+			// C# and stays -1 for objects created by C++ or when the table
+			// is full.
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("int32_t HotFieldsRow = -1;");
+			
+			for (int i = 0; i < hotFields.Length; ++i)
+			{
+				JsonHotField hotField = hotFields[i];
+				
+				// C++ field used when there's no row, such as while the
+				// constructor runs
+				AppendIndent(
+					indent + 1,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append(hotField.Type);
+				builders.CppTypeDefinitions.Append(' ');
+				builders.CppTypeDefinitions.Append(hotField.Name);
+				builders.CppTypeDefinitions.Append("Fallback = ");
+				if (string.IsNullOrEmpty(hotField.Default))
+				{
+					builders.CppTypeDefinitions.Append(hotField.Type);
+					builders.CppTypeDefinitions.Append("()");
+				}
+				else
+				{
+					builders.CppTypeDefinitions.Append(hotField.Default);
+				}
+				builders.CppTypeDefinitions.AppendLine(";");
+				
+				// C++ accessor declaration
+				AppendIndent(
+					indent + 1,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append(hotField.Type);
+				builders.CppTypeDefinitions.Append("& Get");
+				builders.CppTypeDefinitions.Append(hotField.Name);
+				builders.CppTypeDefinitions.AppendLine("();");
+				
+				// C++ accessor definition
+				AppendIndent(
 					indent,
-					builders);
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append(hotField.Type);
+				builders.CppMethodDefinitions.Append("& ");
+				AppendCppTypeFullName(
+					typeTypeName,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("::Get");
+				builders.CppMethodDefinitions.Append(hotField.Name);
+				builders.CppMethodDefinitions.AppendLine("()");
+				AppendIndent(
+					indent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("{");
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("if (HotFieldsRow < 0)");
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("{");
+				AppendIndent(
+					indent + 2,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("return ");
+				builders.CppMethodDefinitions.Append(hotField.Name);
+				builders.CppMethodDefinitions.AppendLine("Fallback;");
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("}");
+				AppendIndent(
+					indent + 1,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("return Plugin::");
+				builders.CppMethodDefinitions.Append(typeTypeName.Name);
+				builders.CppMethodDefinitions.Append("HotFields->GetColumn<Plugin::");
+				builders.CppMethodDefinitions.Append(typeTypeName.Name);
+				builders.CppMethodDefinitions.Append("HotFieldColumns::");
+				builders.CppMethodDefinitions.Append(hotField.Name);
+				builders.CppMethodDefinitions.AppendLine(">()[HotFieldsRow];");
+				AppendIndent(
+					indent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("}");
+				AppendIndent(
+					indent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine();
 			}
 			
-			// All interface events
-			if (type.IsInterface)
-			{
-				foreach (Type interfaceType in type.GetInterfaces())
-				{
-					foreach (EventInfo eventInfo in interfaceType.GetEvents())
-					{
-						MethodInfo addMethodInfo = eventInfo.GetAddMethod();
-						MethodInfo removeMethodInfo = eventInfo.GetRemoveMethod();
-						if ((addMethodInfo == null || !addMethodInfo.IsAbstract) &&
-							(removeMethodInfo == null || !removeMethodInfo.IsAbstract))
-						{
-							continue;
-						}
-						AppendBaseTypeEvent(
-							type,
-							baseTypeTypeName,
-							typeParams,
-							eventInfo,
-							addMethodInfo,
-							removeMethodInfo,
-							indent,
-							builders);
-					}
-				}
-			}
+			// C++ table state
+			StringBuilder output = builders.CppGlobalStateAndFunctions;
+			output.Append("\t// Hot fields of ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine(" objects");
+			output.AppendLine("\t");
+			output.Append('\t');
+			AppendHotFieldsTableType(
+				typeTypeName,
+				hotFields,
+				output);
+			output.Append("* ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFields;");
+			output.AppendLine("\t");
 			
-			// Specified virtual events
-			if (jsonBaseType.OverrideEvents != null)
+			// C++ function to add a row. It's added after the constructor
+			// runs, so it starts with what the constructor left in the
+			// fallback fields.
+			output.Append("\tvoid Add");
+			output.Append(typeTypeName.Name);
+			output.Append("HotFields(");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("* instance)");
+			output.AppendLine("\t{");
+			output.Append("\t\tint32_t row = ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFields->Length;");
+			output.Append("\t\tif (");
+			output.Append(typeTypeName.Name);
+			output.Append("HotFields->PushBack(instance");
+			foreach (JsonHotField hotField in hotFields)
+			{
+				output.Append(", instance->");
+				output.Append(hotField.Name);
+				output.Append("Fallback");
+			}
+			output.AppendLine("))");
+			output.AppendLine("\t\t{");
+			output.AppendLine("\t\t\tinstance->HotFieldsRow = row;");
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t}");
+			output.AppendLine("\t");
+			
+			// C++ function to remove a row, moving the last row into its place
+			output.Append("\tvoid Remove");
+			output.Append(typeTypeName.Name);
+			output.Append("HotFields(");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("* instance)");
+			output.AppendLine("\t{");
+			output.AppendLine("\t\tint32_t row = instance->HotFieldsRow;");
+			output.AppendLine("\t\tif (row >= 0)");
+			output.AppendLine("\t\t{");
+			output.Append("\t\t\t");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFields->RemoveAtSwapBack(row);");
+			output.Append("\t\t\tif (row < ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFields->Length)");
+			output.AppendLine("\t\t\t{");
+			output.Append("\t\t\t\t");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFields->GetColumn<0>()[row]->HotFieldsRow = row;");
+			output.AppendLine("\t\t\t}");
+			output.AppendLine("\t\t\tinstance->HotFieldsRow = -1;");
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t}");
+			output.AppendLine("\t");
+			
+			// C++ init. The table is empty when its memory is cleared on first
+			// boot and it keeps its rows across reloads. Its header is read
+			// by every accessor, so it goes with the frequently-used regions.
+			output = builders.CppInitBodyArrays;
+			output.Append("\tPlugin::");
+			output.Append(typeTypeName.Name);
+			output.Append("HotFields = Plugin::PlaceRegion<Plugin::");
+			AppendHotFieldsTableType(
+				typeTypeName,
+				hotFields,
+				output);
+			output.AppendLine(">(curMemory, 1);");
+			output.AppendLine("\t");
+		}
+		
+		static void AppendBaseTypeHotFieldsTable(
+			TypeName typeTypeName,
+			JsonHotField[] hotFields,
+			StringBuilder output)
+		{
+			output.AppendLine();
+			output.AppendLine("namespace Plugin");
+			output.AppendLine("{");
+			output.Append("\t// Columns of ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFields");
+			output.Append("\tstruct ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFieldColumns");
+			output.AppendLine("\t{");
+			output.AppendLine("\t\tenum");
+			output.AppendLine("\t\t{");
+			output.Append("\t\t\tInstance");
+			foreach (JsonHotField hotField in hotFields)
 			{
-				EventInfo[] events = type.GetEvents();
-				foreach (JsonEvent jsonEvent in jsonBaseType.OverrideEvents)
-				{
-					EventInfo eventInfo = null;
-					foreach (EventInfo curEventInfo in events)
-					{
-						if (curEventInfo.Name == jsonEvent.Name)
-						{
-							eventInfo = curEventInfo;
-							break;
-						}
-					}
-					if (eventInfo == null)
-					{
-						// Throw an exception so the user knows what to fix in the JSON
-						StringBuilder errorBuilder = new StringBuilder(1024);
-						errorBuilder.Append("Event \"");
-						AppendCsharpTypeFullName(
-							type,
-							errorBuilder);
-						errorBuilder.Append('.');
-						errorBuilder.Append(jsonEvent.Name);
-						errorBuilder.Append(")\" not found");
-						throw new Exception(errorBuilder.ToString());
-					}
-					
-					MethodInfo addMethodInfo = eventInfo.GetAddMethod();
-					MethodInfo removeMethodInfo = eventInfo.GetRemoveMethod();
-					if ((addMethodInfo == null || !addMethodInfo.IsVirtual) &&
-						(removeMethodInfo == null || !removeMethodInfo.IsVirtual))
-					{
-						// Throw an exception so the user knows what to fix in the JSON
-						StringBuilder errorBuilder = new StringBuilder(1024);
-						errorBuilder.Append("Event \"");
-						AppendCsharpTypeFullName(
-							type,
-							errorBuilder);
-						errorBuilder.Append('.');
-						errorBuilder.Append(jsonEvent.Name);
-						errorBuilder.Append(
-							")\" doesn't have either a virtual 'add' or 'remove' to override");
-						throw new Exception(errorBuilder.ToString());
-					}
-					AppendBaseTypeEvent(
-						type,
-						baseTypeTypeName,
-						typeParams,
-						eventInfo,
-						addMethodInfo,
-						removeMethodInfo,
-						indent,
-						builders);
-				}
+				output.AppendLine(",");
+				output.Append("\t\t\t");
+				output.Append(hotField.Name);
 			}
+			output.AppendLine();
+			output.AppendLine("\t\t};");
+			output.AppendLine("\t};");
+			output.AppendLine("\t");
+			output.Append("\t// Hot fields of the ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine(" objects C# created. There's");
+			output.AppendLine("\t// one packed row per object, so loops over a column only touch live");
+			output.AppendLine("\t// objects and do so in memory order.");
+			output.Append("\textern ");
+			AppendHotFieldsTableType(
+				typeTypeName,
+				hotFields,
+				output);
+			output.Append("* ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("HotFields;");
+			output.AppendLine("}");
+		}
+		
+		static void AppendBaseTypeGameObjectRegistry(
+			TypeName typeTypeName,
+			int indent,
+			StringBuilders builders)
+		{
+			// C++ instance ID field. It's set when C# calls Awake and stays 0
+			// until then.
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine("int32_t GameObjectInstanceId = 0;");
+			
+			// C++ lookup declaration
+			AppendIndent(
+				indent + 1,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.Append("static ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				builders.CppTypeDefinitions);
+			builders.CppTypeDefinitions.AppendLine(
+				"* FindByGameObject(int32_t gameObjectInstanceId);");
+			
+			// C++ lookup definition
+			StringBuilder output = builders.CppMethodDefinitions;
+			AppendIndent(
+				indent,
+				output);
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.Append("* ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("::FindByGameObject(int32_t gameObjectInstanceId)");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				output);
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.Append("** instance = Plugin::");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("sByGameObject->Find(gameObjectInstanceId);");
+			AppendIndent(
+				indent + 1,
+				output);
+			output.AppendLine(
+				"return instance && !Plugin::IsDestroyed((*instance)->Handle) ? *instance : nullptr;");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("}");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine();
+			
+			// C++ binding function for C# to register an object
+			string registerFuncName = "Register" + typeTypeName.Name;
+			AppendIndent(
+				indent,
+				output);
+			output.Append("DLLEXPORT void ");
+			output.Append(registerFuncName);
+			output.Append('(');
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("* thiz, int32_t gameObjectInstanceId)");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("{");
+			AppendIndent(
+				indent + 1,
+				output);
+			output.Append("Plugin::Add");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("GameObject(thiz, gameObjectInstanceId);");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine("}");
+			AppendIndent(
+				indent,
+				output);
+			output.AppendLine();
+			
+			// C++ registry state
+			output = builders.CppGlobalStateAndFunctions;
+			output.Append("\t// ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine(" objects by the instance ID of their GameObject");
+			output.AppendLine("\t");
+			output.Append("\tHashMap<int32_t, ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.Append("*>* ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("sByGameObject;");
+			output.AppendLine("\t");
+			
+			// C++ function to add an object to the registry
+			output.Append("\tvoid Add");
+			output.Append(typeTypeName.Name);
+			output.Append("GameObject(");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("* instance, int32_t gameObjectInstanceId)");
+			output.AppendLine("\t{");
+			output.Append("\t\t");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.Append("** registered = ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("sByGameObject->GetOrAdd(gameObjectInstanceId);");
+			output.AppendLine("\t\tif (registered)");
+			output.AppendLine("\t\t{");
+			output.AppendLine("\t\t\t*registered = instance;");
+			output.AppendLine("\t\t\tinstance->GameObjectInstanceId = gameObjectInstanceId;");
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t}");
+			output.AppendLine("\t");
 			
-			// C# class (ending)
-			builders.CsharpBaseTypes.AppendLine("\t}");
-			builders.CsharpBaseTypes.AppendLine("}");
-			builders.CsharpBaseTypes.AppendLine();
+			// C++ function to remove an object from the registry. Another
+			// object on the same GameObject may have replaced it.
+			output.Append("\tvoid Remove");
+			output.Append(typeTypeName.Name);
+			output.Append("GameObject(");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("* instance)");
+			output.AppendLine("\t{");
+			output.AppendLine("\t\tint32_t id = instance->GameObjectInstanceId;");
+			output.AppendLine("\t\tif (id)");
+			output.AppendLine("\t\t{");
+			output.Append("\t\t\t");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.Append("** registered = ");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("sByGameObject->Find(id);");
+			output.AppendLine("\t\t\tif (registered && *registered == instance)");
+			output.AppendLine("\t\t\t{");
+			output.Append("\t\t\t\t");
+			output.Append(typeTypeName.Name);
+			output.AppendLine("sByGameObject->Remove(id);");
+			output.AppendLine("\t\t\t}");
+			output.AppendLine("\t\t\tinstance->GameObjectInstanceId = 0;");
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t}");
+			output.AppendLine("\t");
 			
-			// C++ method definitions (end)
-			AppendCppMethodDefinitionsEnd(
-				indent,
-				builders.CppMethodDefinitions);
+			// C++ init. The map is empty when its memory is cleared on first
+			// boot and it keeps its entries across reloads. It's read by
+			// every lookup, so it goes with the frequently-used regions.
+			output = builders.CppInitBodyArrays;
+			output.Append("\tPlugin::");
+			output.Append(typeTypeName.Name);
+			output.Append("sByGameObject = Plugin::PlaceRegion<Plugin::HashMap<int32_t, ");
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			output.AppendLine("*>>(curMemory, 1);");
+			output.AppendLine("\t");
+			
+			// C# usage of the C++ binding function. It takes a pointer, which
+			// the general delegate and import helpers don't support, so write
+			// them here.
+			builders.CsharpCppDelegates.AppendLine(
+				"\t\t[UnmanagedFunctionPointer(CallingConvention.Cdecl)]");
+			builders.CsharpCppDelegates.Append("\t\tpublic delegate void ");
+			builders.CsharpCppDelegates.Append(registerFuncName);
+			builders.CsharpCppDelegates.AppendLine(
+				"DelegateType(System.IntPtr param0, int param1);");
+			builders.CsharpCppDelegates.Append("\t\tpublic static ");
+			builders.CsharpCppDelegates.Append(registerFuncName);
+			builders.CsharpCppDelegates.Append("DelegateType ");
+			builders.CsharpCppDelegates.Append(registerFuncName);
+			builders.CsharpCppDelegates.AppendLine(";");
+			builders.CsharpCppDelegates.AppendLine("\t\t");
+			builders.CsharpImports.AppendLine(
+				"\t\t[DllImport(PLUGIN_NAME, CallingConvention = CallingConvention.Cdecl)]");
+			builders.CsharpImports.Append("\t\tpublic static extern void ");
+			builders.CsharpImports.Append(registerFuncName);
+			builders.CsharpImports.AppendLine(
+				"(System.IntPtr thisPointer, int gameObjectInstanceId);");
+			builders.CsharpImports.AppendLine("\t\t");
+			AppendCsharpGetDelegateCall(
+				GetTypeName(string.Empty, string.Empty),
+				null,
+				registerFuncName,
+				builders.CsharpGetDelegateCalls);
 
-			// C++ type definition (end)
-			AppendCppTypeDefinitionEnd(
-				false,
-				indent,
-				builders.CppTypeDefinitions);
 		}
 		
-		static void AppendBaseTypeNativeMethod(
+		// Add a Unity message that runs the C# code the bindings need. If
+		// the base type declares the message, it's overridden and the base
+		// type's version is called afterward. Messages C++ overrides already
+		// ran the code before calling C++.
+		static void AppendBaseTypeMessage(
+			Type type,
+			string messageName,
+			StringBuilders builders)
+		{
+			string prologue;
+			if (!builders.CsharpMessagePrologues.TryGetValue(
+				messageName,
+				out prologue))
+			{
+				return;
+			}
+			builders.CsharpMessagePrologues.Remove(messageName);
+			
+			MethodInfo baseMethod = type.GetMethod(
+				messageName,
+				BindingFlags.Instance |
+				BindingFlags.Public |
+				BindingFlags.NonPublic,
+				null,
+				Type.EmptyTypes,
+				null);
+			StringBuilder output = builders.CsharpBaseTypes;
+			if (baseMethod == null)
+			{
+				output.Append("\t\tvoid ");
+			}
+			else if (baseMethod.IsVirtual
+				&& !baseMethod.IsFinal
+				&& (baseMethod.IsPublic || baseMethod.IsFamily))
+			{
+				output.Append(baseMethod.IsPublic
+					? "\t\tpublic override void "
+					: "\t\tprotected override void ");
+			}
+			else
+			{
+				// Throw an exception so the user knows what to fix
+				StringBuilder errorBuilder = new StringBuilder(1024);
+				errorBuilder.Append("Base type \"");
+				AppendCsharpTypeFullName(
+					type,
+					errorBuilder);
+				errorBuilder.Append("\" has a non-virtual ");
+				errorBuilder.Append(messageName);
+				errorBuilder.Append(
+					", which would hide the generated one. Make it " +
+					"public or protected and virtual.");
+				throw new Exception(errorBuilder.ToString());
+			}
+			output.Append(messageName);
+			output.AppendLine("()");
+			output.AppendLine("\t\t{");
+			output.Append(prologue);
+			if (baseMethod != null)
+			{
+				output.Append("\t\t\tbase.");
+				output.Append(messageName);
+				output.AppendLine("();");
+			}
+			output.AppendLine("\t\t}");
+			output.AppendLine("\t\t");
+		}
+		
+		static void AppendBaseTypeBatchedMessages(
 			Type type,
 			TypeName typeTypeName,
-			Type[] typeParams,
-			MethodInfo methodInfo,
-			bool typeIsDelegate,
+			string[] messageNames,
 			int indent,
 			StringBuilders builders)
 		{
-			AppendCsharpGetDelegateCall(
-				GetTypeName(type),
-				typeParams,
-				methodInfo.Name,
-				builders.CsharpGetDelegateCalls);
-			
-			// Build the name of the C++ binding function that C# calls
-			builders.TempStrBuilder.Length = 0;
-			AppendNativeInvokeFuncName(
-				type,
-				typeParams,
-				methodInfo.Name,
-				builders.TempStrBuilder);
-			string nativeInvokeFuncName = builders.TempStrBuilder.ToString();
-			
-			AppendBaseTypeCppMethodCall(
-				type,
-				typeTypeName.Name,
+			if (!typeof(MonoBehaviour).IsAssignableFrom(type))
+			{
+				// Throw an exception so the user knows what to fix in the JSON
+				StringBuilder errorBuilder = new StringBuilder(1024);
+				errorBuilder.Append("Base type \"");
+				AppendCsharpTypeFullName(
+					type,
+					errorBuilder);
+				errorBuilder.Append(
+					"\" has batched messages but isn't a MonoBehaviour");
+				throw new Exception(errorBuilder.ToString());
+			}
+			
+			builders.NumPhysicsMessageReceivers++;
+			int receiver = builders.NumPhysicsMessageReceivers;
+			
+			// C++ case to deliver messages to this type
+			StringBuilder cases = builders.CppPhysicsMessageCases;
+			cases.Append("\t\t\tcase ");
+			cases.Append(receiver);
+			cases.AppendLine(":");
+			cases.AppendLine("\t\t\t{");
+			cases.Append("\t\t\t\t");
+			AppendCppTypeFullName(
 				typeTypeName,
-				typeParams,
-				methodInfo,
-				methodInfo.Name,
-				nativeInvokeFuncName,
-				methodInfo.Name,
-				IsNonDelegateClass(type),
-				typeIsDelegate,
-				indent,
-				builders);
+				cases);
+			cases.Append("* receiver = Get");
+			cases.Append(typeTypeName.Name);
+			cases.AppendLine("(message.CppHandle);");
+			cases.AppendLine("\t\t\t\tswitch (message.Type)");
+			cases.AppendLine("\t\t\t\t{");
+			
+			foreach (string messageName in messageNames)
+			{
+				if (Array.IndexOf(BatchedMessageNames, messageName) < 0 ||
+					type.GetMember(
+						messageName,
+						BindingFlags.Instance |
+						BindingFlags.Public |
+						BindingFlags.NonPublic).Length > 0)
+				{
+					// Throw an exception so the user knows what to fix in the JSON
+					StringBuilder errorBuilder = new StringBuilder(1024);
+					errorBuilder.Append("Batched message \"");
+					AppendCsharpTypeFullName(
+						type,
+						errorBuilder);
+					errorBuilder.Append('.');
+					errorBuilder.Append(messageName);
+					errorBuilder.Append(
+						"\" isn't a physics message or is already declared");
+					throw new Exception(errorBuilder.ToString());
+				}
+				
+				// "OnCollisionEnter" is PhysicsMessageType.CollisionEnter
+				string messageTypeName = messageName.Substring(2);
+				bool isCollision = messageName.StartsWith("OnCollision");
+				
+				// C++ method declaration
+				AppendIndent(
+					indent + 1,
+					builders.CppTypeDefinitions);
+				builders.CppTypeDefinitions.Append("virtual void ");
+				builders.CppTypeDefinitions.Append(messageName);
+				builders.CppTypeDefinitions.AppendLine(
+					"(Plugin::PhysicsMessage& message);");
+				
+				// C++ method definition. This is a no-op that game code overrides.
+				AppendIndent(
+					indent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("void ");
+				AppendCppTypeFullName(
+					typeTypeName,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.Append("::");
+				builders.CppMethodDefinitions.Append(messageName);
+				builders.CppMethodDefinitions.AppendLine(
+					"(Plugin::PhysicsMessage& message)");
+				AppendIndent(
+					indent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("{");
+				AppendIndent(
+					indent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("}");
+				AppendIndent(
+					indent,
+					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine();
+				
+				// C++ call of the method
+				cases.Append("\t\t\t\t\tcase PhysicsMessageType::");
+				cases.Append(messageTypeName);
+				cases.AppendLine(":");
+				cases.Append("\t\t\t\t\t\treceiver->");
+				cases.Append(messageName);
+				cases.AppendLine("(message);");
+				cases.AppendLine("\t\t\t\t\t\tbreak;");
+				
+				// C# message that records instead of calling C++
+				builders.CsharpBaseTypes.Append("\t\tvoid ");
+				builders.CsharpBaseTypes.Append(messageName);
+				builders.CsharpBaseTypes.AppendLine(isCollision
+					? "(UnityEngine.Collision collision)"
+					: "(UnityEngine.Collider other)");
+				builders.CsharpBaseTypes.AppendLine("\t\t{");
+				builders.CsharpBaseTypes.AppendLine("\t\t\tif (CppHandle != 0)");
+				builders.CsharpBaseTypes.AppendLine("\t\t\t{");
+				builders.CsharpBaseTypes.Append("\t\t\t\tNativeScript.Bindings.Record");
+				builders.CsharpBaseTypes.AppendLine(isCollision
+					? "CollisionMessage("
+					: "TriggerMessage(");
+				builders.CsharpBaseTypes.Append(
+					"\t\t\t\t\tNativeScript.Bindings.PhysicsMessageType.");
+				builders.CsharpBaseTypes.Append(messageTypeName);
+				builders.CsharpBaseTypes.AppendLine(",");
+				builders.CsharpBaseTypes.Append("\t\t\t\t\t");
+				builders.CsharpBaseTypes.Append(receiver);
+				builders.CsharpBaseTypes.AppendLine(",");
+				builders.CsharpBaseTypes.AppendLine("\t\t\t\t\tCppHandle,");
+				builders.CsharpBaseTypes.AppendLine(isCollision
+					? "\t\t\t\t\tcollision);"
+					: "\t\t\t\t\tother);");
+				builders.CsharpBaseTypes.AppendLine("\t\t\t}");
+				builders.CsharpBaseTypes.AppendLine("\t\t}");
+				builders.CsharpBaseTypes.AppendLine("\t\t");
+			}
+			
+			cases.AppendLine("\t\t\t\t\tdefault:");
+			cases.AppendLine("\t\t\t\t\t\tbreak;");
+			cases.AppendLine("\t\t\t\t}");
+			cases.AppendLine("\t\t\t\tbreak;");
+			cases.AppendLine("\t\t\t}");
 		}
 		
 		static void AppendBaseTypeProperty(
@@ -8242,7 +11305,6 @@ namespace NativeScript.Editor
 			
 			ParameterInfo[] invokeParams = AppendBaseTypeCppNativeInvokeCall(
 				type,
-				typeName,
 				typeTypeName,
 				typeParams,
 				methodInfo,
@@ -8480,7 +11542,6 @@ namespace NativeScript.Editor
 		{
 			ParameterInfo[] invokeParams = AppendBaseTypeCppNativeInvokeCall(
 				type,
-				typeName,
 				typeTypeName,
 				typeParams,
 				invokeMethod,
@@ -8490,6 +11551,17 @@ namespace NativeScript.Editor
 				indent,
 				builders);
 			
+			// Unity messages run what the bindings need before calling C++
+			string prologue = null;
+			if (invokeParams.Length == 0
+				&& invokeMethod.ReturnType == typeof(void)
+				&& builders.CsharpMessagePrologues.TryGetValue(
+					funcName,
+					out prologue))
+			{
+				builders.CsharpMessagePrologues.Remove(funcName);
+			}
+			
 			// C# method that calls the C++ binding function
 			ParameterInfo[] invokeParamsWithThis = PrependThisParameter(
 				invokeParams);
@@ -8499,6 +11571,7 @@ namespace NativeScript.Editor
 				isOverride,
 				invokeMethod,
 				funcName,
+				prologue,
 				invokeParams,
 				nativeInvokeFuncName,
 				invokeParamsWithThis,
@@ -8508,7 +11581,6 @@ namespace NativeScript.Editor
 		
 		static ParameterInfo[] AppendBaseTypeCppNativeInvokeCall(
 			Type type,
-			string typeName,
 			TypeName typeTypeName,
 			Type[] typeParams,
 			MethodInfo invokeMethod,
@@ -8579,32 +11651,37 @@ namespace NativeScript.Editor
 			AppendCppBaseTypeMethodInvokeBindingFunction(
 				funcName,
 				type,
+				typeTypeName,
+				typeIsDelegate,
 				typeParams,
 				invokeMethod,
 				methodName,
 				invokeReturnTypeKind,
 				invokeParams,
 				indent,
-				typeName,
 				builders.CppMethodDefinitions);
 			
-			// C# delegate for the C++ binding function
+			// C# delegate for the C++ binding function. The first parameter is
+			// the C++ object's pointer rather than its handle.
+			ParameterInfo[] invokeParamsWithThis = PrependThisParameter(
+				invokeParams);
 			AppendCsharpDelegate(
-				false,
+				true,
 				GetTypeName(type),
 				typeParams,
 				funcName,
-				invokeParams,
+				invokeParamsWithThis,
 				invokeMethod.ReturnType,
 				invokeReturnTypeKind,
 				builders.CsharpCppDelegates);
 			
 			// C# import for the C++ binding function
 			AppendCsharpImport(
+				true,
 				GetTypeName(type),
 				typeParams,
 				funcName,
-				invokeParams,
+				invokeParamsWithThis,
 				invokeMethod.ReturnType,
 				builders.CsharpImports);
 			
@@ -8621,9 +11698,9 @@ namespace NativeScript.Editor
 				invokeParamsWithThis[i+1] = invokeParams[i];
 			}
 			invokeParamsWithThis[0] = new ParameterInfo {
-				Name = "thisHandle",
-				ParameterType = typeof(int),
-				DereferencedParameterType = typeof(int),
+				Name = "thisPointer",
+				ParameterType = typeof(IntPtr),
+				DereferencedParameterType = typeof(IntPtr),
 				IsOut = false,
 				IsRef = false,
 				Kind = TypeKind.Primitive
@@ -8665,6 +11742,7 @@ namespace NativeScript.Editor
 					output);
 				output.AppendLine(")ObjectStore.Remove(classHandle);");
 				output.AppendLine("\t\t\t\t\tthiz.CppHandle = 0;");
+				output.AppendLine("\t\t\t\t\tthiz.CppPointer = IntPtr.Zero;");
 				output.AppendLine("\t\t\t\t}");
 				output.AppendLine("\t\t\t\t");
 			}
@@ -8677,6 +11755,7 @@ namespace NativeScript.Editor
 				output.AppendLine(")ObjectStore.Get(handle);");
 				output.AppendLine("\t\t\t\tint cppHandle = thiz.CppHandle;");
 				output.AppendLine("\t\t\t\tthiz.CppHandle = 0;");
+				output.AppendLine("\t\t\t\tthiz.CppPointer = IntPtr.Zero;");
 				output.Append("\t\t\t\tQueueDestroy(DestroyFunction.");
 				output.Append(bindingTypeTypeName.Name);
 				output.AppendLine(", cppHandle);");
@@ -8695,6 +11774,7 @@ namespace NativeScript.Editor
 			bool isOverride,
 			MethodInfo invokeMethod,
 			string funcName,
+			string prologue,
 			ParameterInfo[] invokeParams,
 			string nativeInvokeFuncName,
 			ParameterInfo[] invokeParamsWithThis,
@@ -8717,6 +11797,10 @@ namespace NativeScript.Editor
 				output);
 			output.AppendLine(")");
 			output.AppendLine("\t\t{");
+			if (prologue != null)
+			{
+				output.Append(prologue);
+			}
 			AppendCsharpBaseTypeCppMethodCallMethodBody(
 				invokeMethod,
 				nativeInvokeFuncName,
@@ -8747,7 +11831,7 @@ namespace NativeScript.Editor
 			AppendIndent(
 				indent + 1,
 				output);
-			output.AppendLine("int thisHandle = CppHandle;");
+			output.AppendLine("IntPtr thisPointer = CppPointer;");
 			AppendCppFunctionCall(
 				nativeInvokeFuncName,
 				invokeParamsWithThis,
@@ -8819,7 +11903,7 @@ namespace NativeScript.Editor
 				output);
 			output.Append("var thiz = new ");
 			AppendCsharpTypeFullName(typeTypeName, output);
-			output.Append("(cppHandle");
+			output.Append("(cppHandle, cppPointer");
 			if (cppConstructorParams.Length > 0)
 			{
 				output.Append(", ");
@@ -8852,13 +11936,14 @@ namespace NativeScript.Editor
 		static void AppendCppBaseTypeMethodInvokeBindingFunction(
 			string funcName,
 			Type type,
+			TypeName typeTypeName,
+			bool typeIsDelegate,
 			Type[] typeParams,
 			MethodInfo method,
 			string methodName,
 			TypeKind methodReturnTypeKind,
 			ParameterInfo[] methodParams,
 			int indent,
-			string typeName,
 			StringBuilder output)
 		{
 			AppendIndent(
@@ -8905,7 +11990,14 @@ namespace NativeScript.Editor
 				typeParams,
 				funcName,
 				output);
-			output.Append("(int32_t cppHandle");
+			output.Append('(');
+			AppendCppTypeFullName(
+				typeTypeName,
+				output);
+			AppendCppTypeParameters(
+				typeIsDelegate ? typeParams : null,
+				output);
+			output.Append("* thiz");
 			if (methodParams.Length > 0)
 			{
 				output.Append(", ");
@@ -8949,7 +12041,7 @@ namespace NativeScript.Editor
 			AppendIndent(
 				indent + 1,
 				output);
-			output.AppendLine("try");
+			output.AppendLine("PLUGIN_TRY");
 			AppendIndent(
 				indent + 1,
 				output);
@@ -8980,9 +12072,7 @@ namespace NativeScript.Editor
 			{
 				output.Append("return ");
 			}
-			output.Append("Plugin::Get");
-			output.Append(typeName);
-			output.Append("(cppHandle)->");
+			output.Append("thiz->");
 			output.Append(methodName);
 			output.Append("(");
 			for (int i = 0; i < methodParams.Length; ++i)
@@ -9018,33 +12108,7 @@ namespace NativeScript.Editor
 			AppendIndent(
 				indent + 1,
 				output);
-			output.AppendLine(
-				"catch (System::Exception ex)");
-			AppendIndent(
-				indent + 1,
-				output);
-			output.AppendLine("{");
-			AppendIndent(
-				indent + 2,
-				output);
-			output.AppendLine(
-				"Plugin::SetException(ex.Handle);");
-			if (method.ReturnType != typeof(void))
-			{
-				AppendIndent(
-					indent + 2,
-					output);
-				output.AppendLine(
-					"return {};");
-			}
-			AppendIndent(
-				indent + 1,
-				output);
-			output.AppendLine("}");
-			AppendIndent(
-				indent + 1,
-				output);
-			output.AppendLine("catch (...)");
+			output.AppendLine("PLUGIN_CATCH_ALL");
 			AppendIndent(
 				indent + 1,
 				output);
@@ -9053,21 +12117,11 @@ namespace NativeScript.Editor
 				indent + 2,
 				output);
 			output.Append(
-				"System::String msg = \"Unhandled exception invoking ");
+				"Plugin::SetCaughtException(\"Unhandled exception invoking ");
 			AppendCppTypeFullName(
 				type,
 				output);
-			output.AppendLine("\";");
-			AppendIndent(
-				indent + 2,
-				output);
-			output.AppendLine(
-				"System::Exception ex(msg);");
-			AppendIndent(
-				indent + 2,
-				output);
-			output.AppendLine(
-				"Plugin::SetException(ex.Handle);");
+			output.AppendLine("\");");
 			if (method.ReturnType != typeof(void))
 			{
 				AppendIndent(
@@ -9506,7 +12560,6 @@ namespace NativeScript.Editor
 			TypeName typeTypeName,
 			Type[] typeParams,
 			bool typeIsDelegate,
-			string derivedTypeName,
 			string releaseFuncName,
 			string bindingTypeName,
 			int cppMethodDefinitionsIndent,
@@ -9533,15 +12586,6 @@ namespace NativeScript.Editor
 				cppMethodDefinitionsIndent,
 				output);
 			output.AppendLine("{");
-			if (!string.IsNullOrEmpty(derivedTypeName))
-			{
-				AppendIndent(
-					cppMethodDefinitionsIndent + 1,
-					output);
-				output.Append("Plugin::RemoveWhole");
-				output.Append(bindingTypeName);
-				output.AppendLine("(this);");
-			}
 			AppendIndent(
 				cppMethodDefinitionsIndent + 1,
 				output);
@@ -9963,6 +13007,10 @@ namespace NativeScript.Editor
 				cppMethodDefinitionsIndent + 1,
 				output);
 			output.AppendLine("int32_t cppHandle = CppHandle;");
+			AppendIndent(
+				cppMethodDefinitionsIndent + 1,
+				output);
+			output.AppendLine("void* cppPointer = this;");
 			if (typeIsDelegate)
 			{
 				AppendIndent(
@@ -10045,69 +13093,40 @@ namespace NativeScript.Editor
 			int maxSimultaneous,
 			string typeName,
 			StringBuilder output,
-			StringBuilder outputFirstBoot)
+			StringBuilder outputFirstBoot,
+			StringBuilder outputUsage)
 		{
-			output.Append("\tPlugin::");
-			output.Append(typeName);
-			output.Append("FreeListSize = ");
-			output.Append(maxSimultaneous);
-			output.AppendLine(";");
+			maxSimultaneous = GetProfiledMaxSimultaneous(
+				typeName + "FreeList",
+				maxSimultaneous,
+				false);
 			
 			output.Append("\tPlugin::");
 			output.Append(typeName);
-			output.Append("FreeList = (");
-			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
-				output);
-			output.AppendLine("**)curMemory;");
-			
-			output.Append("\tcurMemory += ");
-			output.Append(maxSimultaneous);
-			output.Append(" * sizeof(");
+			output.Append("FreeList = Plugin::ChunkedFreeList<");
 			AppendCppTypeFullName(
 				cppTypeTypeName,
 				output);
 			AppendCppTypeParameters(
 				typeParams,
 				output);
-			output.AppendLine("*);");
-			
-			output.AppendLine("\t");
-			
-			outputFirstBoot.Append("\t\tfor (int32_t i = 0, end = Plugin::");
-			outputFirstBoot.Append(typeName);
-			outputFirstBoot.AppendLine("FreeListSize - 1; i < end; ++i)");
-			outputFirstBoot.AppendLine("\t\t{");
-			outputFirstBoot.Append("\t\t\tPlugin::");
-			outputFirstBoot.Append(typeName);
-			outputFirstBoot.Append("FreeList[i] = (");
-			AppendCppTypeFullName(
-				cppTypeTypeName,
-				outputFirstBoot);
-			AppendCppTypeParameters(
-				typeParams,
-				outputFirstBoot);
-			outputFirstBoot.Append("*)(Plugin::");
-			outputFirstBoot.Append(typeName);
-			outputFirstBoot.AppendLine("FreeList + i + 1);");
-			outputFirstBoot.AppendLine("\t\t}");
+			output.Append("*>::Place(curMemory, ");
+			output.Append(maxSimultaneous);
+			output.AppendLine(");");
+			output.AppendLine("\t");
 			
 			outputFirstBoot.Append("\t\tPlugin::");
 			outputFirstBoot.Append(typeName);
-			outputFirstBoot.Append("FreeList[Plugin::");
-			outputFirstBoot.Append(typeName);
-			outputFirstBoot.AppendLine("FreeListSize - 1] = nullptr;");
-			
-			outputFirstBoot.Append("\t\tPlugin::NextFree");
-			outputFirstBoot.Append(typeName);
-			outputFirstBoot.Append(" = Plugin::");
-			outputFirstBoot.Append(typeName);
-			outputFirstBoot.AppendLine("FreeList + 1;");
-			
+			outputFirstBoot.Append("FreeList->Init(");
+			outputFirstBoot.Append(maxSimultaneous);
+			outputFirstBoot.AppendLine(");");
 			outputFirstBoot.AppendLine("\t\t");
+			
+			outputUsage.Append("\t\treport.AddFreeList(\"");
+			outputUsage.Append(typeName);
+			outputUsage.Append("FreeList\", ");
+			outputUsage.Append(typeName);
+			outputUsage.AppendLine("FreeList);");
 		}
 
 		static void AppendCppPointerFreeListStateAndFunctions(
@@ -10127,34 +13146,17 @@ namespace NativeScript.Editor
 			output.AppendLine(" pointers");
 			output.AppendLine("\t");
 
-			// Size variable
-			output.Append("\tint32_t ");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeListSize;");
-
 			// Free list variable
-			output.Append('\t');
+			output.Append("\tChunkedFreeList<");
 			AppendCppTypeFullName(
 				cppTypeTypeName,
 				output);
 			AppendCppTypeParameters(
 				typeParams,
 				output);
-			output.Append("** ");
+			output.Append("*>* ");
 			output.Append(bindingTypeName);
 			output.AppendLine("FreeList;");
-
-			// Next free variable
-			output.Append('\t');
-			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
-				output);
-			output.Append("** NextFree");
-			output.Append(bindingTypeName);
-			output.AppendLine(";");
 			output.AppendLine("\t");
 
 			// Store function
@@ -10169,9 +13171,6 @@ namespace NativeScript.Editor
 				output);
 			output.AppendLine("* del)");
 			output.AppendLine("\t{");
-			output.Append("\t\tassert(NextFree");
-			output.Append(bindingTypeName);
-			output.AppendLine(" != nullptr);");
 			output.Append("\t\t");
 			AppendCppTypeFullName(
 				cppTypeTypeName,
@@ -10179,23 +13178,14 @@ namespace NativeScript.Editor
 			AppendCppTypeParameters(
 				typeParams,
 				output);
-			output.Append("** pNext = NextFree");
-			output.Append(bindingTypeName);
-			output.AppendLine(";");
-			output.Append("\t\tNextFree");
+			output.Append("** pNext = ");
 			output.Append(bindingTypeName);
-			output.Append(" = (");
-			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
-				output);
-			output.AppendLine("**)*pNext;");
+			output.AppendLine("FreeList->Allocate();");
+			output.AppendLine("\t\tassert(pNext != nullptr);");
 			output.AppendLine("\t\t*pNext = del;");
-			output.Append("\t\treturn (int32_t)(pNext - ");
+			output.Append("\t\treturn ");
 			output.Append(bindingTypeName);
-			output.AppendLine("FreeList);");
+			output.AppendLine("FreeList->GetHandle(pNext);");
 			output.AppendLine("\t}");
 			output.AppendLine("\t");
 
@@ -10211,13 +13201,9 @@ namespace NativeScript.Editor
 			output.Append(bindingTypeName);
 			output.AppendLine("(int32_t handle)");
 			output.AppendLine("\t{");
-			output.Append(
-				"\t\tassert(handle >= 0 && handle < ");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeListSize);");
-			output.Append("\t\treturn ");
+			output.Append("\t\treturn *");
 			output.Append(bindingTypeName);
-			output.AppendLine("FreeList[handle];");
+			output.AppendLine("FreeList->Get(handle);");
 			output.AppendLine("\t}");
 			output.AppendLine("\t");
 
@@ -10227,163 +13213,93 @@ namespace NativeScript.Editor
 			output.AppendLine("(int32_t handle)");
 			output.AppendLine("\t{");
 			output.Append("\t\t");
-			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
-				output);
-			output.Append("** pRelease = ");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeList + handle;");
-			output.Append("\t\t*pRelease = (");
-			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
-				output);
-			output.Append("*)NextFree");
 			output.Append(bindingTypeName);
-			output.AppendLine(";");
-			output.Append("\t\tNextFree");
-			output.Append(bindingTypeName);
-			output.AppendLine(" = pRelease;");
+			output.AppendLine("FreeList->Free(handle);");
 			output.AppendLine("\t}");
 			output.AppendLine("\t");
 		}
 
 		static void AppendCppWholeObjectFreeListInit(
+			TypeName derivedTypeTypeName,
 			int maxSimultaneous,
 			string bindingTypeName,
 			StringBuilder output,
-			StringBuilder outputFirstBoot)
+			StringBuilder outputFirstBoot,
+			StringBuilder outputUsage)
 		{
+			maxSimultaneous = GetProfiledMaxSimultaneous(
+				bindingTypeName + "FreeWholeList",
+				maxSimultaneous,
+				false);
+			
 			output.Append("\tPlugin::");
 			output.Append(bindingTypeName);
-			output.Append("FreeWholeListSize = ");
-			output.Append(maxSimultaneous);
-			output.AppendLine(";");
-
-			output.Append("\tPlugin::");
-			output.Append(bindingTypeName);
-			output.Append("FreeWholeList = (Plugin::");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeWholeListEntry*)curMemory;");
-
-			output.Append("\tcurMemory += ");
+			output.Append("FreeWholeList = Plugin::ChunkedFreeList<");
+			AppendCppTypeFullName(
+				derivedTypeTypeName,
+				output);
+			output.Append(">::Place(curMemory, ");
 			output.Append(maxSimultaneous);
-			output.Append(" * sizeof(Plugin::");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeWholeListEntry);");
-
+			output.AppendLine(");");
 			output.AppendLine("\t");
 
-			outputFirstBoot.Append("\t\tfor (int32_t i = 0, end = Plugin::");
-			outputFirstBoot.Append(bindingTypeName);
-			outputFirstBoot.AppendLine("FreeWholeListSize - 1; i < end; ++i)");
-			outputFirstBoot.AppendLine("\t\t{");
-			outputFirstBoot.Append("\t\t\tPlugin::");
-			outputFirstBoot.Append(bindingTypeName);
-			outputFirstBoot.Append("FreeWholeList[i].Next = Plugin::");
-			outputFirstBoot.Append(bindingTypeName);
-			outputFirstBoot.AppendLine("FreeWholeList + i + 1;");
-			outputFirstBoot.AppendLine("\t\t}");
-
 			outputFirstBoot.Append("\t\tPlugin::");
 			outputFirstBoot.Append(bindingTypeName);
-			outputFirstBoot.Append("FreeWholeList[Plugin::");
-			outputFirstBoot.Append(bindingTypeName);
-			outputFirstBoot.AppendLine("FreeWholeListSize - 1].Next = nullptr;");
-
-			outputFirstBoot.Append("\t\tPlugin::NextFreeWhole");
-			outputFirstBoot.Append(bindingTypeName);
-			outputFirstBoot.Append(" = Plugin::");
-			outputFirstBoot.Append(bindingTypeName);
-			outputFirstBoot.AppendLine("FreeWholeList + 1;");
-
+			outputFirstBoot.Append("FreeWholeList->Init(");
+			outputFirstBoot.Append(maxSimultaneous);
+			outputFirstBoot.AppendLine(");");
 			outputFirstBoot.AppendLine("\t\t");
+			
+			outputUsage.Append("\t\treport.AddFreeList(\"");
+			outputUsage.Append(bindingTypeName);
+			outputUsage.Append("FreeWholeList\", ");
+			outputUsage.Append(bindingTypeName);
+			outputUsage.AppendLine("FreeWholeList);");
 		}
 
 		static void AppendCppWholeObjectFreeListStateAndFunctions(
 			Type[] typeParams,
 			TypeName cppTypeTypeName,
+			TypeName derivedTypeTypeName,
 			string bindingTypeName,
 			StringBuilder output)
 		{
-			// Section comment
+			// Section comment. Entries are sized for the derived type since
+			// that's what's constructed in them.
 			output.Append("\t// Free list for whole ");
 			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
+				derivedTypeTypeName,
 				output);
 			output.AppendLine(" objects");
 			output.AppendLine("\t");
 
-			// Union with a pointer and a whole object
-			output.Append("\tunion ");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeWholeListEntry");
-			output.AppendLine("\t{");
-			output.Append("\t\t");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeWholeListEntry* Next;");
-			output.Append("\t\t");
+			// Free list variable
+			output.Append("\tChunkedFreeList<");
 			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
+				derivedTypeTypeName,
 				output);
-			output.AppendLine(" Value;");
-			output.AppendLine("\t};");
-
-			// Size
-			output.Append("\tint32_t ");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeWholeListSize;");
-
-			// Free list entries
-			output.Append('\t');
-			output.Append(bindingTypeName);
-			output.Append("FreeWholeListEntry* ");
+			output.Append(">* ");
 			output.Append(bindingTypeName);
 			output.AppendLine("FreeWholeList;");
-
-			// Pointer to next free entry
-			output.Append('\t');
-			output.Append(bindingTypeName);
-			output.Append("FreeWholeListEntry* NextFreeWhole");
-			output.Append(bindingTypeName);
-			output.AppendLine(";");
 			output.AppendLine("\t");
 
 			// Store function
 			output.Append('\t');
 			AppendCppTypeFullName(
-				cppTypeTypeName,
-				output);
-			AppendCppTypeParameters(
-				typeParams,
+				derivedTypeTypeName,
 				output);
 			output.Append("* StoreWhole");
 			output.Append(bindingTypeName);
 			output.AppendLine("()");
 			output.AppendLine("\t{");
-			output.Append("\t\tassert(NextFreeWhole");
-			output.Append(bindingTypeName);
-			output.AppendLine(" != nullptr);");
 			output.Append("\t\t");
+			AppendCppTypeFullName(
+				derivedTypeTypeName,
+				output);
+			output.Append("* pNext = ");
 			output.Append(bindingTypeName);
-			output.Append("FreeWholeListEntry* pNext = NextFreeWhole");
-			output.Append(bindingTypeName);
-			output.AppendLine(";");
-			output.Append("\t\tNextFreeWhole");
-			output.Append(bindingTypeName);
-			output.AppendLine(" = pNext->Next;");
-			output.AppendLine("\t\treturn &pNext->Value;");
+			output.AppendLine("FreeWholeList->Allocate();");
+			output.AppendLine("\t\treturn pNext;");
 			output.AppendLine("\t}");
 			output.AppendLine("\t");
 
@@ -10399,25 +13315,14 @@ namespace NativeScript.Editor
 				output);
 			output.AppendLine("* instance)");
 			output.AppendLine("\t{");
-			output.Append("\t\t");
+			output.Append("\t\tint32_t handle = ");
 			output.Append(bindingTypeName);
-			output.Append("FreeWholeListEntry* pRelease = (");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeWholeListEntry*)instance;");
-			output.Append("\t\tif (pRelease >= ");
-			output.Append(bindingTypeName);
-			output.Append("FreeWholeList && pRelease < ");
-			output.Append(bindingTypeName);
-			output.Append("FreeWholeList + (");
-			output.Append(bindingTypeName);
-			output.AppendLine("FreeWholeListSize - 1))");
+			output.AppendLine("FreeWholeList->GetHandle(instance);");
+			output.AppendLine("\t\tif (handle >= 0)");
 			output.AppendLine("\t\t{");
-			output.Append("\t\t\tpRelease->Next = NextFreeWhole");
-			output.Append(bindingTypeName);
-			output.AppendLine(";");
-			output.Append("\t\t\tNextFreeWhole");
+			output.Append("\t\t\t");
 			output.Append(bindingTypeName);
-			output.AppendLine(" = pRelease->Next;");
+			output.AppendLine("FreeWholeList->Free(handle);");
 			output.AppendLine("\t\t}");
 			output.AppendLine("\t}");
 			output.AppendLine("\t");
@@ -10557,6 +13462,7 @@ namespace NativeScript.Editor
 		}
 		
 		static void AppendCsharpImport(
+			bool isStatic,
 			TypeName typeTypeName,
 			Type[] typeParams,
 			string funcName,
@@ -10574,10 +13480,14 @@ namespace NativeScript.Editor
 				typeParams,
 				funcName,
 				output);
-			output.Append("(int thisHandle");
-			if (parameters.Length > 0)
+			output.Append('(');
+			if (!isStatic)
 			{
-				output.Append(", ");
+				output.Append("int thisHandle");
+				if (parameters.Length > 0)
+				{
+					output.Append(", ");
+				}
 			}
 			for (int i = 0; i < parameters.Length; ++i)
 			{
@@ -10680,114 +13590,58 @@ namespace NativeScript.Editor
 					builders.TempStrBuilder);
 				string funcName = builders.TempStrBuilder.ToString();
 				
-				// C++ thrower type
-				int throwerIndent = AppendNamespaceBeginning(
+				// C++ function to throw the exception once C++ gets its handle
+				builders.TempStrBuilder.Length = 0;
+				builders.TempStrBuilder.Append("Throw");
+				AppendNamespace(
 					exceptionType.Namespace,
-					builders.CppMethodDefinitions);
-				AppendIndent(
-					throwerIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append("struct ");
-				builders.CppMethodDefinitions.Append(exceptionType.Name);
-				builders.CppMethodDefinitions.Append("Thrower : ");
-				AppendCppTypeFullName(
-					exceptionType,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine();;
-				AppendIndent(
-					throwerIndent,
-					builders.CppMethodDefinitions);
+					string.Empty,
+					builders.TempStrBuilder);
+				AppendTypeNameWithoutGenericSuffix(
+					exceptionType.Name,
+					builders.TempStrBuilder);
+				string throwerFuncName = builders.TempStrBuilder.ToString();
+				builders.CppMethodDefinitions.AppendLine("namespace Plugin");
 				builders.CppMethodDefinitions.AppendLine("{");
-				AppendIndent(
-					throwerIndent + 1,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append(exceptionType.Name);
-				builders.CppMethodDefinitions.AppendLine("Thrower(int32_t handle)");
-				AppendIndent(
-					throwerIndent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine(": System::Runtime::InteropServices::_Exception(nullptr)");
-				AppendIndent(
-					throwerIndent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine(", System::Runtime::Serialization::ISerializable(nullptr)");
-				AppendIndent(
-					throwerIndent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine(", System::Exception(nullptr)");
-				AppendIndent(
-					throwerIndent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine(", System::SystemException(nullptr)");
-				AppendIndent(
-					throwerIndent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.Append(", ");
+				builders.CppMethodDefinitions.Append("\tvoid ");
+				builders.CppMethodDefinitions.Append(throwerFuncName);
+				builders.CppMethodDefinitions.AppendLine("(int32_t handle)");
+				builders.CppMethodDefinitions.AppendLine("\t{");
+				builders.CppMethodDefinitions.AppendLine("#if !PLUGIN_EXCEPTIONS");
+				builders.CppMethodDefinitions.AppendLine("\t\t(void)handle;");
+				builders.CppMethodDefinitions.AppendLine("#endif");
+				builders.CppMethodDefinitions.Append("\t\tPLUGIN_THROW(");
 				AppendCppTypeFullName(
 					exceptionType,
 					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("(Plugin::InternalUse::Only, handle)");
-				AppendIndent(
-					throwerIndent + 1,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("{");
-				AppendIndent(
-					throwerIndent + 1,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("}");
-				AppendIndent(
-					throwerIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine();;
-				AppendIndent(
-					throwerIndent + 1,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("virtual void ThrowReferenceToThis()");
-				AppendIndent(
-					throwerIndent + 1,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("{");
-				AppendIndent(
-					throwerIndent + 2,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("throw *this;");
-				AppendIndent(
-					throwerIndent + 1,
-					builders.CppMethodDefinitions);
+				builders.CppMethodDefinitions.AppendLine("(Plugin::InternalUse::Only, handle));");
+				builders.CppMethodDefinitions.AppendLine("\t}");
 				builders.CppMethodDefinitions.AppendLine("}");
-				AppendIndent(
-					throwerIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("};");
-				AppendNamespaceEnding(
-					throwerIndent,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine();;
+				builders.CppMethodDefinitions.AppendLine();
 				
-				// C++ function
+				// C++ function. C# keeps the exception object so this only
+				// records how to throw it.
 				builders.CppMethodDefinitions.Append("DLLEXPORT void ");
 				builders.CppMethodDefinitions.Append(funcName);
-				builders.CppMethodDefinitions.AppendLine("(int32_t handle)");
+				builders.CppMethodDefinitions.AppendLine("()");
 				builders.CppMethodDefinitions.AppendLine("{");
-				builders.CppMethodDefinitions.AppendLine("\tdelete Plugin::unhandledCsharpException;");
-				builders.CppMethodDefinitions.Append("\tPlugin::unhandledCsharpException = new ");
-				AppendCppTypeFullName(
-					exceptionType,
-					builders.CppMethodDefinitions);
-				builders.CppMethodDefinitions.AppendLine("Thrower(handle);");
+				builders.CppMethodDefinitions.Append("\tPlugin::unhandledCsharpException = Plugin::");
+				builders.CppMethodDefinitions.Append(throwerFuncName);
+				builders.CppMethodDefinitions.AppendLine(";");
 				builders.CppMethodDefinitions.AppendLine("}");
 				builders.CppMethodDefinitions.AppendLine();
 				
 				// Build parameters
 				ParameterInfo[] parameters = ConvertParameters(
-					new[]{ typeof(int) });
+					Type.EmptyTypes);
 				
 				// C# imports
 				AppendCsharpImport(
+					true,
 					GetTypeName(string.Empty, string.Empty),
 					null,
 					funcName,
-					ConvertParameters(Type.EmptyTypes),
+					parameters,
 					typeof(void),
 					builders.CsharpImports);
 				
@@ -12059,6 +14913,21 @@ namespace NativeScript.Editor
 			string funcName,
 			StringBuilder initCallOutput,
 			StringBuilder delegateOutput)
+		{
+			AppendCsharpCsharpDelegate(
+				funcName,
+				false,
+				initCallOutput,
+				delegateOutput);
+		}
+		
+		// Binding a method with pointer parameters to its delegate is only
+		// allowed in an unsafe context
+		static void AppendCsharpCsharpDelegate(
+			string funcName,
+			bool isUnsafe,
+			StringBuilder initCallOutput,
+			StringBuilder delegateOutput)
 		{
 			initCallOutput.Append(
 				"\t\t\tMarshal.WriteIntPtr(memory, curMemory, Marshal.GetFunctionPointerForDelegate(");
@@ -12067,7 +14936,12 @@ namespace NativeScript.Editor
 			initCallOutput.AppendLine("));");
 			initCallOutput.AppendLine("\t\t\tcurMemory += IntPtr.Size;");
 
-			delegateOutput.Append("\t\tstatic readonly ");
+			delegateOutput.Append("\t\tstatic ");
+			if (isUnsafe)
+			{
+				delegateOutput.Append("unsafe ");
+			}
+			delegateOutput.Append("readonly ");
 			delegateOutput.Append(funcName);
 			delegateOutput.Append("DelegateType ");
 			delegateOutput.Append(funcName);
@@ -12088,10 +14962,15 @@ namespace NativeScript.Editor
 			StringBuilder output)
 		{
 			output.AppendLine("\t\t[UnmanagedFunctionPointer(CallingConvention.Cdecl)]");
-			output.Append("\t\tdelegate ");
+			output.Append("\t\t");
+			if (IsUnsafeBinding(returnType, parameters))
+			{
+				output.Append("unsafe ");
+			}
+			output.Append("delegate ");
 			
 			// Return type
-			if (IsFullValueType(returnType))
+			if (IsFullValueType(returnType) || returnType.IsPointer)
 			{
 				AppendCsharpTypeFullName(
 					returnType,
@@ -12143,11 +15022,15 @@ namespace NativeScript.Editor
 			output.Append(funcName);
 			output.AppendLine("DelegateType))]");
 			output.Append("\t\tstatic ");
+			if (IsUnsafeBinding(returnType, parameters))
+			{
+				output.Append("unsafe ");
+			}
 			
 			// Return type
 			if (returnType != null)
 			{
-				if (IsFullValueType(returnType))
+				if (IsFullValueType(returnType) || returnType.IsPointer)
 				{
 					AppendCsharpTypeFullName(
 						returnType,
@@ -12354,7 +15237,8 @@ namespace NativeScript.Editor
 					forceReturnReturnValue
 					|| returnTypeKind == TypeKind.Enum
 					|| returnTypeKind == TypeKind.FullStruct
-					|| returnTypeKind == TypeKind.Primitive)
+					|| returnTypeKind == TypeKind.Primitive
+					|| returnTypeKind == TypeKind.Pointer)
 				{
 					output.Append("returnValue");
 				}
@@ -12436,12 +15320,12 @@ namespace NativeScript.Editor
 				output);
 			output.AppendLine(" ex)");
 			output.AppendLine("\t\t\t{");
-			output.AppendLine("\t\t\t\tUnityEngine.Debug.LogException(ex);");
+			output.AppendLine("\t\t\t\tNativeScript.Bindings.UnhandledCsharpException = ex;");
 			output.Append("\t\t\t\tNativeScript.Bindings.");
 			AppendCsharpSetCsharpExceptionFunctionName(
 				exceptionType,
 				output);
-			output.AppendLine("(NativeScript.Bindings.ObjectStore.Store(ex));");
+			output.AppendLine("();");
 			foreach (ParameterInfo param in parameters)
 			{
 				if (param.IsOut)
@@ -12466,7 +15350,7 @@ namespace NativeScript.Editor
 			if (returnType != typeof(void))
 			{
 				output.Append("\t\t\t\treturn default(");
-				if (IsFullValueType(returnType))
+				if (IsFullValueType(returnType) || returnType.IsPointer)
 				{
 					AppendCsharpTypeFullName(
 						returnType,
@@ -12524,6 +15408,7 @@ namespace NativeScript.Editor
 					case TypeKind.Primitive:
 					case TypeKind.Enum:
 					case TypeKind.Class:
+					case TypeKind.Pointer:
 						if (param.IsOut || param.IsRef)
 						{
 							output.Append("ref ");
@@ -12777,6 +15662,7 @@ namespace NativeScript.Editor
 					case TypeKind.Enum:
 					case TypeKind.FullStruct:
 					case TypeKind.Primitive:
+					case TypeKind.Pointer:
 						output.Append("returnValue");
 						break;
 					default:
@@ -12848,6 +15734,7 @@ namespace NativeScript.Editor
 				{
 					case TypeKind.FullStruct:
 					case TypeKind.Enum:
+					case TypeKind.Pointer:
 						output.Append(param.Name);
 						break;
 					case TypeKind.Primitive:
@@ -12915,13 +15802,7 @@ namespace NativeScript.Editor
 			AppendIndent(indent, output);
 			output.AppendLine("{");
 			AppendIndent(indent + 1, output);
-			output.AppendLine("System::Exception* ex = Plugin::unhandledCsharpException;");
-			AppendIndent(indent + 1, output);
-			output.AppendLine("Plugin::unhandledCsharpException = nullptr;");
-			AppendIndent(indent + 1, output);
-			output.AppendLine("ex->ThrowReferenceToThis();");
-			AppendIndent(indent + 1, output);
-			output.AppendLine("delete ex;");
+			output.AppendLine("Plugin::ThrowUnhandledCsharpException();");
 			AppendIndent(indent, output);
 			output.AppendLine("}");
 		}
@@ -12976,6 +15857,10 @@ namespace NativeScript.Editor
 			{
 				AppendCppPrimitiveTypeName(returnType, output);
 			}
+			else if (returnType.IsPointer)
+			{
+				AppendCppTypeFullName(returnType, output);
+			}
 			else if (IsFullValueType(returnType))
 			{
 				AppendCppTypeFullName(returnType, output);
@@ -13024,6 +15909,7 @@ namespace NativeScript.Editor
 						}
 						break;
 					case TypeKind.Enum:
+					case TypeKind.Pointer:
 						AppendCppTypeFullName(
 							param.DereferencedParameterType,
 							output);
@@ -13219,6 +16105,13 @@ namespace NativeScript.Editor
 			{
 				output.Append("object");
 			}
+			else if (type.IsPointer)
+			{
+				AppendCsharpTypeFullName(
+					type.GetElementType(),
+					output);
+				output.Append('*');
+			}
 			else if (type.IsArray)
 			{
 				AppendCsharpTypeFullName(
@@ -13310,10 +16203,47 @@ namespace NativeScript.Editor
 			{
 				output.Append("System::String");
 			}
-			else if (type == typeof(IntPtr))
+			else if (type == typeof(IntPtr) || type == typeof(UIntPtr))
 			{
 				output.Append("void*");
 			}
+			else if (type.IsPointer)
+			{
+				// Pointers to primitives use the C++ primitive type so they
+				// point to the same memory layout as in C#
+				Type elementType = type.GetElementType();
+				if (elementType == typeof(bool))
+				{
+					// C# bool is one byte in memory, unlike as a parameter
+					output.Append("uint8_t");
+				}
+				else if (elementType.IsPrimitive)
+				{
+					AppendCppPrimitiveTypeName(
+						elementType,
+						output);
+				}
+				else if (IsFullValueType(elementType))
+				{
+					AppendCppTypeFullName(
+						elementType,
+						output);
+				}
+				else
+				{
+					// Classes and managed structs are handles in C++, so
+					// there's no C++ type with the memory layout to point to
+					StringBuilder errorBuilder = new StringBuilder();
+					errorBuilder.Append("Pointer type \"");
+					AppendCsharpTypeFullName(type, errorBuilder);
+					errorBuilder.Append(
+						"\" isn't supported. Pointers must be to a " +
+						"primitive, enum, or struct with only primitive, " +
+						"enum, and struct fields.");
+					throw new Exception(errorBuilder.ToString());
+				}
+				output.Append('*');
+			}
 			else if (type.IsArray)
 			{
 				int rank = type.GetArrayRank();
@@ -13425,7 +16355,7 @@ namespace NativeScript.Editor
 			{
 				output.Append("double");
 			}
-			else if (type == typeof(IntPtr))
+			else if (type == typeof(IntPtr) || type == typeof(UIntPtr))
 			{
 				output.Append("void*");
 			}
@@ -13440,6 +16370,11 @@ namespace NativeScript.Editor
 		{
 			RemoveTrailingChars(builders.CsharpDelegateTypes);
 			RemoveTrailingChars(builders.CsharpStoreInitCalls);
+			RemoveTrailingChars(builders.CsharpStoreSnapshotSaves);
+			RemoveTrailingChars(builders.CsharpStoreSnapshotRestores);
+			RemoveTrailingChars(builders.CsharpBaseTypeSnapshotDetaches);
+			RemoveTrailingChars(builders.CsharpBaseTypeSnapshotSaves);
+			RemoveTrailingChars(builders.CsharpBaseTypeSnapshotRebinds);
 			RemoveTrailingChars(builders.CsharpInitCall);
 			RemoveTrailingChars(builders.CsharpBaseTypes);
 			RemoveTrailingChars(builders.CsharpFunctions);
@@ -13462,6 +16397,8 @@ namespace NativeScript.Editor
 			RemoveTrailingChars(builders.CppUnboxingMethodDeclarations);
 			RemoveTrailingChars(builders.CppStringDefaultParams);
 			RemoveTrailingChars(builders.CppMacros);
+			RemoveTrailingChars(builders.CppPhysicsMessageCases);
+			RemoveTrailingChars(builders.CppMemoryUsage);
 		}
 		
 		// Remove trailing chars (e.g. commas) for last elements
@@ -13502,6 +16439,31 @@ namespace NativeScript.Editor
 				"/*BEGIN STORE INIT CALLS*/",
 				"\t\t\t/*END STORE INIT CALLS*/",
 				builders.CsharpStoreInitCalls.ToString());
+			csharpContents = InjectIntoString(
+				csharpContents,
+				"/*BEGIN STORE SNAPSHOT SAVES*/",
+				"\t\t\t/*END STORE SNAPSHOT SAVES*/",
+				builders.CsharpStoreSnapshotSaves.ToString());
+			csharpContents = InjectIntoString(
+				csharpContents,
+				"/*BEGIN STORE SNAPSHOT RESTORES*/",
+				"\t\t\t/*END STORE SNAPSHOT RESTORES*/",
+				builders.CsharpStoreSnapshotRestores.ToString());
+			csharpContents = InjectIntoString(
+				csharpContents,
+				"/*BEGIN BASE TYPE SNAPSHOT DETACHES*/",
+				"\t\t\t\t/*END BASE TYPE SNAPSHOT DETACHES*/",
+				builders.CsharpBaseTypeSnapshotDetaches.ToString());
+			csharpContents = InjectIntoString(
+				csharpContents,
+				"/*BEGIN BASE TYPE SNAPSHOT SAVES*/",
+				"\t\t\t\t/*END BASE TYPE SNAPSHOT SAVES*/",
+				builders.CsharpBaseTypeSnapshotSaves.ToString());
+			csharpContents = InjectIntoString(
+				csharpContents,
+				"/*BEGIN BASE TYPE SNAPSHOT REBINDS*/",
+				"\t\t\t\t/*END BASE TYPE SNAPSHOT REBINDS*/",
+				builders.CsharpBaseTypeSnapshotRebinds.ToString());
 			csharpContents = InjectIntoString(
 				csharpContents,
 				"/*BEGIN INIT CALL*/",
@@ -13547,6 +16509,16 @@ namespace NativeScript.Editor
 				"/*BEGIN DESTROY QUEUE CASES*/",
 				"\t\t\t\t\t\t/*END DESTROY QUEUE CASES*/",
 				builders.CsharpDestroyQueueCases.ToString());
+			csharpContents = InjectIntoString(
+				csharpContents,
+				"/*BEGIN SPAWN COMPONENT ENUMERATORS*/",
+				"\t\t\t/*END SPAWN COMPONENT ENUMERATORS*/",
+				builders.CsharpSpawnComponentEnumerators.ToString());
+			csharpContents = InjectIntoString(
+				csharpContents,
+				"/*BEGIN SPAWN COMPONENT CASES*/",
+				"\t\t\t\t/*END SPAWN COMPONENT CASES*/",
+				builders.CsharpSpawnComponentCases.ToString());
 			cppSourceContents = InjectIntoString(
 				cppSourceContents,
 				"/*BEGIN FUNCTION POINTERS*/",
@@ -13597,6 +16569,21 @@ namespace NativeScript.Editor
 				"/*BEGIN GLOBAL STATE AND FUNCTIONS*/",
 				"\t/*END GLOBAL STATE AND FUNCTIONS*/",
 				builders.CppGlobalStateAndFunctions.ToString());
+			cppSourceContents = InjectIntoString(
+				cppSourceContents,
+				"/*BEGIN PHYSICS MESSAGE CASES*/",
+				"\t\t\t/*END PHYSICS MESSAGE CASES*/",
+				builders.CppPhysicsMessageCases.ToString());
+			cppSourceContents = InjectIntoString(
+				cppSourceContents,
+				"/*BEGIN MEMORY USAGE*/",
+				"\t\t/*END MEMORY USAGE*/",
+				builders.CppMemoryUsage.ToString());
+			cppHeaderContents = InjectIntoString(
+				cppHeaderContents,
+				"/*BEGIN SPAWN COMPONENT ENUMERATORS*/",
+				"\t\t/*END SPAWN COMPONENT ENUMERATORS*/",
+				builders.CppSpawnComponentEnumerators.ToString());
 			cppHeaderContents = InjectIntoString(
 				cppHeaderContents,
 				"/*BEGIN UNBOXING METHOD DECLARATIONS*/",
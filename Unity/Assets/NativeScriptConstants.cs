@@ -14,4 +14,10 @@ public static class NativeScriptConstants
 	/// Path within the Unity project to the exposed types JSON file
 	/// </summary>
 	public const string JSON_CONFIG_PATH = "NativeScriptTypes.json";
+	
+	/// <summary>
+	/// Path within the Unity project to the file that peak usage of plugin
+	/// memory pools is recorded to and the code generator sizes them from
+	/// </summary>
+	public const string MEMORY_PROFILE_PATH = "NativeScriptMemoryProfile.json";
 }
\ No newline at end of file